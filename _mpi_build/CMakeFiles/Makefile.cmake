@@ -0,0 +1,274 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/Doxyfile.in"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/FindCLP.cmake"
+  "/root/repo/cmake/FindEigen3.cmake"
+  "/root/repo/cmake/FindMKL.cmake"
+  "/root/repo/resources/A_small.csv"
+  "/root/repo/resources/A_small_with_column_and_row_names.csv"
+  "/root/repo/resources/CMakeLists.txt"
+  "/root/repo/resources/b_small.csv"
+  "/root/repo/resources/b_small_with_row_names.csv"
+  "/root/repo/resources/e_coli_core/A_e_coli_core_rounded.csv"
+  "/root/repo/resources/e_coli_core/A_e_coli_core_unrounded.csv"
+  "/root/repo/resources/e_coli_core/CMakeLists.txt"
+  "/root/repo/resources/e_coli_core/N_e_coli_core_rounded.csv"
+  "/root/repo/resources/e_coli_core/N_e_coli_core_unrounded.csv"
+  "/root/repo/resources/e_coli_core/S_e_coli_core.csv"
+  "/root/repo/resources/e_coli_core/T_e_coli_core_rounded.csv"
+  "/root/repo/resources/e_coli_core/b_e_coli_core_rounded.csv"
+  "/root/repo/resources/e_coli_core/b_e_coli_core_unrounded.csv"
+  "/root/repo/resources/e_coli_core/e_coli_core.hdf5"
+  "/root/repo/resources/e_coli_core/e_coli_core.xml"
+  "/root/repo/resources/e_coli_core/lb_e_coli_core.csv"
+  "/root/repo/resources/e_coli_core/p_shift_e_coli_core_rounded.csv"
+  "/root/repo/resources/e_coli_core/p_shift_e_coli_core_unrounded.csv"
+  "/root/repo/resources/e_coli_core/rounded_e_coli_core.hdf5"
+  "/root/repo/resources/e_coli_core/start_e_coli_core_rounded.csv"
+  "/root/repo/resources/e_coli_core/start_e_coli_core_unrounded.csv"
+  "/root/repo/resources/e_coli_core/ub_e_coli_core.csv"
+  "/root/repo/resources/hdf5/CMakeLists.txt"
+  "/root/repo/resources/hdf5/test_data.hdf5"
+  "/root/repo/resources/test_states/CMakeLists.txt"
+  "/root/repo/resources/test_states/chain0_states.csv"
+  "/root/repo/resources/test_states/chain1_states.csv"
+  "/root/repo/resources/test_states/chain2_states.csv"
+  "/root/repo/resources/test_states/chain3_states.csv"
+  "/root/repo/resources/test_states/states0.csv"
+  "/root/repo/resources/test_states/states1.csv"
+  "/root/repo/resources/test_states/states2.csv"
+  "/root/repo/resources/test_states/states3.csv"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/hops/CMakeLists.txt"
+  "/root/repo/src/hops/FileReader/CMakeLists.txt"
+  "/root/repo/src/hops/FileWriter/CMakeLists.txt"
+  "/root/repo/src/hops/LinearProgram/CMakeLists.txt"
+  "/root/repo/src/hops/MarkovChain/CMakeLists.txt"
+  "/root/repo/src/hops/MarkovChain/Draw/CMakeLists.txt"
+  "/root/repo/src/hops/MarkovChain/ParallelTempering/CMakeLists.txt"
+  "/root/repo/src/hops/MarkovChain/Proposal/CMakeLists.txt"
+  "/root/repo/src/hops/MarkovChain/Recorder/CMakeLists.txt"
+  "/root/repo/src/hops/MarkovChain/Tuning/CMakeLists.txt"
+  "/root/repo/src/hops/Model/CMakeLists.txt"
+  "/root/repo/src/hops/NestedSampling/CMakeLists.txt"
+  "/root/repo/src/hops/Optimization/CMakeLists.txt"
+  "/root/repo/src/hops/Parallel/CMakeLists.txt"
+  "/root/repo/src/hops/Polytope/CMakeLists.txt"
+  "/root/repo/src/hops/RandomNumberGenerator/CMakeLists.txt"
+  "/root/repo/src/hops/SequentialMonteCarlo/CMakeLists.txt"
+  "/root/repo/src/hops/Statistics/CMakeLists.txt"
+  "/root/repo/src/hops/Transformation/CMakeLists.txt"
+  "/root/repo/src/hops/Utility/CMakeLists.txt"
+  "/root/repo/src/hops/extern/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/FileReader/CMakeLists.txt"
+  "/root/repo/tests/FileWriter/CMakeLists.txt"
+  "/root/repo/tests/LinearProgram/CMakeLists.txt"
+  "/root/repo/tests/MarkovChain/CMakeLists.txt"
+  "/root/repo/tests/MarkovChain/ParallelTempering/CMakeLists.txt"
+  "/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt"
+  "/root/repo/tests/MarkovChain/Recorder/CMakeLists.txt"
+  "/root/repo/tests/MarkovChain/Tuning/CMakeLists.txt"
+  "/root/repo/tests/Model/CMakeLists.txt"
+  "/root/repo/tests/NestedSampling/CMakeLists.txt"
+  "/root/repo/tests/Optimization/CMakeLists.txt"
+  "/root/repo/tests/Parallel/CMakeLists.txt"
+  "/root/repo/tests/Polytope/CMakeLists.txt"
+  "/root/repo/tests/RandomNumberGenerator/CMakeLists.txt"
+  "/root/repo/tests/SequentialMonteCarlo/CMakeLists.txt"
+  "/root/repo/tests/Statistics/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePushCheckState.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBZip2.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindMPI.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "Doxyfile"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/hops/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/hops/extern/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/hops/Statistics/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/hops/FileReader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/hops/FileWriter/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/hops/LinearProgram/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/hops/MarkovChain/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/hops/MarkovChain/Draw/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/hops/MarkovChain/ParallelTempering/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/hops/MarkovChain/Proposal/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/hops/MarkovChain/Recorder/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/hops/MarkovChain/Tuning/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/hops/Model/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/hops/NestedSampling/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/hops/Optimization/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/hops/Polytope/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/hops/Parallel/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/hops/RandomNumberGenerator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/hops/SequentialMonteCarlo/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/hops/Transformation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/hops/Utility/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/FileReader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/FileWriter/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/LinearProgram/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/MarkovChain/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/MarkovChain/ParallelTempering/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/MarkovChain/Proposal/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/MarkovChain/Recorder/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/MarkovChain/Tuning/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/Model/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/NestedSampling/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/Optimization/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/Parallel/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/Polytope/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/RandomNumberGenerator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/SequentialMonteCarlo/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/Statistics/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "resources/A_small.csv"
+  "resources/A_small_with_column_and_row_names.csv"
+  "resources/b_small.csv"
+  "resources/b_small_with_row_names.csv"
+  "resources/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "resources/test_states/states0.csv"
+  "resources/test_states/states1.csv"
+  "resources/test_states/states2.csv"
+  "resources/test_states/states3.csv"
+  "resources/test_states/chain0_states.csv"
+  "resources/test_states/chain1_states.csv"
+  "resources/test_states/chain2_states.csv"
+  "resources/test_states/chain3_states.csv"
+  "resources/test_states/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "resources/e_coli_core/A_e_coli_core_rounded.csv"
+  "resources/e_coli_core/A_e_coli_core_unrounded.csv"
+  "resources/e_coli_core/b_e_coli_core_rounded.csv"
+  "resources/e_coli_core/b_e_coli_core_unrounded.csv"
+  "resources/e_coli_core/N_e_coli_core_rounded.csv"
+  "resources/e_coli_core/N_e_coli_core_unrounded.csv"
+  "resources/e_coli_core/p_shift_e_coli_core_rounded.csv"
+  "resources/e_coli_core/p_shift_e_coli_core_unrounded.csv"
+  "resources/e_coli_core/start_e_coli_core_rounded.csv"
+  "resources/e_coli_core/start_e_coli_core_unrounded.csv"
+  "resources/e_coli_core/T_e_coli_core_rounded.csv"
+  "resources/e_coli_core/e_coli_core.xml"
+  "resources/e_coli_core/S_e_coli_core.csv"
+  "resources/e_coli_core/lb_e_coli_core.csv"
+  "resources/e_coli_core/ub_e_coli_core.csv"
+  "resources/e_coli_core/rounded_e_coli_core.hdf5"
+  "resources/e_coli_core/e_coli_core.hdf5"
+  "resources/e_coli_core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "resources/hdf5/test_data.hdf5"
+  "resources/hdf5/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/hops.dir/DependInfo.cmake"
+  "CMakeFiles/docs.dir/DependInfo.cmake"
+  "tests/FileReader/CMakeFiles/CsvReaderTestSuite.dir/DependInfo.cmake"
+  "tests/FileWriter/CMakeFiles/CsvWriterImplTestSuite.dir/DependInfo.cmake"
+  "tests/LinearProgram/CMakeFiles/LinearProgramFactoryTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/CMakeFiles/AdaptiveRoundingTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/CMakeFiles/DelayedAcceptanceModelMixinTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/CMakeFiles/LockstepMetropolisHastingsEnsembleTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/CMakeFiles/MarkovChainAdapterTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/CMakeFiles/MarkovChainFactoryTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/CMakeFiles/ModelMixinTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/CMakeFiles/ModelWrapperTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/CMakeFiles/SpeculativeMetropolisHastingsFilterTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/ParallelTempering/CMakeFiles/ParallelTemperingTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Proposal/CMakeFiles/BilliardMALATestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Proposal/CMakeFiles/BilliardWalkTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Proposal/CMakeFiles/ChordStepDistributionsTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Proposal/CMakeFiles/CSmMALATestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Proposal/CMakeFiles/CoordinateHitAndRunTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Proposal/CMakeFiles/DikinEllipsoidCalculatorTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Proposal/CMakeFiles/DikinTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Proposal/CMakeFiles/HitAndRunTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Proposal/CMakeFiles/IsSetStepSizeAvailableTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Proposal/CMakeFiles/JohnTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Proposal/CMakeFiles/ReflectorTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Proposal/CMakeFiles/TrunatedGaussianProposalTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Proposal/CMakeFiles/TrunatedNormalTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Proposal/CMakeFiles/VaidyaTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Proposal/CMakeFiles/ReversibleJumpProposalTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Proposal/CMakeFiles/HotPathAllocationTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Recorder/CMakeFiles/IsAddMessageAvailableTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Recorder/CMakeFiles/IsClearRecordsAvailableTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Recorder/CMakeFiles/IsStoreRecordAvailableTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Recorder/CMakeFiles/IsWriteRecordsToFileAvailableTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Tuning/CMakeFiles/AcceptanceRateTunerTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Tuning/CMakeFiles/BinarySearchAcceptanceRateTunerTestSuite.dir/DependInfo.cmake"
+  "tests/MarkovChain/Tuning/CMakeFiles/ExpectedSquaredJumpDistanceTunerTestSuite.dir/DependInfo.cmake"
+  "tests/Model/CMakeFiles/DegenerateMultivariateGaussianTestSuite.dir/DependInfo.cmake"
+  "tests/Model/CMakeFiles/MixtureTestSuite.dir/DependInfo.cmake"
+  "tests/Model/CMakeFiles/GaussianTestSuite.dir/DependInfo.cmake"
+  "tests/Model/CMakeFiles/RosenbrockTestSuite.dir/DependInfo.cmake"
+  "tests/NestedSampling/CMakeFiles/DiffusiveNestedSamplingTestSuite.dir/DependInfo.cmake"
+  "tests/NestedSampling/CMakeFiles/LogLikelihoodValueTestSuite.dir/DependInfo.cmake"
+  "tests/NestedSampling/CMakeFiles/StaticNestedSamplingTestSuite.dir/DependInfo.cmake"
+  "tests/Optimization/CMakeFiles/GaussianProcessTestSuite.dir/DependInfo.cmake"
+  "tests/Optimization/CMakeFiles/ThompsonSamplingTestSuite.dir/DependInfo.cmake"
+  "tests/Parallel/CMakeFiles/MultiChainRunnerTestSuite.dir/DependInfo.cmake"
+  "tests/Parallel/CMakeFiles/PooledWarmUpTestSuite.dir/DependInfo.cmake"
+  "tests/Parallel/CMakeFiles/ThreadPoolTestSuite.dir/DependInfo.cmake"
+  "tests/Parallel/CMakeFiles/MpiMultiChainRunnerTestSuite.dir/DependInfo.cmake"
+  "tests/Polytope/CMakeFiles/MaximumVolumeEllipsoidTestSuite.dir/DependInfo.cmake"
+  "tests/Polytope/CMakeFiles/NormalizePolytopeTestSuite.dir/DependInfo.cmake"
+  "tests/Polytope/CMakeFiles/SimplexFactoryTestSuite.dir/DependInfo.cmake"
+  "tests/RandomNumberGenerator/CMakeFiles/RandomNumberGeneratorTest.dir/DependInfo.cmake"
+  "tests/SequentialMonteCarlo/CMakeFiles/SequentialMonteCarloTestSuite.dir/DependInfo.cmake"
+  "tests/Statistics/CMakeFiles/CovarianceTestSuite.dir/DependInfo.cmake"
+  "tests/Statistics/CMakeFiles/ExpectedSquaredJumpDistanceTestSuite.dir/DependInfo.cmake"
+  )
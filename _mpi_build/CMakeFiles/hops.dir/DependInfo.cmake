@@ -0,0 +1,47 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/hops/FileReader/CsvReader.cpp" "CMakeFiles/hops.dir/src/hops/FileReader/CsvReader.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/FileReader/CsvReader.cpp.o.d"
+  "/root/repo/src/hops/FileWriter/CsvWriter.cpp" "CMakeFiles/hops.dir/src/hops/FileWriter/CsvWriter.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/FileWriter/CsvWriter.cpp.o.d"
+  "/root/repo/src/hops/FileWriter/CsvWriterImpl.cpp" "CMakeFiles/hops.dir/src/hops/FileWriter/CsvWriterImpl.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/FileWriter/CsvWriterImpl.cpp.o.d"
+  "/root/repo/src/hops/FileWriter/FileWriterFactory.cpp" "CMakeFiles/hops.dir/src/hops/FileWriter/FileWriterFactory.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/FileWriter/FileWriterFactory.cpp.o.d"
+  "/root/repo/src/hops/MarkovChain/MarkovChainType.cpp" "CMakeFiles/hops.dir/src/hops/MarkovChain/MarkovChainType.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/MarkovChain/MarkovChainType.cpp.o.d"
+  "/root/repo/src/hops/MarkovChain/Proposal/ReversibleJumpProposal.cpp" "CMakeFiles/hops.dir/src/hops/MarkovChain/Proposal/ReversibleJumpProposal.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/MarkovChain/Proposal/ReversibleJumpProposal.cpp.o.d"
+  "/root/repo/src/hops/MarkovChain/Tuning/AcceptanceRateTarget.cpp" "CMakeFiles/hops.dir/src/hops/MarkovChain/Tuning/AcceptanceRateTarget.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/MarkovChain/Tuning/AcceptanceRateTarget.cpp.o.d"
+  "/root/repo/src/hops/MarkovChain/Tuning/AcceptanceRateTuner.cpp" "CMakeFiles/hops.dir/src/hops/MarkovChain/Tuning/AcceptanceRateTuner.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/MarkovChain/Tuning/AcceptanceRateTuner.cpp.o.d"
+  "/root/repo/src/hops/MarkovChain/Tuning/BinarySearchAcceptanceRateTuner.cpp" "CMakeFiles/hops.dir/src/hops/MarkovChain/Tuning/BinarySearchAcceptanceRateTuner.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/MarkovChain/Tuning/BinarySearchAcceptanceRateTuner.cpp.o.d"
+  "/root/repo/src/hops/MarkovChain/Tuning/ExpectedSquaredJumpDistanceTuner.cpp" "CMakeFiles/hops.dir/src/hops/MarkovChain/Tuning/ExpectedSquaredJumpDistanceTuner.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/MarkovChain/Tuning/ExpectedSquaredJumpDistanceTuner.cpp.o.d"
+  "/root/repo/src/hops/MarkovChain/Tuning/ThompsonSamplingTuner.cpp" "CMakeFiles/hops.dir/src/hops/MarkovChain/Tuning/ThompsonSamplingTuner.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/MarkovChain/Tuning/ThompsonSamplingTuner.cpp.o.d"
+  "/root/repo/src/hops/Model/DegenerateGaussian.cpp" "CMakeFiles/hops.dir/src/hops/Model/DegenerateGaussian.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/Model/DegenerateGaussian.cpp.o.d"
+  "/root/repo/src/hops/Model/Gaussian.cpp" "CMakeFiles/hops.dir/src/hops/Model/Gaussian.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/Model/Gaussian.cpp.o.d"
+  "/root/repo/src/hops/Model/JumpableModel.cpp" "CMakeFiles/hops.dir/src/hops/Model/JumpableModel.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/Model/JumpableModel.cpp.o.d"
+  "/root/repo/src/hops/Model/Rosenbrock.cpp" "CMakeFiles/hops.dir/src/hops/Model/Rosenbrock.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/Model/Rosenbrock.cpp.o.d"
+  "/root/repo/src/hops/NestedSampling/DiffusiveNestedSampling.cpp" "CMakeFiles/hops.dir/src/hops/NestedSampling/DiffusiveNestedSampling.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/NestedSampling/DiffusiveNestedSampling.cpp.o.d"
+  "/root/repo/src/hops/NestedSampling/Level.cpp" "CMakeFiles/hops.dir/src/hops/NestedSampling/Level.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/NestedSampling/Level.cpp.o.d"
+  "/root/repo/src/hops/NestedSampling/LogLikelihoodValue.cpp" "CMakeFiles/hops.dir/src/hops/NestedSampling/LogLikelihoodValue.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/NestedSampling/LogLikelihoodValue.cpp.o.d"
+  "/root/repo/src/hops/NestedSampling/StaticNestedSampling.cpp" "CMakeFiles/hops.dir/src/hops/NestedSampling/StaticNestedSampling.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/NestedSampling/StaticNestedSampling.cpp.o.d"
+  "/root/repo/src/hops/Parallel/MpiMultiChainRunner.cpp" "CMakeFiles/hops.dir/src/hops/Parallel/MpiMultiChainRunner.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/Parallel/MpiMultiChainRunner.cpp.o.d"
+  "/root/repo/src/hops/Parallel/MultiChainRunner.cpp" "CMakeFiles/hops.dir/src/hops/Parallel/MultiChainRunner.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/Parallel/MultiChainRunner.cpp.o.d"
+  "/root/repo/src/hops/Parallel/PooledWarmUp.cpp" "CMakeFiles/hops.dir/src/hops/Parallel/PooledWarmUp.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/Parallel/PooledWarmUp.cpp.o.d"
+  "/root/repo/src/hops/Parallel/ThreadPool.cpp" "CMakeFiles/hops.dir/src/hops/Parallel/ThreadPool.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/Parallel/ThreadPool.cpp.o.d"
+  "/root/repo/src/hops/Polytope/MaximumVolumeEllipsoid.cpp" "CMakeFiles/hops.dir/src/hops/Polytope/MaximumVolumeEllipsoid.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/Polytope/MaximumVolumeEllipsoid.cpp.o.d"
+  "/root/repo/src/hops/SequentialMonteCarlo/SequentialMonteCarlo.cpp" "CMakeFiles/hops.dir/src/hops/SequentialMonteCarlo/SequentialMonteCarlo.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/SequentialMonteCarlo/SequentialMonteCarlo.cpp.o.d"
+  "/root/repo/src/hops/Utility/DefaultDimensionNames.cpp" "CMakeFiles/hops.dir/src/hops/Utility/DefaultDimensionNames.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/Utility/DefaultDimensionNames.cpp.o.d"
+  "/root/repo/src/hops/Utility/KahanSum.cpp" "CMakeFiles/hops.dir/src/hops/Utility/KahanSum.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/Utility/KahanSum.cpp.o.d"
+  "/root/repo/src/hops/Utility/Sampling.cpp" "CMakeFiles/hops.dir/src/hops/Utility/Sampling.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/Utility/Sampling.cpp.o.d"
+  "/root/repo/src/hops/Utility/StringUtility.cpp" "CMakeFiles/hops.dir/src/hops/Utility/StringUtility.cpp.o" "gcc" "CMakeFiles/hops.dir/src/hops/Utility/StringUtility.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
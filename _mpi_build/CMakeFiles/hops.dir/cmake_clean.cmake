@@ -0,0 +1,67 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hops.dir/src/hops/FileReader/CsvReader.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/FileReader/CsvReader.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/FileWriter/CsvWriter.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/FileWriter/CsvWriter.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/FileWriter/CsvWriterImpl.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/FileWriter/CsvWriterImpl.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/FileWriter/FileWriterFactory.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/FileWriter/FileWriterFactory.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/MarkovChain/MarkovChainType.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/MarkovChain/MarkovChainType.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/MarkovChain/Proposal/ReversibleJumpProposal.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/MarkovChain/Proposal/ReversibleJumpProposal.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/MarkovChain/Tuning/AcceptanceRateTarget.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/MarkovChain/Tuning/AcceptanceRateTarget.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/MarkovChain/Tuning/AcceptanceRateTuner.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/MarkovChain/Tuning/AcceptanceRateTuner.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/MarkovChain/Tuning/BinarySearchAcceptanceRateTuner.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/MarkovChain/Tuning/BinarySearchAcceptanceRateTuner.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/MarkovChain/Tuning/ExpectedSquaredJumpDistanceTuner.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/MarkovChain/Tuning/ExpectedSquaredJumpDistanceTuner.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/MarkovChain/Tuning/ThompsonSamplingTuner.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/MarkovChain/Tuning/ThompsonSamplingTuner.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/Model/DegenerateGaussian.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/Model/DegenerateGaussian.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/Model/Gaussian.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/Model/Gaussian.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/Model/JumpableModel.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/Model/JumpableModel.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/Model/Rosenbrock.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/Model/Rosenbrock.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/NestedSampling/DiffusiveNestedSampling.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/NestedSampling/DiffusiveNestedSampling.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/NestedSampling/Level.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/NestedSampling/Level.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/NestedSampling/LogLikelihoodValue.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/NestedSampling/LogLikelihoodValue.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/NestedSampling/StaticNestedSampling.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/NestedSampling/StaticNestedSampling.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/Parallel/MpiMultiChainRunner.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/Parallel/MpiMultiChainRunner.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/Parallel/MultiChainRunner.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/Parallel/MultiChainRunner.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/Parallel/PooledWarmUp.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/Parallel/PooledWarmUp.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/Parallel/ThreadPool.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/Parallel/ThreadPool.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/Polytope/MaximumVolumeEllipsoid.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/Polytope/MaximumVolumeEllipsoid.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/SequentialMonteCarlo/SequentialMonteCarlo.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/SequentialMonteCarlo/SequentialMonteCarlo.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/Utility/DefaultDimensionNames.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/Utility/DefaultDimensionNames.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/Utility/KahanSum.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/Utility/KahanSum.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/Utility/Sampling.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/Utility/Sampling.cpp.o.d"
+  "CMakeFiles/hops.dir/src/hops/Utility/StringUtility.cpp.o"
+  "CMakeFiles/hops.dir/src/hops/Utility/StringUtility.cpp.o.d"
+  "libhops.pdb"
+  "libhops.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hops.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/resources
+# Build directory: /root/repo/_mpi_build/resources
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("test_states")
+subdirs("e_coli_core")
+subdirs("hdf5")
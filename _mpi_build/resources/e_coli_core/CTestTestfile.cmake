@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/resources/e_coli_core
+# Build directory: /root/repo/_mpi_build/resources/e_coli_core
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/resources/test_states
+# Build directory: /root/repo/_mpi_build/resources/test_states
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
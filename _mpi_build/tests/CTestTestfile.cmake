@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_mpi_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("FileReader")
+subdirs("FileWriter")
+subdirs("LinearProgram")
+subdirs("MarkovChain")
+subdirs("Model")
+subdirs("NestedSampling")
+subdirs("Optimization")
+subdirs("Parallel")
+subdirs("Polytope")
+subdirs("RandomNumberGenerator")
+subdirs("SequentialMonteCarlo")
+subdirs("Statistics")
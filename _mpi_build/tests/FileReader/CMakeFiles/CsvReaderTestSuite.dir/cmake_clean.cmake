@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CsvReaderTestSuite.dir/CsvReaderTestSuite.cpp.o"
+  "CMakeFiles/CsvReaderTestSuite.dir/CsvReaderTestSuite.cpp.o.d"
+  "CsvReaderTestSuite"
+  "CsvReaderTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CsvReaderTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/FileReader
+# Build directory: /root/repo/_mpi_build/tests/FileReader
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(CsvReaderTestSuite "/root/repo/_mpi_build/tests/FileReader/CsvReaderTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/CsvReaderTestSuite.xml")
+set_tests_properties(CsvReaderTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/FileReader" _BACKTRACE_TRIPLES "/root/repo/tests/FileReader/CMakeLists.txt;9;add_test;/root/repo/tests/FileReader/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CsvWriterImplTestSuite.dir/CsvWriterImplTestSuite.cpp.o"
+  "CMakeFiles/CsvWriterImplTestSuite.dir/CsvWriterImplTestSuite.cpp.o.d"
+  "CsvWriterImplTestSuite"
+  "CsvWriterImplTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CsvWriterImplTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/FileWriter
+# Build directory: /root/repo/_mpi_build/tests/FileWriter
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(CsvWriterImplTestSuite "/root/repo/_mpi_build/tests/FileWriter/CsvWriterImplTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/CsvWriterImplTestSuite.xml")
+set_tests_properties(CsvWriterImplTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/FileWriter" _BACKTRACE_TRIPLES "/root/repo/tests/FileWriter/CMakeLists.txt;9;add_test;/root/repo/tests/FileWriter/CMakeLists.txt;0;")
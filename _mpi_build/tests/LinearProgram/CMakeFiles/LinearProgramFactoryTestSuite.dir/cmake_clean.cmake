@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/LinearProgramFactoryTestSuite.dir/LinearProgramFactoryTestSuite.cpp.o"
+  "CMakeFiles/LinearProgramFactoryTestSuite.dir/LinearProgramFactoryTestSuite.cpp.o.d"
+  "LinearProgramFactoryTestSuite"
+  "LinearProgramFactoryTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/LinearProgramFactoryTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
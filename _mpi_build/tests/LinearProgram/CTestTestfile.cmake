@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/LinearProgram
+# Build directory: /root/repo/_mpi_build/tests/LinearProgram
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(LinearProgramFactoryTestSuite "/root/repo/_mpi_build/tests/LinearProgram/LinearProgramFactoryTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/LinearProgramFactoryTestSuite.xml")
+set_tests_properties(LinearProgramFactoryTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/LinearProgram" _BACKTRACE_TRIPLES "/root/repo/tests/LinearProgram/CMakeLists.txt;23;add_test;/root/repo/tests/LinearProgram/CMakeLists.txt;0;")
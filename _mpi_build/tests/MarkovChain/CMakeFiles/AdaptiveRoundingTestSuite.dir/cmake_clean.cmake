@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "AdaptiveRoundingTestSuite"
+  "AdaptiveRoundingTestSuite.pdb"
+  "CMakeFiles/AdaptiveRoundingTestSuite.dir/AdaptiveRoundingTestSuite.cpp.o"
+  "CMakeFiles/AdaptiveRoundingTestSuite.dir/AdaptiveRoundingTestSuite.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AdaptiveRoundingTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
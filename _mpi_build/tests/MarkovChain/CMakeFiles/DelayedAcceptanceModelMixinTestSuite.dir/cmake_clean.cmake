@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DelayedAcceptanceModelMixinTestSuite.dir/DelayedAcceptanceModelMixinTestSuite.cpp.o"
+  "CMakeFiles/DelayedAcceptanceModelMixinTestSuite.dir/DelayedAcceptanceModelMixinTestSuite.cpp.o.d"
+  "DelayedAcceptanceModelMixinTestSuite"
+  "DelayedAcceptanceModelMixinTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DelayedAcceptanceModelMixinTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/LockstepMetropolisHastingsEnsembleTestSuite.dir/LockstepMetropolisHastingsEnsembleTestSuite.cpp.o"
+  "CMakeFiles/LockstepMetropolisHastingsEnsembleTestSuite.dir/LockstepMetropolisHastingsEnsembleTestSuite.cpp.o.d"
+  "LockstepMetropolisHastingsEnsembleTestSuite"
+  "LockstepMetropolisHastingsEnsembleTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/LockstepMetropolisHastingsEnsembleTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
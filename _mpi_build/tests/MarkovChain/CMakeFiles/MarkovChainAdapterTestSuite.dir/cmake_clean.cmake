@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MarkovChainAdapterTestSuite.dir/MarkovChainAdapterTestSuite.cpp.o"
+  "CMakeFiles/MarkovChainAdapterTestSuite.dir/MarkovChainAdapterTestSuite.cpp.o.d"
+  "MarkovChainAdapterTestSuite"
+  "MarkovChainAdapterTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MarkovChainAdapterTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MarkovChainFactoryTestSuite.dir/MarkovChainFactoryTestSuite.cpp.o"
+  "CMakeFiles/MarkovChainFactoryTestSuite.dir/MarkovChainFactoryTestSuite.cpp.o.d"
+  "MarkovChainFactoryTestSuite"
+  "MarkovChainFactoryTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MarkovChainFactoryTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
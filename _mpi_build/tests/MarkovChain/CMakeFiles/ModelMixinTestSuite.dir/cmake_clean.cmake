@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ModelMixinTestSuite.dir/ModelMixinTestSuite.cpp.o"
+  "CMakeFiles/ModelMixinTestSuite.dir/ModelMixinTestSuite.cpp.o.d"
+  "ModelMixinTestSuite"
+  "ModelMixinTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ModelMixinTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
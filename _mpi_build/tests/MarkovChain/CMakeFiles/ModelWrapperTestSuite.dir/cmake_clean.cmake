@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ModelWrapperTestSuite.dir/ModelWrapperTestSuite.cpp.o"
+  "CMakeFiles/ModelWrapperTestSuite.dir/ModelWrapperTestSuite.cpp.o.d"
+  "ModelWrapperTestSuite"
+  "ModelWrapperTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ModelWrapperTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SpeculativeMetropolisHastingsFilterTestSuite.dir/SpeculativeMetropolisHastingsFilterTestSuite.cpp.o"
+  "CMakeFiles/SpeculativeMetropolisHastingsFilterTestSuite.dir/SpeculativeMetropolisHastingsFilterTestSuite.cpp.o.d"
+  "SpeculativeMetropolisHastingsFilterTestSuite"
+  "SpeculativeMetropolisHastingsFilterTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SpeculativeMetropolisHastingsFilterTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
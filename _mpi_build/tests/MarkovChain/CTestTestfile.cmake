@@ -0,0 +1,26 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/MarkovChain
+# Build directory: /root/repo/_mpi_build/tests/MarkovChain
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(AdaptiveRoundingTestSuite "/root/repo/_mpi_build/tests/MarkovChain/AdaptiveRoundingTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/AdaptiveRoundingTestSuite.xml")
+set_tests_properties(AdaptiveRoundingTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/CMakeLists.txt;22;add_test;/root/repo/tests/MarkovChain/CMakeLists.txt;0;")
+add_test(DelayedAcceptanceModelMixinTestSuite "/root/repo/_mpi_build/tests/MarkovChain/DelayedAcceptanceModelMixinTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/DelayedAcceptanceModelMixinTestSuite.xml")
+set_tests_properties(DelayedAcceptanceModelMixinTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/CMakeLists.txt;22;add_test;/root/repo/tests/MarkovChain/CMakeLists.txt;0;")
+add_test(LockstepMetropolisHastingsEnsembleTestSuite "/root/repo/_mpi_build/tests/MarkovChain/LockstepMetropolisHastingsEnsembleTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/LockstepMetropolisHastingsEnsembleTestSuite.xml")
+set_tests_properties(LockstepMetropolisHastingsEnsembleTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/CMakeLists.txt;22;add_test;/root/repo/tests/MarkovChain/CMakeLists.txt;0;")
+add_test(MarkovChainAdapterTestSuite "/root/repo/_mpi_build/tests/MarkovChain/MarkovChainAdapterTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/MarkovChainAdapterTestSuite.xml")
+set_tests_properties(MarkovChainAdapterTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/CMakeLists.txt;22;add_test;/root/repo/tests/MarkovChain/CMakeLists.txt;0;")
+add_test(MarkovChainFactoryTestSuite "/root/repo/_mpi_build/tests/MarkovChain/MarkovChainFactoryTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/MarkovChainFactoryTestSuite.xml")
+set_tests_properties(MarkovChainFactoryTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/CMakeLists.txt;22;add_test;/root/repo/tests/MarkovChain/CMakeLists.txt;0;")
+add_test(ModelMixinTestSuite "/root/repo/_mpi_build/tests/MarkovChain/ModelMixinTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/ModelMixinTestSuite.xml")
+set_tests_properties(ModelMixinTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/CMakeLists.txt;22;add_test;/root/repo/tests/MarkovChain/CMakeLists.txt;0;")
+add_test(ModelWrapperTestSuite "/root/repo/_mpi_build/tests/MarkovChain/ModelWrapperTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/ModelWrapperTestSuite.xml")
+set_tests_properties(ModelWrapperTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/CMakeLists.txt;22;add_test;/root/repo/tests/MarkovChain/CMakeLists.txt;0;")
+add_test(SpeculativeMetropolisHastingsFilterTestSuite "/root/repo/_mpi_build/tests/MarkovChain/SpeculativeMetropolisHastingsFilterTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/SpeculativeMetropolisHastingsFilterTestSuite.xml")
+set_tests_properties(SpeculativeMetropolisHastingsFilterTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/CMakeLists.txt;22;add_test;/root/repo/tests/MarkovChain/CMakeLists.txt;0;")
+subdirs("ParallelTempering")
+subdirs("Proposal")
+subdirs("Recorder")
+subdirs("Tuning")
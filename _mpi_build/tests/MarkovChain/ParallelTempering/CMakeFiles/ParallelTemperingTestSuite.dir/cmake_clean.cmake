@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ParallelTemperingTestSuite.dir/ParallelTemperingTestSuite.cpp.o"
+  "CMakeFiles/ParallelTemperingTestSuite.dir/ParallelTemperingTestSuite.cpp.o.d"
+  "ParallelTemperingTestSuite"
+  "ParallelTemperingTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ParallelTemperingTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
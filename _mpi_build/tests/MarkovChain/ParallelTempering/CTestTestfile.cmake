@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/MarkovChain/ParallelTempering
+# Build directory: /root/repo/_mpi_build/tests/MarkovChain/ParallelTempering
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ParallelTemperingTestSuite "/usr/bin/mpiexec" "--oversubscribe" "-n" "3" "/root/repo/_mpi_build/tests/MarkovChain/ParallelTempering/ParallelTemperingTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/test-reports/.xml")
+set_tests_properties(ParallelTemperingTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/ParallelTempering" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/ParallelTempering/CMakeLists.txt;10;add_test;/root/repo/tests/MarkovChain/ParallelTempering/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BilliardMALATestSuite"
+  "BilliardMALATestSuite.pdb"
+  "CMakeFiles/BilliardMALATestSuite.dir/BilliardMALATestSuite.cpp.o"
+  "CMakeFiles/BilliardMALATestSuite.dir/BilliardMALATestSuite.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BilliardMALATestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BilliardWalkTestSuite"
+  "BilliardWalkTestSuite.pdb"
+  "CMakeFiles/BilliardWalkTestSuite.dir/BilliardWalkTestSuite.cpp.o"
+  "CMakeFiles/BilliardWalkTestSuite.dir/BilliardWalkTestSuite.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BilliardWalkTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
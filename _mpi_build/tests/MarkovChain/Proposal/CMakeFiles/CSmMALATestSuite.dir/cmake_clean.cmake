@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CSmMALATestSuite.dir/CSmMALATestSuite.cpp.o"
+  "CMakeFiles/CSmMALATestSuite.dir/CSmMALATestSuite.cpp.o.d"
+  "CSmMALATestSuite"
+  "CSmMALATestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CSmMALATestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
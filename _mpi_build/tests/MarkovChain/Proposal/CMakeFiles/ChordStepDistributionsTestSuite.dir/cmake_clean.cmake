@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ChordStepDistributionsTestSuite.dir/ChordStepDistributionsTestSuite.cpp.o"
+  "CMakeFiles/ChordStepDistributionsTestSuite.dir/ChordStepDistributionsTestSuite.cpp.o.d"
+  "ChordStepDistributionsTestSuite"
+  "ChordStepDistributionsTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ChordStepDistributionsTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CoordinateHitAndRunTestSuite.dir/CoordinateHitAndRunTestSuite.cpp.o"
+  "CMakeFiles/CoordinateHitAndRunTestSuite.dir/CoordinateHitAndRunTestSuite.cpp.o.d"
+  "CoordinateHitAndRunTestSuite"
+  "CoordinateHitAndRunTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CoordinateHitAndRunTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DikinEllipsoidCalculatorTestSuite.dir/DikinEllipsoidCalculatorTestSuite.cpp.o"
+  "CMakeFiles/DikinEllipsoidCalculatorTestSuite.dir/DikinEllipsoidCalculatorTestSuite.cpp.o.d"
+  "DikinEllipsoidCalculatorTestSuite"
+  "DikinEllipsoidCalculatorTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DikinEllipsoidCalculatorTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DikinTestSuite.dir/DikinTestSuite.cpp.o"
+  "CMakeFiles/DikinTestSuite.dir/DikinTestSuite.cpp.o.d"
+  "DikinTestSuite"
+  "DikinTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DikinTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HitAndRunTestSuite.dir/HitAndRunTestSuite.cpp.o"
+  "CMakeFiles/HitAndRunTestSuite.dir/HitAndRunTestSuite.cpp.o.d"
+  "HitAndRunTestSuite"
+  "HitAndRunTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HitAndRunTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
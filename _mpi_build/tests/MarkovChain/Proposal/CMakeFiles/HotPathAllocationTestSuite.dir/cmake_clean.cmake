@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HotPathAllocationTestSuite.dir/HotPathAllocationTestSuite.cpp.o"
+  "CMakeFiles/HotPathAllocationTestSuite.dir/HotPathAllocationTestSuite.cpp.o.d"
+  "HotPathAllocationTestSuite"
+  "HotPathAllocationTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HotPathAllocationTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
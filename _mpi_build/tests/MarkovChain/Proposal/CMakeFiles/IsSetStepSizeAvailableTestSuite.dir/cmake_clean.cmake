@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/IsSetStepSizeAvailableTestSuite.dir/IsSetStepSizeAvailableTestSuite.cpp.o"
+  "CMakeFiles/IsSetStepSizeAvailableTestSuite.dir/IsSetStepSizeAvailableTestSuite.cpp.o.d"
+  "IsSetStepSizeAvailableTestSuite"
+  "IsSetStepSizeAvailableTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/IsSetStepSizeAvailableTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/JohnTestSuite.dir/JohnTestSuite.cpp.o"
+  "CMakeFiles/JohnTestSuite.dir/JohnTestSuite.cpp.o.d"
+  "JohnTestSuite"
+  "JohnTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/JohnTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ReflectorTestSuite.dir/ReflectorTestSuite.cpp.o"
+  "CMakeFiles/ReflectorTestSuite.dir/ReflectorTestSuite.cpp.o.d"
+  "ReflectorTestSuite"
+  "ReflectorTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ReflectorTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
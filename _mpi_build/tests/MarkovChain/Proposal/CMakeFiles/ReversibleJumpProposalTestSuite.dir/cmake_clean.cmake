@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ReversibleJumpProposalTestSuite.dir/ReversibleJumpProposalTestSuite.cpp.o"
+  "CMakeFiles/ReversibleJumpProposalTestSuite.dir/ReversibleJumpProposalTestSuite.cpp.o.d"
+  "ReversibleJumpProposalTestSuite"
+  "ReversibleJumpProposalTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ReversibleJumpProposalTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TrunatedGaussianProposalTestSuite.dir/TrunatedGaussianProposalTestSuite.cpp.o"
+  "CMakeFiles/TrunatedGaussianProposalTestSuite.dir/TrunatedGaussianProposalTestSuite.cpp.o.d"
+  "TrunatedGaussianProposalTestSuite"
+  "TrunatedGaussianProposalTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TrunatedGaussianProposalTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TrunatedNormalTestSuite.dir/TrunatedNormalTestSuite.cpp.o"
+  "CMakeFiles/TrunatedNormalTestSuite.dir/TrunatedNormalTestSuite.cpp.o.d"
+  "TrunatedNormalTestSuite"
+  "TrunatedNormalTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/TrunatedNormalTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/VaidyaTestSuite.dir/VaidyaTestSuite.cpp.o"
+  "CMakeFiles/VaidyaTestSuite.dir/VaidyaTestSuite.cpp.o.d"
+  "VaidyaTestSuite"
+  "VaidyaTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/VaidyaTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
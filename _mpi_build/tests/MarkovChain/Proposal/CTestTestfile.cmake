@@ -0,0 +1,38 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/MarkovChain/Proposal
+# Build directory: /root/repo/_mpi_build/tests/MarkovChain/Proposal
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(BilliardMALATestSuite "/root/repo/_mpi_build/tests/MarkovChain/Proposal/BilliardMALATestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/BilliardMALATestSuite.xml")
+set_tests_properties(BilliardMALATestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Proposal" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;30;add_test;/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;0;")
+add_test(BilliardWalkTestSuite "/root/repo/_mpi_build/tests/MarkovChain/Proposal/BilliardWalkTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/BilliardWalkTestSuite.xml")
+set_tests_properties(BilliardWalkTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Proposal" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;30;add_test;/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;0;")
+add_test(ChordStepDistributionsTestSuite "/root/repo/_mpi_build/tests/MarkovChain/Proposal/ChordStepDistributionsTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/ChordStepDistributionsTestSuite.xml")
+set_tests_properties(ChordStepDistributionsTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Proposal" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;30;add_test;/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;0;")
+add_test(CSmMALATestSuite "/root/repo/_mpi_build/tests/MarkovChain/Proposal/CSmMALATestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/CSmMALATestSuite.xml")
+set_tests_properties(CSmMALATestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Proposal" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;30;add_test;/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;0;")
+add_test(CoordinateHitAndRunTestSuite "/root/repo/_mpi_build/tests/MarkovChain/Proposal/CoordinateHitAndRunTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/CoordinateHitAndRunTestSuite.xml")
+set_tests_properties(CoordinateHitAndRunTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Proposal" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;30;add_test;/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;0;")
+add_test(DikinEllipsoidCalculatorTestSuite "/root/repo/_mpi_build/tests/MarkovChain/Proposal/DikinEllipsoidCalculatorTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/DikinEllipsoidCalculatorTestSuite.xml")
+set_tests_properties(DikinEllipsoidCalculatorTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Proposal" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;30;add_test;/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;0;")
+add_test(DikinTestSuite "/root/repo/_mpi_build/tests/MarkovChain/Proposal/DikinTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/DikinTestSuite.xml")
+set_tests_properties(DikinTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Proposal" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;30;add_test;/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;0;")
+add_test(HitAndRunTestSuite "/root/repo/_mpi_build/tests/MarkovChain/Proposal/HitAndRunTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/HitAndRunTestSuite.xml")
+set_tests_properties(HitAndRunTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Proposal" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;30;add_test;/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;0;")
+add_test(IsSetStepSizeAvailableTestSuite "/root/repo/_mpi_build/tests/MarkovChain/Proposal/IsSetStepSizeAvailableTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/IsSetStepSizeAvailableTestSuite.xml")
+set_tests_properties(IsSetStepSizeAvailableTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Proposal" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;30;add_test;/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;0;")
+add_test(JohnTestSuite "/root/repo/_mpi_build/tests/MarkovChain/Proposal/JohnTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/JohnTestSuite.xml")
+set_tests_properties(JohnTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Proposal" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;30;add_test;/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;0;")
+add_test(ReflectorTestSuite "/root/repo/_mpi_build/tests/MarkovChain/Proposal/ReflectorTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/ReflectorTestSuite.xml")
+set_tests_properties(ReflectorTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Proposal" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;30;add_test;/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;0;")
+add_test(TrunatedGaussianProposalTestSuite "/root/repo/_mpi_build/tests/MarkovChain/Proposal/TrunatedGaussianProposalTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/TrunatedGaussianProposalTestSuite.xml")
+set_tests_properties(TrunatedGaussianProposalTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Proposal" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;30;add_test;/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;0;")
+add_test(TrunatedNormalTestSuite "/root/repo/_mpi_build/tests/MarkovChain/Proposal/TrunatedNormalTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/TrunatedNormalTestSuite.xml")
+set_tests_properties(TrunatedNormalTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Proposal" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;30;add_test;/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;0;")
+add_test(VaidyaTestSuite "/root/repo/_mpi_build/tests/MarkovChain/Proposal/VaidyaTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/VaidyaTestSuite.xml")
+set_tests_properties(VaidyaTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Proposal" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;30;add_test;/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;0;")
+add_test(ReversibleJumpProposalTestSuite "/root/repo/_mpi_build/tests/MarkovChain/Proposal/ReversibleJumpProposalTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/ReversibleJumpProposalTestSuite.xml")
+set_tests_properties(ReversibleJumpProposalTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Proposal" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;30;add_test;/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;0;")
+add_test(HotPathAllocationTestSuite "/root/repo/_mpi_build/tests/MarkovChain/Proposal/HotPathAllocationTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/HotPathAllocationTestSuite.xml")
+set_tests_properties(HotPathAllocationTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Proposal" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;30;add_test;/root/repo/tests/MarkovChain/Proposal/CMakeLists.txt;0;")
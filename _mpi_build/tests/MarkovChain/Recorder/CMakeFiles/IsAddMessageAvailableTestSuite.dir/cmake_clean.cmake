@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/IsAddMessageAvailableTestSuite.dir/IsAddMessageAvailableTestSuite.cpp.o"
+  "CMakeFiles/IsAddMessageAvailableTestSuite.dir/IsAddMessageAvailableTestSuite.cpp.o.d"
+  "IsAddMessageAvailableTestSuite"
+  "IsAddMessageAvailableTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/IsAddMessageAvailableTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/IsClearRecordsAvailableTestSuite.dir/IsClearRecordsAvailableTestSuite.cpp.o"
+  "CMakeFiles/IsClearRecordsAvailableTestSuite.dir/IsClearRecordsAvailableTestSuite.cpp.o.d"
+  "IsClearRecordsAvailableTestSuite"
+  "IsClearRecordsAvailableTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/IsClearRecordsAvailableTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
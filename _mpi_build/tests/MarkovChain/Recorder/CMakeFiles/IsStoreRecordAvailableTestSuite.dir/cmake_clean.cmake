@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/IsStoreRecordAvailableTestSuite.dir/IsStoreRecordAvailableTestSuite.cpp.o"
+  "CMakeFiles/IsStoreRecordAvailableTestSuite.dir/IsStoreRecordAvailableTestSuite.cpp.o.d"
+  "IsStoreRecordAvailableTestSuite"
+  "IsStoreRecordAvailableTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/IsStoreRecordAvailableTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/IsWriteRecordsToFileAvailableTestSuite.dir/IsWriteRecordsToFileAvailableTestSuite.cpp.o"
+  "CMakeFiles/IsWriteRecordsToFileAvailableTestSuite.dir/IsWriteRecordsToFileAvailableTestSuite.cpp.o.d"
+  "IsWriteRecordsToFileAvailableTestSuite"
+  "IsWriteRecordsToFileAvailableTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/IsWriteRecordsToFileAvailableTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
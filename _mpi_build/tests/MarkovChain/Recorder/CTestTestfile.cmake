@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/MarkovChain/Recorder
+# Build directory: /root/repo/_mpi_build/tests/MarkovChain/Recorder
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(IsAddMessageAvailableTestSuite "/root/repo/_mpi_build/tests/MarkovChain/Recorder/IsAddMessageAvailableTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/IsAddMessageAvailableTestSuite.xml")
+set_tests_properties(IsAddMessageAvailableTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Recorder" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Recorder/CMakeLists.txt;13;add_test;/root/repo/tests/MarkovChain/Recorder/CMakeLists.txt;0;")
+add_test(IsClearRecordsAvailableTestSuite "/root/repo/_mpi_build/tests/MarkovChain/Recorder/IsClearRecordsAvailableTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/IsClearRecordsAvailableTestSuite.xml")
+set_tests_properties(IsClearRecordsAvailableTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Recorder" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Recorder/CMakeLists.txt;13;add_test;/root/repo/tests/MarkovChain/Recorder/CMakeLists.txt;0;")
+add_test(IsStoreRecordAvailableTestSuite "/root/repo/_mpi_build/tests/MarkovChain/Recorder/IsStoreRecordAvailableTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/IsStoreRecordAvailableTestSuite.xml")
+set_tests_properties(IsStoreRecordAvailableTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Recorder" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Recorder/CMakeLists.txt;13;add_test;/root/repo/tests/MarkovChain/Recorder/CMakeLists.txt;0;")
+add_test(IsWriteRecordsToFileAvailableTestSuite "/root/repo/_mpi_build/tests/MarkovChain/Recorder/IsWriteRecordsToFileAvailableTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/IsWriteRecordsToFileAvailableTestSuite.xml")
+set_tests_properties(IsWriteRecordsToFileAvailableTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Recorder" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Recorder/CMakeLists.txt;13;add_test;/root/repo/tests/MarkovChain/Recorder/CMakeLists.txt;0;")
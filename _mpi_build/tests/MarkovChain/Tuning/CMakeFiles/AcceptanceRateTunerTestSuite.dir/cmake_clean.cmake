@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "AcceptanceRateTunerTestSuite"
+  "AcceptanceRateTunerTestSuite.pdb"
+  "CMakeFiles/AcceptanceRateTunerTestSuite.dir/AcceptanceRateTunerTestSuite.cpp.o"
+  "CMakeFiles/AcceptanceRateTunerTestSuite.dir/AcceptanceRateTunerTestSuite.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AcceptanceRateTunerTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
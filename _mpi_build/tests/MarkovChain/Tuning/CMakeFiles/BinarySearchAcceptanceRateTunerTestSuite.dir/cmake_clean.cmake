@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BinarySearchAcceptanceRateTunerTestSuite"
+  "BinarySearchAcceptanceRateTunerTestSuite.pdb"
+  "CMakeFiles/BinarySearchAcceptanceRateTunerTestSuite.dir/BinarySearchAcceptanceRateTunerTestSuite.cpp.o"
+  "CMakeFiles/BinarySearchAcceptanceRateTunerTestSuite.dir/BinarySearchAcceptanceRateTunerTestSuite.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/BinarySearchAcceptanceRateTunerTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
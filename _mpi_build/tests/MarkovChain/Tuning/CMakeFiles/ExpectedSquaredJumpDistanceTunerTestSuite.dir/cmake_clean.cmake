@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ExpectedSquaredJumpDistanceTunerTestSuite.dir/ExpectedSquaredJumpDistanceTunerTestSuite.cpp.o"
+  "CMakeFiles/ExpectedSquaredJumpDistanceTunerTestSuite.dir/ExpectedSquaredJumpDistanceTunerTestSuite.cpp.o.d"
+  "ExpectedSquaredJumpDistanceTunerTestSuite"
+  "ExpectedSquaredJumpDistanceTunerTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ExpectedSquaredJumpDistanceTunerTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
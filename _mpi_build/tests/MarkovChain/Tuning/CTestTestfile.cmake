@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/MarkovChain/Tuning
+# Build directory: /root/repo/_mpi_build/tests/MarkovChain/Tuning
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(AcceptanceRateTunerTestSuite "/root/repo/_mpi_build/tests/MarkovChain/Tuning/AcceptanceRateTunerTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/AcceptanceRateTunerTestSuite.xml")
+set_tests_properties(AcceptanceRateTunerTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Tuning" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Tuning/CMakeLists.txt;13;add_test;/root/repo/tests/MarkovChain/Tuning/CMakeLists.txt;0;")
+add_test(BinarySearchAcceptanceRateTunerTestSuite "/root/repo/_mpi_build/tests/MarkovChain/Tuning/BinarySearchAcceptanceRateTunerTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/BinarySearchAcceptanceRateTunerTestSuite.xml")
+set_tests_properties(BinarySearchAcceptanceRateTunerTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Tuning" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Tuning/CMakeLists.txt;13;add_test;/root/repo/tests/MarkovChain/Tuning/CMakeLists.txt;0;")
+add_test(ExpectedSquaredJumpDistanceTunerTestSuite "/root/repo/_mpi_build/tests/MarkovChain/Tuning/ExpectedSquaredJumpDistanceTunerTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/ExpectedSquaredJumpDistanceTunerTestSuite.xml")
+set_tests_properties(ExpectedSquaredJumpDistanceTunerTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/MarkovChain/Tuning" _BACKTRACE_TRIPLES "/root/repo/tests/MarkovChain/Tuning/CMakeLists.txt;13;add_test;/root/repo/tests/MarkovChain/Tuning/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DegenerateMultivariateGaussianTestSuite.dir/DegenerateMultivariateGaussianTestSuite.cpp.o"
+  "CMakeFiles/DegenerateMultivariateGaussianTestSuite.dir/DegenerateMultivariateGaussianTestSuite.cpp.o.d"
+  "DegenerateMultivariateGaussianTestSuite"
+  "DegenerateMultivariateGaussianTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DegenerateMultivariateGaussianTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GaussianTestSuite.dir/GaussianTestSuite.cpp.o"
+  "CMakeFiles/GaussianTestSuite.dir/GaussianTestSuite.cpp.o.d"
+  "GaussianTestSuite"
+  "GaussianTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GaussianTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
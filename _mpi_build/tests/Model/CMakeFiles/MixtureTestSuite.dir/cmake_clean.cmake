@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MixtureTestSuite.dir/MixtureTestSuite.cpp.o"
+  "CMakeFiles/MixtureTestSuite.dir/MixtureTestSuite.cpp.o.d"
+  "MixtureTestSuite"
+  "MixtureTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MixtureTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
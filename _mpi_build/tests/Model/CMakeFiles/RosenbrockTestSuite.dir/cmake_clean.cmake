@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RosenbrockTestSuite.dir/RosenbrockTestSuite.cpp.o"
+  "CMakeFiles/RosenbrockTestSuite.dir/RosenbrockTestSuite.cpp.o.d"
+  "RosenbrockTestSuite"
+  "RosenbrockTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RosenbrockTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
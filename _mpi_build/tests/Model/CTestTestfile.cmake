@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/Model
+# Build directory: /root/repo/_mpi_build/tests/Model
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(DegenerateMultivariateGaussianTestSuite "/root/repo/_mpi_build/tests/Model/DegenerateMultivariateGaussianTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/DegenerateMultivariateGaussianTestSuite.xml")
+set_tests_properties(DegenerateMultivariateGaussianTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/Model" _BACKTRACE_TRIPLES "/root/repo/tests/Model/CMakeLists.txt;13;add_test;/root/repo/tests/Model/CMakeLists.txt;0;")
+add_test(MixtureTestSuite "/root/repo/_mpi_build/tests/Model/MixtureTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/MixtureTestSuite.xml")
+set_tests_properties(MixtureTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/Model" _BACKTRACE_TRIPLES "/root/repo/tests/Model/CMakeLists.txt;13;add_test;/root/repo/tests/Model/CMakeLists.txt;0;")
+add_test(GaussianTestSuite "/root/repo/_mpi_build/tests/Model/GaussianTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/GaussianTestSuite.xml")
+set_tests_properties(GaussianTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/Model" _BACKTRACE_TRIPLES "/root/repo/tests/Model/CMakeLists.txt;13;add_test;/root/repo/tests/Model/CMakeLists.txt;0;")
+add_test(RosenbrockTestSuite "/root/repo/_mpi_build/tests/Model/RosenbrockTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/RosenbrockTestSuite.xml")
+set_tests_properties(RosenbrockTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/Model" _BACKTRACE_TRIPLES "/root/repo/tests/Model/CMakeLists.txt;13;add_test;/root/repo/tests/Model/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DiffusiveNestedSamplingTestSuite.dir/DiffusiveNestedSamplingTestSuite.cpp.o"
+  "CMakeFiles/DiffusiveNestedSamplingTestSuite.dir/DiffusiveNestedSamplingTestSuite.cpp.o.d"
+  "DiffusiveNestedSamplingTestSuite"
+  "DiffusiveNestedSamplingTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DiffusiveNestedSamplingTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/LogLikelihoodValueTestSuite.dir/LogLikelihoodValueTestSuite.cpp.o"
+  "CMakeFiles/LogLikelihoodValueTestSuite.dir/LogLikelihoodValueTestSuite.cpp.o.d"
+  "LogLikelihoodValueTestSuite"
+  "LogLikelihoodValueTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/LogLikelihoodValueTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/StaticNestedSamplingTestSuite.dir/StaticNestedSamplingTestSuite.cpp.o"
+  "CMakeFiles/StaticNestedSamplingTestSuite.dir/StaticNestedSamplingTestSuite.cpp.o.d"
+  "StaticNestedSamplingTestSuite"
+  "StaticNestedSamplingTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StaticNestedSamplingTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
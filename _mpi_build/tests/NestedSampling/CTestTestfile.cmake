@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/NestedSampling
+# Build directory: /root/repo/_mpi_build/tests/NestedSampling
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(DiffusiveNestedSamplingTestSuite "/root/repo/_mpi_build/tests/NestedSampling/DiffusiveNestedSamplingTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/test/reports/DiffusiveNestedSamplingTestSuite.xml")
+set_tests_properties(DiffusiveNestedSamplingTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/NestedSampling" _BACKTRACE_TRIPLES "/root/repo/tests/NestedSampling/CMakeLists.txt;19;add_test;/root/repo/tests/NestedSampling/CMakeLists.txt;0;")
+add_test(LogLikelihoodValueTestSuite "/root/repo/_mpi_build/tests/NestedSampling/LogLikelihoodValueTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/test/reports/LogLikelihoodValueTestSuite.xml")
+set_tests_properties(LogLikelihoodValueTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/NestedSampling" _BACKTRACE_TRIPLES "/root/repo/tests/NestedSampling/CMakeLists.txt;19;add_test;/root/repo/tests/NestedSampling/CMakeLists.txt;0;")
+add_test(StaticNestedSamplingTestSuite "/root/repo/_mpi_build/tests/NestedSampling/StaticNestedSamplingTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/test/reports/StaticNestedSamplingTestSuite.xml")
+set_tests_properties(StaticNestedSamplingTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/NestedSampling" _BACKTRACE_TRIPLES "/root/repo/tests/NestedSampling/CMakeLists.txt;19;add_test;/root/repo/tests/NestedSampling/CMakeLists.txt;0;")
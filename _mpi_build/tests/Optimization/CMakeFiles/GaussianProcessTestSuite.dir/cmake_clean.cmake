@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/GaussianProcessTestSuite.dir/GaussianProcessTestSuite.cpp.o"
+  "CMakeFiles/GaussianProcessTestSuite.dir/GaussianProcessTestSuite.cpp.o.d"
+  "GaussianProcessTestSuite"
+  "GaussianProcessTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GaussianProcessTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
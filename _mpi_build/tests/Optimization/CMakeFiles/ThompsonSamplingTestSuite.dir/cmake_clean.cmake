@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ThompsonSamplingTestSuite.dir/ThompsonSamplingTestSuite.cpp.o"
+  "CMakeFiles/ThompsonSamplingTestSuite.dir/ThompsonSamplingTestSuite.cpp.o.d"
+  "ThompsonSamplingTestSuite"
+  "ThompsonSamplingTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ThompsonSamplingTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/Optimization
+# Build directory: /root/repo/_mpi_build/tests/Optimization
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(GaussianProcessTestSuite "/root/repo/_mpi_build/tests/Optimization/GaussianProcessTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/GaussianProcessTestSuite.xml")
+set_tests_properties(GaussianProcessTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/Optimization" _BACKTRACE_TRIPLES "/root/repo/tests/Optimization/CMakeLists.txt;12;add_test;/root/repo/tests/Optimization/CMakeLists.txt;0;")
+add_test(ThompsonSamplingTestSuite "/root/repo/_mpi_build/tests/Optimization/ThompsonSamplingTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/ThompsonSamplingTestSuite.xml")
+set_tests_properties(ThompsonSamplingTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/Optimization" _BACKTRACE_TRIPLES "/root/repo/tests/Optimization/CMakeLists.txt;12;add_test;/root/repo/tests/Optimization/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MpiMultiChainRunnerTestSuite.dir/MpiMultiChainRunnerTestSuite.cpp.o"
+  "CMakeFiles/MpiMultiChainRunnerTestSuite.dir/MpiMultiChainRunnerTestSuite.cpp.o.d"
+  "MpiMultiChainRunnerTestSuite"
+  "MpiMultiChainRunnerTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MpiMultiChainRunnerTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
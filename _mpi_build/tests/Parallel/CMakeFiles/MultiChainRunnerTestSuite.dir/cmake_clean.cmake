@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MultiChainRunnerTestSuite.dir/MultiChainRunnerTestSuite.cpp.o"
+  "CMakeFiles/MultiChainRunnerTestSuite.dir/MultiChainRunnerTestSuite.cpp.o.d"
+  "MultiChainRunnerTestSuite"
+  "MultiChainRunnerTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MultiChainRunnerTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
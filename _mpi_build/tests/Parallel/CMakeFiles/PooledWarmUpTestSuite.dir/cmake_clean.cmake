@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/PooledWarmUpTestSuite.dir/PooledWarmUpTestSuite.cpp.o"
+  "CMakeFiles/PooledWarmUpTestSuite.dir/PooledWarmUpTestSuite.cpp.o.d"
+  "PooledWarmUpTestSuite"
+  "PooledWarmUpTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/PooledWarmUpTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ThreadPoolTestSuite.dir/ThreadPoolTestSuite.cpp.o"
+  "CMakeFiles/ThreadPoolTestSuite.dir/ThreadPoolTestSuite.cpp.o.d"
+  "ThreadPoolTestSuite"
+  "ThreadPoolTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ThreadPoolTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/Parallel
+# Build directory: /root/repo/_mpi_build/tests/Parallel
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(MultiChainRunnerTestSuite "/root/repo/_mpi_build/tests/Parallel/MultiChainRunnerTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/MultiChainRunnerTestSuite.xml")
+set_tests_properties(MultiChainRunnerTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/Parallel" _BACKTRACE_TRIPLES "/root/repo/tests/Parallel/CMakeLists.txt;12;add_test;/root/repo/tests/Parallel/CMakeLists.txt;0;")
+add_test(PooledWarmUpTestSuite "/root/repo/_mpi_build/tests/Parallel/PooledWarmUpTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/PooledWarmUpTestSuite.xml")
+set_tests_properties(PooledWarmUpTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/Parallel" _BACKTRACE_TRIPLES "/root/repo/tests/Parallel/CMakeLists.txt;12;add_test;/root/repo/tests/Parallel/CMakeLists.txt;0;")
+add_test(ThreadPoolTestSuite "/root/repo/_mpi_build/tests/Parallel/ThreadPoolTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/ThreadPoolTestSuite.xml")
+set_tests_properties(ThreadPoolTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/Parallel" _BACKTRACE_TRIPLES "/root/repo/tests/Parallel/CMakeLists.txt;12;add_test;/root/repo/tests/Parallel/CMakeLists.txt;0;")
+add_test(MpiMultiChainRunnerTestSuite "/usr/bin/mpiexec" "--oversubscribe" "-n" "3" "/root/repo/_mpi_build/tests/Parallel/MpiMultiChainRunnerTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/MpiMultiChainRunnerTestSuite.xml")
+set_tests_properties(MpiMultiChainRunnerTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/Parallel" _BACKTRACE_TRIPLES "/root/repo/tests/Parallel/CMakeLists.txt;26;add_test;/root/repo/tests/Parallel/CMakeLists.txt;0;")
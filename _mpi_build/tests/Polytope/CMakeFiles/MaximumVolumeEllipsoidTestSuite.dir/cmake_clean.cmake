@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/MaximumVolumeEllipsoidTestSuite.dir/MaximumVolumeEllipsoidTestSuite.cpp.o"
+  "CMakeFiles/MaximumVolumeEllipsoidTestSuite.dir/MaximumVolumeEllipsoidTestSuite.cpp.o.d"
+  "MaximumVolumeEllipsoidTestSuite"
+  "MaximumVolumeEllipsoidTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/MaximumVolumeEllipsoidTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/NormalizePolytopeTestSuite.dir/NormalizePolytopeTestSuite.cpp.o"
+  "CMakeFiles/NormalizePolytopeTestSuite.dir/NormalizePolytopeTestSuite.cpp.o.d"
+  "NormalizePolytopeTestSuite"
+  "NormalizePolytopeTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/NormalizePolytopeTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SimplexFactoryTestSuite.dir/SimplexFactoryTestSuite.cpp.o"
+  "CMakeFiles/SimplexFactoryTestSuite.dir/SimplexFactoryTestSuite.cpp.o.d"
+  "SimplexFactoryTestSuite"
+  "SimplexFactoryTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SimplexFactoryTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/Polytope
+# Build directory: /root/repo/_mpi_build/tests/Polytope
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(MaximumVolumeEllipsoidTestSuite "/root/repo/_mpi_build/tests/Polytope/MaximumVolumeEllipsoidTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/MaximumVolumeEllipsoidTestSuite.xml")
+set_tests_properties(MaximumVolumeEllipsoidTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/Polytope" _BACKTRACE_TRIPLES "/root/repo/tests/Polytope/CMakeLists.txt;12;add_test;/root/repo/tests/Polytope/CMakeLists.txt;0;")
+add_test(NormalizePolytopeTestSuite "/root/repo/_mpi_build/tests/Polytope/NormalizePolytopeTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/NormalizePolytopeTestSuite.xml")
+set_tests_properties(NormalizePolytopeTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/Polytope" _BACKTRACE_TRIPLES "/root/repo/tests/Polytope/CMakeLists.txt;12;add_test;/root/repo/tests/Polytope/CMakeLists.txt;0;")
+add_test(SimplexFactoryTestSuite "/root/repo/_mpi_build/tests/Polytope/SimplexFactoryTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/SimplexFactoryTestSuite.xml")
+set_tests_properties(SimplexFactoryTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/Polytope" _BACKTRACE_TRIPLES "/root/repo/tests/Polytope/CMakeLists.txt;12;add_test;/root/repo/tests/Polytope/CMakeLists.txt;0;")
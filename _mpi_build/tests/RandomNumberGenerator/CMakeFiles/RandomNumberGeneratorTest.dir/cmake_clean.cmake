@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RandomNumberGeneratorTest.dir/RandomNumberGeneratorTest.cpp.o"
+  "CMakeFiles/RandomNumberGeneratorTest.dir/RandomNumberGeneratorTest.cpp.o.d"
+  "RandomNumberGeneratorTest"
+  "RandomNumberGeneratorTest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/RandomNumberGeneratorTest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/RandomNumberGenerator
+# Build directory: /root/repo/_mpi_build/tests/RandomNumberGenerator
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(RandomNumberGeneratorTest "/root/repo/_mpi_build/tests/RandomNumberGenerator/RandomNumberGeneratorTest" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/RandomNumberGeneratorTest.xml")
+set_tests_properties(RandomNumberGeneratorTest PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/RandomNumberGenerator" _BACKTRACE_TRIPLES "/root/repo/tests/RandomNumberGenerator/CMakeLists.txt;10;add_test;/root/repo/tests/RandomNumberGenerator/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SequentialMonteCarloTestSuite.dir/SequentialMonteCarloTestSuite.cpp.o"
+  "CMakeFiles/SequentialMonteCarloTestSuite.dir/SequentialMonteCarloTestSuite.cpp.o.d"
+  "SequentialMonteCarloTestSuite"
+  "SequentialMonteCarloTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SequentialMonteCarloTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
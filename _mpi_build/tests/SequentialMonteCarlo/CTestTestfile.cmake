@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/SequentialMonteCarlo
+# Build directory: /root/repo/_mpi_build/tests/SequentialMonteCarlo
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(SequentialMonteCarloTestSuite "/root/repo/_mpi_build/tests/SequentialMonteCarlo/SequentialMonteCarloTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/SequentialMonteCarloTestSuite.xml")
+set_tests_properties(SequentialMonteCarloTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/SequentialMonteCarlo" _BACKTRACE_TRIPLES "/root/repo/tests/SequentialMonteCarlo/CMakeLists.txt;10;add_test;/root/repo/tests/SequentialMonteCarlo/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CovarianceTestSuite.dir/CovarianceTestSuite.cpp.o"
+  "CMakeFiles/CovarianceTestSuite.dir/CovarianceTestSuite.cpp.o.d"
+  "CovarianceTestSuite"
+  "CovarianceTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CovarianceTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
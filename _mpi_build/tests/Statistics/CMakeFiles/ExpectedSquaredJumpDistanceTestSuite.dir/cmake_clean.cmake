@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ExpectedSquaredJumpDistanceTestSuite.dir/ExpectedSquaredJumpDistanceTestSuite.cpp.o"
+  "CMakeFiles/ExpectedSquaredJumpDistanceTestSuite.dir/ExpectedSquaredJumpDistanceTestSuite.cpp.o.d"
+  "ExpectedSquaredJumpDistanceTestSuite"
+  "ExpectedSquaredJumpDistanceTestSuite.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ExpectedSquaredJumpDistanceTestSuite.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/Statistics
+# Build directory: /root/repo/_mpi_build/tests/Statistics
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(CovarianceTestSuite "/root/repo/_mpi_build/tests/Statistics/CovarianceTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/CovarianceTestSuite.xml")
+set_tests_properties(CovarianceTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/Statistics" _BACKTRACE_TRIPLES "/root/repo/tests/Statistics/CMakeLists.txt;11;add_test;/root/repo/tests/Statistics/CMakeLists.txt;0;")
+add_test(ExpectedSquaredJumpDistanceTestSuite "/root/repo/_mpi_build/tests/Statistics/ExpectedSquaredJumpDistanceTestSuite" "--log_format=JUNIT" "--log_sink=/root/repo/_mpi_build/tests/reports/ExpectedSquaredJumpDistanceTestSuite.xml")
+set_tests_properties(ExpectedSquaredJumpDistanceTestSuite PROPERTIES  WORKING_DIRECTORY "/root/repo/_mpi_build/tests/Statistics" _BACKTRACE_TRIPLES "/root/repo/tests/Statistics/CMakeLists.txt;11;add_test;/root/repo/tests/Statistics/CMakeLists.txt;0;")
@@ -1,4 +1,6 @@
 #include <celero/Celero.h>
+#include <fstream>
+#include <sstream>
 
 #include "Fixtures.hpp"
 
@@ -10,6 +12,58 @@ constexpr const int numberOfIterationsPerSample = 1;
 template<typename ModelFiles>
 using PolytopeSpace = PolytopeSpaceFixture<ModelFiles, Eigen::MatrixXd, Eigen::VectorXd>;
 
+namespace {
+    /**
+     * @brief Reads matrices like the CsvReader did before it parsed memory-mapped files, i.e. via a matrix of strings,
+     * std::stod and triplets.
+     */
+    Eigen::MatrixXd readMatrixViaStrings(const std::string &file) {
+        std::ifstream fileStream(file);
+        std::string line;
+        std::vector<std::vector<std::string>> stringRepresentationOfMatrix;
+        while (std::getline(fileStream, line)) {
+            std::stringstream lineStream(line);
+            std::vector<std::string> cells;
+            std::string cell;
+            while (std::getline(lineStream, cell, ',')) {
+                cells.emplace_back(cell);
+            }
+            stringRepresentationOfMatrix.emplace_back(cells);
+        }
+
+        Eigen::SparseMatrix<double> result(stringRepresentationOfMatrix.size(),
+                                           stringRepresentationOfMatrix.at(0).size());
+        std::vector<Eigen::Triplet<double>> triplets;
+        for (size_t i = 0; i < stringRepresentationOfMatrix.size(); ++i) {
+            for (size_t j = 0; j < stringRepresentationOfMatrix[i].size(); ++j) {
+                double value = std::stod(stringRepresentationOfMatrix[i][j]);
+                if (value != 0) {
+                    triplets.emplace_back(i, j, value);
+                }
+            }
+        }
+        result.setFromTriplets(triplets.begin(), triplets.end());
+        return result;
+    }
+
+    const iAT_PLT_636_files iAT_PLT_636;
+}
+
 BASELINE(reade_coli_core, CHR, numberOfSamples, numberOfIterationsPerSample) {
     PolytopeSpace<e_coli_core_files> polytopeSpaceFixture;
 }
+
+BASELINE(readiAT_PLT_636Matrices, StringMatrix, numberOfSamples, numberOfIterationsPerSample) {
+    celero::DoNotOptimizeAway(readMatrixViaStrings(iAT_PLT_636.A));
+    celero::DoNotOptimizeAway(readMatrixViaStrings(iAT_PLT_636.roundedN));
+}
+
+BENCHMARK(readiAT_PLT_636Matrices, CsvReaderDense, numberOfSamples, numberOfIterationsPerSample) {
+    celero::DoNotOptimizeAway(hops::CsvReader::readMatrix<Eigen::MatrixXd>(iAT_PLT_636.A));
+    celero::DoNotOptimizeAway(hops::CsvReader::readMatrix<Eigen::MatrixXd>(iAT_PLT_636.roundedN));
+}
+
+BENCHMARK(readiAT_PLT_636Matrices, CsvReaderSparse, numberOfSamples, numberOfIterationsPerSample) {
+    celero::DoNotOptimizeAway(hops::CsvReader::readMatrix<Eigen::SparseMatrix<double>>(iAT_PLT_636.A));
+    celero::DoNotOptimizeAway(hops::CsvReader::readMatrix<Eigen::SparseMatrix<double>>(iAT_PLT_636.roundedN));
+}
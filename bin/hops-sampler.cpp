@@ -38,10 +38,16 @@ std::map<std::string, std::any> parseCommandLineOptions(int argc, char **argv) {
             ("help,h", "Show help message.")
             ("input-path,i",
              boost::program_options::value<std::string>(),
-             "Or path do directory containing the polytope files in csv format. For an example see the e_coli_core directory in the resources directory.")
+             "Path to a polytope bundle (.hpb) or to a directory containing the polytope files in csv format. For an example see the e_coli_core directory in the resources directory.")
+            ("write-bundle,w",
+             boost::program_options::value<std::string>(),
+             "Writes the input polytope to a polytope bundle (.hpb), which loads faster in later runs.")
+            ("rounding-cache,c",
+             boost::program_options::value<std::string>(),
+             "Directory caching roundings of polytopes without transformation (defaults to hops-rounding-cache in the temporary directory).")
             ("output-path,o",
              boost::program_options::value<std::string>(),
-             "Path to outputfile with either .hdf5 or .csv ending.")
+             "Path to outputfile with either .hdf5, .npy or .csv ending.")
             ("number-of-samples,n",
              boost::program_options::value<long>(),
              "Number of samples to generate.")
@@ -78,40 +84,60 @@ std::map<std::string, std::any> parseCommandLineOptions(int argc, char **argv) {
         Eigen::VectorXd start;
         Eigen::MatrixXd transformation;
         Eigen::VectorXd shift;
+        std::vector<std::string> dimensionNames;
+
+        if (fs::path(inputPath).extension() == ".hpb") {
+            hops::PolytopeBundleReader bundle(inputPath);
+            A = bundle.getA<decltype(A)>();
+            b = bundle.getB();
+            transformation = bundle.getTransformation();
+            shift = bundle.getShift();
+            start = bundle.getStartingPoint();
+            dimensionNames = bundle.getDimensionNames();
+        } else {
+            // Assumes input-path is a directory containing csv-files.
+            if (inputPath.back() == fs::path::preferred_separator) {
+                inputPath = inputPath.substr(0, inputPath.size() - 1);
+            }
+            fs::path inputPathImpl(inputPath);
+            std::string modelName = inputPathImpl.filename();
 
-        std::string fileExtension = inputPath.substr(inputPath.find_last_of('.') + 1);
+            std::string Afile = inputPathImpl / fs::path("A_" + modelName + "_rounded.csv");
+            std::string bfile = inputPathImpl / fs::path("b_" + modelName + "_rounded.csv");
+            std::string transformFile =
+                    inputPathImpl / fs::path("T_" + modelName + "_rounded.csv");
+            std::string shiftFile =
+                    inputPathImpl / fs::path("shift_" + modelName + "_rounded.csv");
+            std::string startFile =
+                    inputPathImpl / fs::path("start_" + modelName + "_rounded.csv");
 
-        // Assumes input-path is a directory containing csv-files.
-        if (inputPath.back() == fs::path::preferred_separator) {
-            inputPath = inputPath.substr(0, inputPath.size() - 1);
+            A = hops::CsvReader::readMatrix<decltype(A)>(Afile);
+            b = hops::CsvReader::readVector<decltype(b)>(bfile);
+            // Without transformation, hops computes the rounding itself.
+            if (fs::exists(transformFile)) {
+                transformation = hops::CsvReader::readMatrix<decltype(transformation)>(transformFile);
+                shift = fs::exists(shiftFile) ? hops::CsvReader::readVector<decltype(shift)>(shiftFile)
+                                              : Eigen::VectorXd::Zero(transformation.rows());
+            }
+            if (fs::exists(startFile)) {
+                start = hops::CsvReader::readVector<decltype(start)>(startFile);
+            }
         }
-        fs::path inputPathImpl(inputPath);
-        std::string modelName = inputPathImpl.filename();
-
-        std::string Afile = inputPathImpl / fs::path("A_" + modelName + "_rounded.csv");
-        std::string bfile = inputPathImpl / fs::path("b_" + modelName + "_rounded.csv");
-        std::string transformFile =
-                inputPathImpl / fs::path("T_" + modelName + "_rounded.csv");
-        std::string shiftFile =
-                inputPathImpl / fs::path("shift_" + modelName + "_rounded.csv");
-        std::string startFile =
-                inputPathImpl / fs::path("start_" + modelName + "_rounded.csv");
-
-        A = hops::CsvReader::readMatrix<decltype(A)>(Afile);
-        b = hops::CsvReader::readVector<decltype(b)>(bfile);
-        transformation = hops::CsvReader::readMatrix<decltype(transformation)>(transformFile);
-        shift = hops::CsvReader::readVector<decltype(shift)>(shiftFile);
-        try {
-            start = hops::CsvReader::readVector<decltype(start)>(startFile);
-        } catch (...) {
-            start = hops::LinearProgramFactory::createLinearProgram(A, b)->computeChebyshevCenter()
-                    .optimalParameters;
+
+        if (commandLineOptions.count("write-bundle")) {
+            hops::PolytopeBundleWriter::write(commandLineOptions["write-bundle"].as<std::string>(),
+                                              A, b, transformation, shift, start, dimensionNames);
         }
+
         arguments["A"] = A;
         arguments["b"] = b;
-        arguments["transformation"] = transformation;
-        arguments["shift"] = shift;
-        arguments["start"] = start;
+        if (transformation.size() > 0) {
+            arguments["transformation"] = transformation;
+            arguments["shift"] = shift;
+        }
+        if (start.size() > 0) {
+            arguments["start"] = start;
+        }
     } else {
         std::cerr << "Missing polytope input, see --help." << std::endl;
         exit(1);
@@ -124,6 +150,11 @@ std::map<std::string, std::any> parseCommandLineOptions(int argc, char **argv) {
         outputPath = fs::path(outputPath).parent_path() / fs::path(outputPath).stem();
         if (fileType == ".csv") {
             fileWriter = hops::FileWriterFactory::createFileWriter(outputPath, hops::FileWriterType::CSV);
+        } else if (fileType == ".hdf5") {
+            fileWriter = hops::FileWriterFactory::createFileWriter(outputPath + fileType,
+                                                                   hops::FileWriterType::HDF5);
+        } else if (fileType == ".npy") {
+            fileWriter = hops::FileWriterFactory::createFileWriter(outputPath, hops::FileWriterType::NPY);
         } else {
             std::cerr << "Wrong output filetype, see --help." << std::endl;
         }
@@ -165,6 +196,12 @@ std::map<std::string, std::any> parseCommandLineOptions(int argc, char **argv) {
         arguments["rounding"] = commandLineOptions["rounding"].as<bool>();
     }
 
+    if (commandLineOptions.count("rounding-cache")) {
+        arguments["roundingCache"] = commandLineOptions["rounding-cache"].as<std::string>();
+    } else {
+        arguments["roundingCache"] = (fs::temp_directory_path() / "hops-rounding-cache").string();
+    }
+
     if (commandLineOptions.count("batch-size")) {
         arguments["batch-size"] = commandLineOptions["batch-size"].as<long>();
     } else {
@@ -175,6 +212,31 @@ std::map<std::string, std::any> parseCommandLineOptions(int argc, char **argv) {
 }
 
 void runUniformSampling(std::map<std::string, std::any> arguments, const hops::FileWriter *fileWriter) {
+    bool hasTransformation = arguments.find("transformation") != arguments.end();
+    bool hasStart = arguments.find("start") != arguments.end();
+
+    // Case: no rounding trafo is included in input, but hops should approximate rounding
+    if (std::any_cast<bool>(arguments["rounding"]) && !hasTransformation) {
+        auto A = std::any_cast<Eigen::MatrixXd>(arguments["A"]);
+        auto b = std::any_cast<Eigen::VectorXd>(arguments["b"]);
+        hops::RoundingCache roundingCache(std::any_cast<std::string>(arguments["roundingCache"]));
+        auto rounding = roundingCache.getOrCompute(A, b);
+
+        // Samples y in the rounded polytope A L y <= b - A c, which are transformed back by x = L y + c.
+        Eigen::VectorXd start = hasStart ? std::any_cast<Eigen::VectorXd>(arguments["start"])
+                                         : rounding.chebyshevCenter;
+        arguments["start"] = Eigen::VectorXd(rounding.roundingTransformation.triangularView<Eigen::Lower>()
+                                                     .solve(start - rounding.ellipsoidCenter));
+        arguments["A"] = Eigen::MatrixXd(A * rounding.roundingTransformation);
+        arguments["b"] = Eigen::VectorXd(b - A * rounding.ellipsoidCenter);
+        arguments["transformation"] = rounding.roundingTransformation;
+        arguments["shift"] = rounding.ellipsoidCenter;
+    } else if (!hasStart) {
+        arguments["start"] = hops::LinearProgramFactory::createLinearProgram(
+                std::any_cast<Eigen::MatrixXd>(arguments["A"]),
+                std::any_cast<Eigen::VectorXd>(arguments["b"]))->computeChebyshevCenter().optimalParameters;
+    }
+
     // Case: no rounding transformation is included in input and hops should not round
     if (!std::any_cast<bool>(arguments["rounding"])) {
         auto[randomNumberGenerator, markovChain] = setUpSampling(
@@ -195,8 +257,8 @@ void runUniformSampling(std::map<std::string, std::any> arguments, const hops::F
         fileWriter->write("times", times);
 
     }
-        // Case: rounding trafo is included in input
-    else if (arguments.find("transformation") != arguments.end()) {
+        // Case: rounding trafo is included in input or was computed
+    else {
         auto[randomNumberGenerator, markovChain, transformation] = setUpSampling(
                 std::any_cast<Eigen::MatrixXd>(arguments["A"]),
                 std::any_cast<Eigen::VectorXd>(arguments["b"]),
@@ -226,8 +288,4 @@ void runUniformSampling(std::map<std::string, std::any> arguments, const hops::F
             }
         }
     }
-        // Case: no rounding trafo is included in input, but hops should approximate rounding
-    else if (arguments.find("transformation") == arguments.end()) {
-        throw std::runtime_error("use hopsy");
-    }
 }
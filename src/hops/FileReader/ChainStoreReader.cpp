@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <cstring>
+
+#include "ChainStoreReader.hpp"
+
+hops::ChainStoreReader::ChainStoreReader(const std::string &file) : mappedFile(file) {
+    using internal::ChainStoreFormat;
+    const char *data = mappedFile.data();
+    std::uint64_t offset = sizeof(ChainStoreFormat::MAGIC) + sizeof(ChainStoreFormat::Header);
+    if (mappedFile.size() < offset ||
+        !std::equal(ChainStoreFormat::MAGIC, ChainStoreFormat::MAGIC + sizeof(ChainStoreFormat::MAGIC), data)) {
+        throw std::runtime_error(file + " is not a chain store.");
+    }
+    std::memcpy(&header, data + sizeof(ChainStoreFormat::MAGIC), sizeof(header));
+    if (header.version != ChainStoreFormat::VERSION) {
+        throw std::runtime_error(file + " has format version " + std::to_string(header.version) +
+                                 ", but only version " + std::to_string(ChainStoreFormat::VERSION) +
+                                 " is supported.");
+    }
+    ChainStoreFormat::getScalarSize(header.scalarType);
+
+    while (offset < mappedFile.size()) {
+        Chunk chunk;
+        if (offset + sizeof(chunk.header) > mappedFile.size()) {
+            throw std::runtime_error(file + " is truncated.");
+        }
+        std::memcpy(&chunk.header, data + offset, sizeof(chunk.header));
+        chunk.offset = offset + sizeof(chunk.header);
+        chunk.firstRecord = numberOfRecords;
+        offset = chunk.offset + chunk.header.encodedSize;
+        if (offset > mappedFile.size()) {
+            throw std::runtime_error(file + " is truncated.");
+        }
+        numberOfRecords += static_cast<long>(chunk.header.numberOfRecords);
+        chunks.push_back(chunk);
+    }
+}
+
+long hops::ChainStoreReader::getDimension() const {
+    return static_cast<long>(header.dimension);
+}
+
+long hops::ChainStoreReader::getNumberOfRecords() const {
+    return numberOfRecords;
+}
+
+long hops::ChainStoreReader::getNumberOfChunks() const {
+    return static_cast<long>(chunks.size());
+}
+
+long hops::ChainStoreReader::getFirstRecordOfChunk(long chunk) const {
+    return chunks.at(chunk).firstRecord;
+}
+
+long hops::ChainStoreReader::findChunk(long record) const {
+    auto chunk = std::upper_bound(chunks.begin(), chunks.end(), record, [](long record, const Chunk &chunk) {
+        return record < chunk.firstRecord;
+    });
+    return std::max(static_cast<long>(chunk - chunks.begin()) - 1, 0l);
+}
+
+void hops::ChainStoreReader::checkScalarType(std::uint32_t scalarType) const {
+    if (scalarType != header.scalarType) {
+        throw std::runtime_error("Chain store has scalar type " + std::to_string(header.scalarType) + ", but " +
+                                 std::to_string(scalarType) + " was requested.");
+    }
+}
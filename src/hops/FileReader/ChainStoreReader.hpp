@@ -0,0 +1,95 @@
+#ifndef HOPS_CHAINSTOREREADER_HPP
+#define HOPS_CHAINSTOREREADER_HPP
+
+#include <algorithm>
+#include <Eigen/Core>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "hops/FileWriter/ChainStoreFormat.hpp"
+#include "MemoryMappedFile.hpp"
+
+namespace hops {
+    /**
+     * @brief Reads chain stores written by the ChainStoreWriter. Chunks are located through their headers when the
+     * reader is constructed and decoded on access, so single chunks are read without decoding the whole file.
+     */
+    class ChainStoreReader {
+    public:
+        explicit ChainStoreReader(const std::string &file);
+
+        [[nodiscard]] long getDimension() const;
+
+        [[nodiscard]] long getNumberOfRecords() const;
+
+        [[nodiscard]] long getNumberOfChunks() const;
+
+        /**
+         * @return index of the first record of the chunk.
+         */
+        [[nodiscard]] long getFirstRecordOfChunk(long chunk) const;
+
+        /**
+         * @return records of the chunk as columns.
+         * @throws std::runtime_error if Scalar does not match the type of the records.
+         */
+        template<typename Scalar>
+        [[nodiscard]] Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> readChunk(long chunk) const {
+            checkScalarType(internal::ChainStoreFormat::getScalarType<Scalar>());
+            const Chunk &chunkInfo = chunks.at(chunk);
+            Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> records(header.dimension,
+                                                                            chunkInfo.header.numberOfRecords);
+            internal::ChainStoreFormat::decodeChunk(chunkInfo.header,
+                                                    mappedFile.data() + chunkInfo.offset,
+                                                    header.dimension * sizeof(Scalar),
+                                                    sizeof(Scalar),
+                                                    reinterpret_cast<char *>(records.data()));
+            return records;
+        }
+
+        /**
+         * @brief Reads the records [first, first + numberOfRecords), e.g. as input for the statistics functions.
+         * @param numberOfRecords negative values read all records from first on.
+         */
+        template<typename Scalar>
+        [[nodiscard]] std::vector<Eigen::Matrix<Scalar, Eigen::Dynamic, 1>>
+        readRecords(long first = 0, long numberOfRecords = -1) const {
+            long end = numberOfRecords < 0 ? getNumberOfRecords() : first + numberOfRecords;
+            if (first < 0 || end > getNumberOfRecords() || first > end) {
+                throw std::out_of_range("Records are out of range of the chain store.");
+            }
+            std::vector<Eigen::Matrix<Scalar, Eigen::Dynamic, 1>> records;
+            records.reserve(end - first);
+            for (long chunk = findChunk(first); chunk < getNumberOfChunks() &&
+                                                getFirstRecordOfChunk(chunk) < end; ++chunk) {
+                auto chunkRecords = readChunk<Scalar>(chunk);
+                long chunkBegin = std::max(first - getFirstRecordOfChunk(chunk), 0l);
+                long chunkEnd = std::min(end - getFirstRecordOfChunk(chunk), static_cast<long>(chunkRecords.cols()));
+                for (long i = chunkBegin; i < chunkEnd; ++i) {
+                    records.emplace_back(chunkRecords.col(i));
+                }
+            }
+            return records;
+        }
+
+    private:
+        struct Chunk {
+            internal::ChainStoreFormat::ChunkHeader header{};
+            std::uint64_t offset = 0;
+            long firstRecord = 0;
+        };
+
+        [[nodiscard]] long findChunk(long record) const;
+
+        void checkScalarType(std::uint32_t scalarType) const;
+
+        internal::MemoryMappedFile mappedFile;
+        internal::ChainStoreFormat::Header header{};
+        std::vector<Chunk> chunks;
+        long numberOfRecords = 0;
+    };
+}
+
+#endif //HOPS_CHAINSTOREREADER_HPP
@@ -1,36 +1,218 @@
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <exception>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+
 #include <Eigen/Core>
 #include <Eigen/Sparse>
 
 #include "CsvReader.hpp"
+#include "MemoryMappedFile.hpp"
 
-template<typename VectorType>
-VectorType hops::CsvReader::readVector(const std::string &file) {
-    std::ifstream fileStream(file);
-    if (fileStream.fail()) {
-        throw std::runtime_error("Could not access file: " + file);
-    }
-    std::vector<std::string> cells;
-    std::string line;
-    while (std::getline(fileStream, line)) {
-        auto const position = line.find_last_of(',');
-        std::string cell = line.substr(position + 1);
-        if (!cell.empty()) {
-            cells.push_back(cell);
+namespace {
+    /**
+     * @brief Files smaller than this are parsed by a single thread, because starting threads would take longer.
+     */
+    constexpr size_t MINIMUM_BYTES_PER_THREAD = 1 << 18;
+
+    struct Range {
+        const char *begin;
+        const char *end;
+    };
+
+    const char *findLineEnd(const char *begin, const char *end) {
+        const void *newline = std::memchr(begin, '\n', end - begin);
+        return newline ? static_cast<const char *>(newline) : end;
+    }
+
+    const char *findNextLine(const char *begin, const char *end) {
+        const char *lineEnd = findLineEnd(begin, end);
+        return lineEnd == end ? end : lineEnd + 1;
+    }
+
+    bool isTrailingCharacter(char character) {
+        return character == ' ' || character == '\t' || character == '\r' || character == ';';
+    }
+
+    /**
+     * @brief Removes surrounding whitespace and a trailing ';', which some files use to terminate records.
+     */
+    Range trim(Range cell) {
+        while (cell.begin != cell.end && (*cell.begin == ' ' || *cell.begin == '\t')) {
+            ++cell.begin;
         }
+        while (cell.end != cell.begin && isTrailingCharacter(cell.end[-1])) {
+            --cell.end;
+        }
+        return cell;
     }
 
-    size_t startIndex = 0;
-    try {
-        std::stod(cells[0]);
+    bool isBlank(Range line) {
+        Range trimmed = trim(line);
+        return trimmed.begin == trimmed.end;
     }
-    catch (std::invalid_argument &) {
-        startIndex = 1;
+
+    /**
+     * @return true if the trimmed cell is a floating point number, which is then stored in value.
+     */
+    bool tryParseNumber(Range cell, double &value) {
+        cell = trim(cell);
+        if (cell.begin != cell.end && *cell.begin == '+') {
+            ++cell.begin;
+        }
+        auto[end, error] = std::from_chars(cell.begin, cell.end, value);
+        return error == std::errc() && end == cell.end && cell.begin != cell.end;
     }
-    VectorType result(cells.size() - startIndex);
-    for (size_t i = startIndex; i < cells.size(); ++i) {
-        result(i - startIndex) = std::stod(cells[i]);
+
+    double parseNumber(Range cell, const std::string &file) {
+        double value;
+        if (!tryParseNumber(cell, value)) {
+            throw std::runtime_error("Could not parse \"" + std::string(cell.begin, cell.end) + "\" in " + file);
+        }
+        return value;
+    }
+
+    long countCells(Range line) {
+        return std::count(line.begin, line.end, ',') + 1;
     }
-    return result;
+
+    /**
+     * @brief Splits the content into about equally sized ranges of complete lines.
+     */
+    std::vector<Range> splitIntoLineRanges(Range content) {
+        size_t size = content.end - content.begin;
+        size_t numberOfRanges = std::clamp<size_t>(size / MINIMUM_BYTES_PER_THREAD, 1,
+                                                   std::max(1u, std::thread::hardware_concurrency()));
+        std::vector<Range> ranges;
+        const char *begin = content.begin;
+        for (size_t i = 1; i <= numberOfRanges && begin != content.end; ++i) {
+            const char *end = content.end;
+            if (i < numberOfRanges) {
+                end = content.begin + i * size / numberOfRanges;
+                end = findNextLine(std::max(begin, end), content.end);
+            }
+            ranges.push_back({begin, end});
+            begin = end;
+        }
+        return ranges;
+    }
+
+    template<typename Function>
+    void runInParallel(size_t numberOfTasks, const Function &function) {
+        if (numberOfTasks == 1) {
+            function(0);
+            return;
+        }
+        std::vector<std::exception_ptr> errors(numberOfTasks);
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < numberOfTasks; ++i) {
+            threads.emplace_back([&, i]() {
+                try {
+                    function(i);
+                }
+                catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            });
+        }
+        for (auto &thread: threads) {
+            thread.join();
+        }
+        for (const auto &error: errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    /**
+     * @brief Calls cellFunction(row, column, value) for every cell of every non-blank line in the range.
+     */
+    template<typename CellFunction>
+    void parseLines(Range range,
+                    long firstRow,
+                    long numberOfColumns,
+                    bool hasRowNames,
+                    const std::string &file,
+                    const CellFunction &cellFunction) {
+        long row = firstRow;
+        for (const char *lineBegin = range.begin; lineBegin != range.end;) {
+            const char *lineEnd = findLineEnd(lineBegin, range.end);
+            if (!isBlank({lineBegin, lineEnd})) {
+                const char *cellBegin = lineBegin;
+                if (hasRowNames) {
+                    cellBegin = std::find(lineBegin, lineEnd, ',');
+                    cellBegin = cellBegin == lineEnd ? lineEnd : cellBegin + 1;
+                }
+                long column = 0;
+                while (true) {
+                    const char *cellEnd = std::find(cellBegin, lineEnd, ',');
+                    if (column == numberOfColumns) {
+                        throw std::runtime_error("Row " + std::to_string(row) + " of " + file +
+                                                 " has more than " + std::to_string(numberOfColumns) + " columns.");
+                    }
+                    cellFunction(row, column, parseNumber({cellBegin, cellEnd}, file));
+                    ++column;
+                    if (cellEnd == lineEnd) {
+                        break;
+                    }
+                    cellBegin = cellEnd + 1;
+                }
+                if (column != numberOfColumns) {
+                    throw std::runtime_error("Row " + std::to_string(row) + " of " + file + " has " +
+                                             std::to_string(column) + " instead of " +
+                                             std::to_string(numberOfColumns) + " columns.");
+                }
+                ++row;
+            }
+            lineBegin = findNextLine(lineEnd, range.end);
+        }
+    }
+
+    long countNonBlankLines(Range range) {
+        long numberOfLines = 0;
+        for (const char *lineBegin = range.begin; lineBegin != range.end;) {
+            const char *lineEnd = findLineEnd(lineBegin, range.end);
+            numberOfLines += !isBlank({lineBegin, lineEnd});
+            lineBegin = findNextLine(lineEnd, range.end);
+        }
+        return numberOfLines;
+    }
+}
+
+template<typename VectorType>
+VectorType hops::CsvReader::readVector(const std::string &file) {
+    internal::MemoryMappedFile mappedFile(file);
+    const char *end = mappedFile.data() + mappedFile.size();
+
+    std::vector<typename VectorType::Scalar> values;
+    bool isFirstCell = true;
+    for (const char *lineBegin = mappedFile.data(); lineBegin != end;) {
+        const char *lineEnd = findLineEnd(lineBegin, end);
+        // The vector is stored in the last column, the columns before may contain names.
+        const char *cellBegin = lineEnd;
+        while (cellBegin != lineBegin && cellBegin[-1] != ',') {
+            --cellBegin;
+        }
+        Range cell = trim({cellBegin, lineEnd});
+        if (cell.begin != cell.end) {
+            double value;
+            if (tryParseNumber(cell, value)) {
+                values.push_back(static_cast<typename VectorType::Scalar>(value));
+            }
+            else if (!isFirstCell) {
+                parseNumber(cell, file);
+            }
+            // Otherwise, the first cell is a header and skipped.
+            isFirstCell = false;
+        }
+        lineBegin = findNextLine(lineEnd, end);
+    }
+    return Eigen::Map<VectorType>(values.data(), static_cast<long>(values.size()));
 }
 
 template Eigen::VectorXi hops::CsvReader::readVector(const std::string &file);
@@ -44,43 +226,59 @@ template Eigen::VectorXd hops::CsvReader::readVector(const std::string &file);
 
 template<typename MatrixType>
 MatrixType hops::CsvReader::readMatrix(const std::string &file, bool hasColumnAndRowNames) {
+    using Scalar = typename MatrixType::Scalar;
+    internal::MemoryMappedFile mappedFile(file);
+    Range content{mappedFile.data(), mappedFile.data() + mappedFile.size()};
+    if (hasColumnAndRowNames && content.begin != content.end) {
+        content.begin = findNextLine(content.begin, content.end);
+    }
 
-    std::ifstream fileStream(file);
-    if (fileStream.fail()) {
-        throw std::runtime_error("Could not access file: " + file);
-    }
-    std::string line;
-    std::vector<std::vector<std::string>> stringRepresentationOfMatrix;
-    while (std::getline(fileStream, line)) {
-        std::stringstream lineStream(line);
-        std::vector<std::string> cells;
-        std::string cell;
-        while (std::getline(lineStream, cell, ',')) {
-            cells.emplace_back(cell);
-        }
-        stringRepresentationOfMatrix.emplace_back(cells);
-    }
-
-    size_t numberOfRows = hasColumnAndRowNames ? stringRepresentationOfMatrix.size() - 1
-                                               : stringRepresentationOfMatrix.size();
-    size_t numberOfColumns = hasColumnAndRowNames ? stringRepresentationOfMatrix.at(0).size() - 1
-                                                  : stringRepresentationOfMatrix.at(0).size();
-    Eigen::SparseMatrix<typename MatrixType::Scalar> result(numberOfRows, numberOfColumns);
-    std::vector<Eigen::Triplet<typename MatrixType::Scalar>> triplets;
-
-    for (size_t i = 0; i < numberOfRows; ++i) {
-        for (size_t j = 0; j < numberOfColumns; ++j) {
-            size_t row = hasColumnAndRowNames ? i + 1 : i;
-            size_t col = hasColumnAndRowNames ? j + 1 : j;
-            typename MatrixType::Scalar value = std::stod(stringRepresentationOfMatrix.at(row).at(col));
-            if (value != 0) {
-                triplets.emplace_back(i, j, value);
-            }
+    // The first row determines the number of columns.
+    const char *firstRowBegin = content.begin;
+    while (firstRowBegin != content.end && isBlank({firstRowBegin, findLineEnd(firstRowBegin, content.end)})) {
+        firstRowBegin = findNextLine(firstRowBegin, content.end);
+    }
+    if (firstRowBegin == content.end) {
+        throw std::runtime_error("Could not find any rows in " + file);
+    }
+    long numberOfColumns = countCells({firstRowBegin, findLineEnd(firstRowBegin, content.end)}) -
+                           (hasColumnAndRowNames ? 1 : 0);
+
+    std::vector<Range> ranges = splitIntoLineRanges(content);
+    std::vector<long> firstRows(ranges.size() + 1, 0);
+    runInParallel(ranges.size(), [&](size_t i) {
+        firstRows[i + 1] = countNonBlankLines(ranges[i]);
+    });
+    std::partial_sum(firstRows.begin(), firstRows.end(), firstRows.begin());
+    long numberOfRows = firstRows.back();
+
+    if constexpr (std::is_base_of_v<Eigen::SparseMatrixBase<MatrixType>, MatrixType>) {
+        std::vector<std::vector<Eigen::Triplet<Scalar>>> triplets(ranges.size());
+        runInParallel(ranges.size(), [&](size_t i) {
+            parseLines(ranges[i], firstRows[i], numberOfColumns, hasColumnAndRowNames, file,
+                       [&triplets = triplets[i]](long row, long column, double value) {
+                           if (value != 0) {
+                               triplets.emplace_back(row, column, static_cast<Scalar>(value));
+                           }
+                       });
+        });
+        for (size_t i = 1; i < triplets.size(); ++i) {
+            triplets[0].insert(triplets[0].end(), triplets[i].begin(), triplets[i].end());
         }
+        MatrixType result(numberOfRows, numberOfColumns);
+        result.setFromTriplets(triplets[0].begin(), triplets[0].end());
+        result.makeCompressed();
+        return result;
+    } else {
+        MatrixType result(numberOfRows, numberOfColumns);
+        runInParallel(ranges.size(), [&](size_t i) {
+            parseLines(ranges[i], firstRows[i], numberOfColumns, hasColumnAndRowNames, file,
+                       [&result](long row, long column, double value) {
+                           result(row, column) = static_cast<Scalar>(value);
+                       });
+        });
+        return result;
     }
-    result.setFromTriplets(triplets.begin(), triplets.end());
-    result.makeCompressed();
-    return result;
 }
 
 template Eigen::MatrixXi hops::CsvReader::readMatrix(const std::string &file, bool hasColumnAndRowNames);
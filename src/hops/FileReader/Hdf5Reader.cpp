@@ -0,0 +1,101 @@
+#include <hdf5.h>
+#include <tuple>
+
+#include "Hdf5Reader.hpp"
+#include "hops/FileWriter/Hdf5Handle.hpp"
+
+using hops::internal::Hdf5Handle;
+using hops::internal::checkHdf5Status;
+
+namespace {
+    /**
+     * @return number of rows and columns of the dataset, which is 1 for one-dimensional datasets.
+     */
+    std::pair<hsize_t, hsize_t> getDimensions(hid_t dataset, const std::string &description) {
+        Hdf5Handle space(H5Dget_space(dataset), H5Sclose, "Failed to get dataspace of " + description + ".");
+        int rank = H5Sget_simple_extent_ndims(space);
+        if (rank < 1 || rank > 2) {
+            throw std::runtime_error("Dataset " + description + " is neither one- nor two-dimensional.");
+        }
+        hsize_t dimensions[2] = {0, 1};
+        H5Sget_simple_extent_dims(space, dimensions, nullptr);
+        return {dimensions[0], dimensions[1]};
+    }
+
+    template<typename Scalar>
+    std::vector<Scalar> readNumbers(const std::string &file,
+                                    const std::string &description,
+                                    hid_t memoryType,
+                                    hsize_t &numberOfRows,
+                                    hsize_t &numberOfColumns) {
+        Hdf5Handle fileId(H5Fopen(file.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT), H5Fclose,
+                          "Failed to open " + file + ".");
+        Hdf5Handle dataset(H5Dopen2(fileId, description.c_str(), H5P_DEFAULT), H5Dclose,
+                           "Failed to open dataset " + description + " in " + file + ".");
+        std::tie(numberOfRows, numberOfColumns) = getDimensions(dataset, description);
+        std::vector<Scalar> numbers(numberOfRows * numberOfColumns);
+        if (!numbers.empty()) {
+            checkHdf5Status(H5Dread(dataset, memoryType, H5S_ALL, H5S_ALL, H5P_DEFAULT, numbers.data()),
+                            "Failed to read dataset " + description + ".");
+        }
+        return numbers;
+    }
+}
+
+Eigen::MatrixXd hops::Hdf5Reader::readMatrix(const std::string &file, const std::string &description) {
+    hsize_t numberOfRows, numberOfColumns;
+    std::vector<double> numbers = readNumbers<double>(file, description, H5T_NATIVE_DOUBLE, numberOfRows,
+                                                      numberOfColumns);
+    return Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>(
+            numbers.data(), numberOfRows, numberOfColumns);
+}
+
+Eigen::VectorXd hops::Hdf5Reader::readVector(const std::string &file, const std::string &description) {
+    hsize_t numberOfRows, numberOfColumns;
+    std::vector<double> numbers = readNumbers<double>(file, description, H5T_NATIVE_DOUBLE, numberOfRows,
+                                                      numberOfColumns);
+    if (numberOfColumns != 1) {
+        throw std::runtime_error("Dataset " + description + " is not a vector.");
+    }
+    return Eigen::Map<Eigen::VectorXd>(numbers.data(), numberOfRows);
+}
+
+std::vector<long> hops::Hdf5Reader::readLongs(const std::string &file, const std::string &description) {
+    hsize_t numberOfRows, numberOfColumns;
+    return readNumbers<long>(file, description, H5T_NATIVE_LONG, numberOfRows, numberOfColumns);
+}
+
+std::vector<std::string> hops::Hdf5Reader::readStrings(const std::string &file, const std::string &description) {
+    Hdf5Handle fileId(H5Fopen(file.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT), H5Fclose, "Failed to open " + file + ".");
+    Hdf5Handle dataset(H5Dopen2(fileId, description.c_str(), H5P_DEFAULT), H5Dclose,
+                       "Failed to open dataset " + description + " in " + file + ".");
+    hsize_t numberOfRows = getDimensions(dataset, description).first;
+    Hdf5Handle stringType(H5Tcopy(H5T_C_S1), H5Tclose, "Failed to create string type.");
+    checkHdf5Status(H5Tset_size(stringType, H5T_VARIABLE), "Failed to create string type.");
+
+    std::vector<char *> strings(numberOfRows);
+    if (strings.empty()) {
+        return {};
+    }
+    checkHdf5Status(H5Dread(dataset, stringType, H5S_ALL, H5S_ALL, H5P_DEFAULT, strings.data()),
+                    "Failed to read dataset " + description + ".");
+    std::vector<std::string> records(strings.begin(), strings.end());
+    Hdf5Handle space(H5Dget_space(dataset), H5Sclose, "Failed to get dataspace of " + description + ".");
+    H5Dvlen_reclaim(stringType, space, H5P_DEFAULT, strings.data());
+    return records;
+}
+
+std::vector<std::string> hops::Hdf5Reader::readDescriptions(const std::string &file) {
+    Hdf5Handle fileId(H5Fopen(file.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT), H5Fclose, "Failed to open " + file + ".");
+    H5G_info_t info;
+    checkHdf5Status(H5Gget_info(fileId, &info), "Failed to read contents of " + file + ".");
+    std::vector<std::string> descriptions;
+    for (hsize_t i = 0; i < info.nlinks; ++i) {
+        ssize_t length = H5Lget_name_by_idx(fileId, ".", H5_INDEX_NAME, H5_ITER_INC, i, nullptr, 0, H5P_DEFAULT);
+        checkHdf5Status(static_cast<herr_t>(length < 0 ? -1 : 0), "Failed to read contents of " + file + ".");
+        std::string name(length, '\0');
+        H5Lget_name_by_idx(fileId, ".", H5_INDEX_NAME, H5_ITER_INC, i, name.data(), length + 1, H5P_DEFAULT);
+        descriptions.emplace_back(name);
+    }
+    return descriptions;
+}
@@ -0,0 +1,32 @@
+#ifndef HOPS_HDF5READER_HPP
+#define HOPS_HDF5READER_HPP
+
+#include <Eigen/Core>
+#include <string>
+#include <vector>
+
+namespace hops {
+    /**
+     * @brief Reads datasets written by the Hdf5Writer.
+     */
+    class Hdf5Reader {
+    public:
+        Hdf5Reader() = delete;
+
+        /**
+         * @return the dataset as matrix with one dataset row per matrix row. One-dimensional datasets are returned as
+         * a single column.
+         */
+        static Eigen::MatrixXd readMatrix(const std::string &file, const std::string &description);
+
+        static Eigen::VectorXd readVector(const std::string &file, const std::string &description);
+
+        static std::vector<long> readLongs(const std::string &file, const std::string &description);
+
+        static std::vector<std::string> readStrings(const std::string &file, const std::string &description);
+
+        static std::vector<std::string> readDescriptions(const std::string &file);
+    };
+}
+
+#endif //HOPS_HDF5READER_HPP
@@ -0,0 +1,62 @@
+#include <fstream>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "MemoryMappedFile.hpp"
+
+hops::internal::MemoryMappedFile::MemoryMappedFile(const std::string &file) {
+#ifndef _WIN32
+    int fileDescriptor = open(file.c_str(), O_RDONLY);
+    if (fileDescriptor < 0) {
+        throw std::runtime_error("Could not access file: " + file);
+    }
+    struct stat fileStatus{};
+    if (fstat(fileDescriptor, &fileStatus) != 0) {
+        close(fileDescriptor);
+        throw std::runtime_error("Failed to read size of " + file + ".");
+    }
+    mappingSize = static_cast<std::size_t>(fileStatus.st_size);
+    if (mappingSize == 0) {
+        // Empty files can not be mapped.
+        close(fileDescriptor);
+        return;
+    }
+    void *address = mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+    // The mapping stays valid after closing the file.
+    close(fileDescriptor);
+    if (address == MAP_FAILED) {
+        throw std::runtime_error("Failed to map " + file + ".");
+    }
+    mapping = static_cast<const char *>(address);
+#else
+    std::ifstream in(file, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("Could not access file: " + file);
+    }
+    buffer.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    mapping = buffer.data();
+    mappingSize = buffer.size();
+#endif
+}
+
+hops::internal::MemoryMappedFile::~MemoryMappedFile() {
+#ifndef _WIN32
+    if (mapping) {
+        munmap(const_cast<char *>(mapping), mappingSize);
+    }
+#endif
+}
+
+const char *hops::internal::MemoryMappedFile::data() const {
+    return mapping;
+}
+
+std::size_t hops::internal::MemoryMappedFile::size() const {
+    return mappingSize;
+}
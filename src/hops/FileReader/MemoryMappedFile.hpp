@@ -0,0 +1,37 @@
+#ifndef HOPS_MEMORYMAPPEDFILE_HPP
+#define HOPS_MEMORYMAPPEDFILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace hops::internal {
+    /**
+     * @brief Read-only view on the content of a file, which is memory-mapped on POSIX systems and read into a buffer
+     * otherwise.
+     */
+    class MemoryMappedFile {
+    public:
+        /**
+         * @throws std::runtime_error if the file can not be accessed.
+         */
+        explicit MemoryMappedFile(const std::string &file);
+
+        MemoryMappedFile(const MemoryMappedFile &) = delete;
+
+        MemoryMappedFile &operator=(const MemoryMappedFile &) = delete;
+
+        ~MemoryMappedFile();
+
+        [[nodiscard]] const char *data() const;
+
+        [[nodiscard]] std::size_t size() const;
+
+    private:
+        const char *mapping = nullptr;
+        std::size_t mappingSize = 0;
+        std::vector<char> buffer;
+    };
+}
+
+#endif //HOPS_MEMORYMAPPEDFILE_HPP
@@ -0,0 +1,33 @@
+#include "NpyReader.hpp"
+
+hops::NpyReader::NpyReader(const std::string &file) : mappedFile(file) {
+    auto[header, offset] = internal::NpyHeader::parse(mappedFile.data(), mappedFile.size());
+    descr = header.descr;
+    shape = header.shape;
+    dataOffset = offset;
+    if (shape.size() > 2) {
+        throw std::runtime_error(file + " has more than two dimensions.");
+    }
+    std::size_t itemSize = std::stoul(descr.substr(2));
+    if (dataOffset + header.getNumberOfElements() * itemSize > mappedFile.size()) {
+        throw std::runtime_error(file + " is truncated.");
+    }
+}
+
+const std::vector<std::uint64_t> &hops::NpyReader::getShape() const {
+    return shape;
+}
+
+const std::string &hops::NpyReader::getDescr() const {
+    return descr;
+}
+
+long hops::NpyReader::getNumberOfColumns() const {
+    return shape.size() == 2 ? static_cast<long>(shape[1]) : 1;
+}
+
+void hops::NpyReader::checkDescr(const std::string &expectedDescr) const {
+    if (descr != expectedDescr) {
+        throw std::runtime_error("Array has type " + descr + ", but " + expectedDescr + " was requested.");
+    }
+}
@@ -0,0 +1,67 @@
+#ifndef HOPS_NPYREADER_HPP
+#define HOPS_NPYREADER_HPP
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "hops/FileWriter/NpyHeader.hpp"
+#include "MemoryMappedFile.hpp"
+
+namespace hops {
+    /**
+     * @brief Memory-maps a file in the .npy format, e.g. written by the NpyWriter, and exposes it as Eigen::Map
+     * without reading or parsing it.
+     * @details The maps are valid as long as the reader exists. Pages are loaded lazily by the operating system, so
+     * files larger than the main memory can be analysed.
+     */
+    class NpyReader {
+    public:
+        template<typename Scalar>
+        using RowMajorMatrixMap =
+                Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>;
+
+        explicit NpyReader(const std::string &file);
+
+        [[nodiscard]] const std::vector<std::uint64_t> &getShape() const;
+
+        /**
+         * @return type description of the array, e.g. "<f8" for little-endian doubles.
+         */
+        [[nodiscard]] const std::string &getDescr() const;
+
+        /**
+         * @return view with one array row per row, one-dimensional arrays are viewed as a single column.
+         * @throws std::runtime_error if Scalar does not match the type of the array.
+         */
+        template<typename Scalar>
+        [[nodiscard]] RowMajorMatrixMap<Scalar> getMatrix() const {
+            checkDescr(internal::NpyHeader::createDescr<Scalar>());
+            return RowMajorMatrixMap<Scalar>(reinterpret_cast<const Scalar *>(mappedFile.data() + dataOffset),
+                                             static_cast<long>(shape.empty() ? 1 : shape[0]), getNumberOfColumns());
+        }
+
+        /**
+         * @return view on the i-th row, e.g. on the i-th state.
+         */
+        template<typename Scalar>
+        [[nodiscard]] Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, 1>> getRow(long row) const {
+            return Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, 1>>(getMatrix<Scalar>().row(row).data(),
+                                                                                getNumberOfColumns());
+        }
+
+    private:
+        [[nodiscard]] long getNumberOfColumns() const;
+
+        void checkDescr(const std::string &descr) const;
+
+        std::string descr;
+        std::vector<std::uint64_t> shape;
+        internal::MemoryMappedFile mappedFile;
+        std::size_t dataOffset = 0;
+    };
+}
+
+#endif //HOPS_NPYREADER_HPP
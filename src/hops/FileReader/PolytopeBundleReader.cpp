@@ -0,0 +1,133 @@
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "PolytopeBundleReader.hpp"
+
+namespace {
+    using Format = hops::internal::PolytopeBundleFormat;
+}
+
+hops::PolytopeBundleReader::PolytopeBundleReader(const std::string &file) : mappedFile(file), file(file) {
+    if (mappedFile.size() < sizeof(Format::MAGIC) + sizeof(Format::Header) ||
+        !std::equal(Format::MAGIC, Format::MAGIC + sizeof(Format::MAGIC), mappedFile.data())) {
+        throw std::runtime_error(file + " is not a polytope bundle.");
+    }
+    Format::Header header{};
+    std::memcpy(&header, mappedFile.data() + sizeof(Format::MAGIC), sizeof(header));
+    if (header.version != Format::VERSION) {
+        throw std::runtime_error(file + " has format version " + std::to_string(header.version) +
+                                 ", but only version " + std::to_string(Format::VERSION) + " is supported.");
+    }
+    flags = header.flags;
+
+    auto denseSize = [](const Format::SectionHeader &section) {
+        return std::vector<std::uint64_t>{section.rows * section.cols * sizeof(double)};
+    };
+    std::uint64_t offset = sizeof(Format::MAGIC) + Format::pad(sizeof(Format::Header));
+    if (isASparse()) {
+        A = readSection(offset, [](const Format::SectionHeader &section) {
+            return std::vector<std::uint64_t>{(section.cols + 1) * sizeof(int),
+                                              section.size * sizeof(int),
+                                              section.size * sizeof(double)};
+        });
+    } else {
+        A = readSection(offset, denseSize);
+    }
+    b = readSection(offset, denseSize);
+    transformation = readSection(offset, denseSize);
+    shift = readSection(offset, denseSize);
+    startingPoint = readSection(offset, denseSize);
+    dimensionNames = readSection(offset, [](const Format::SectionHeader &section) {
+        return std::vector<std::uint64_t>{section.rows * sizeof(std::uint64_t), section.size};
+    });
+
+    if (A.header.rows != b.header.rows) {
+        throw std::runtime_error(file + " contains A and b with different numbers of rows.");
+    }
+}
+
+template<typename ArraySizes>
+hops::PolytopeBundleReader::Section
+hops::PolytopeBundleReader::readSection(std::uint64_t &offset, const ArraySizes &arraySizes) const {
+    Section section;
+    if (offset + sizeof(section.header) > mappedFile.size()) {
+        throw std::runtime_error(file + " is truncated.");
+    }
+    std::memcpy(&section.header, mappedFile.data() + offset, sizeof(section.header));
+    offset += Format::pad(sizeof(section.header));
+    section.offset = offset;
+    for (std::uint64_t arraySize: arraySizes(section.header)) {
+        offset += Format::pad(arraySize);
+    }
+    if (offset > mappedFile.size()) {
+        throw std::runtime_error(file + " is truncated.");
+    }
+    return section;
+}
+
+bool hops::PolytopeBundleReader::isASparse() const {
+    return flags & Format::SPARSE_A;
+}
+
+Eigen::Map<const Eigen::MatrixXd> hops::PolytopeBundleReader::getDenseA() const {
+    if (isASparse()) {
+        throw std::runtime_error("A is stored sparse in " + file + ".");
+    }
+    return mapDense(A);
+}
+
+hops::PolytopeBundleReader::SparseMatrixMap hops::PolytopeBundleReader::getSparseA() const {
+    if (!isASparse()) {
+        throw std::runtime_error("A is stored dense in " + file + ".");
+    }
+    const char *outerIndices = mappedFile.data() + A.offset;
+    const char *innerIndices = outerIndices + Format::pad((A.header.cols + 1) * sizeof(int));
+    const char *values = innerIndices + Format::pad(A.header.size * sizeof(int));
+    return SparseMatrixMap(static_cast<long>(A.header.rows),
+                           static_cast<long>(A.header.cols),
+                           static_cast<long>(A.header.size),
+                           reinterpret_cast<const int *>(outerIndices),
+                           reinterpret_cast<const int *>(innerIndices),
+                           reinterpret_cast<const double *>(values));
+}
+
+Eigen::Map<const Eigen::VectorXd> hops::PolytopeBundleReader::getB() const {
+    return {reinterpret_cast<const double *>(mappedFile.data() + b.offset), static_cast<long>(b.header.rows)};
+}
+
+Eigen::Map<const Eigen::MatrixXd> hops::PolytopeBundleReader::getTransformation() const {
+    return mapDense(transformation);
+}
+
+Eigen::Map<const Eigen::VectorXd> hops::PolytopeBundleReader::getShift() const {
+    return {reinterpret_cast<const double *>(mappedFile.data() + shift.offset), static_cast<long>(shift.header.rows)};
+}
+
+Eigen::Map<const Eigen::VectorXd> hops::PolytopeBundleReader::getStartingPoint() const {
+    return {reinterpret_cast<const double *>(mappedFile.data() + startingPoint.offset),
+            static_cast<long>(startingPoint.header.rows)};
+}
+
+std::vector<std::string> hops::PolytopeBundleReader::getDimensionNames() const {
+    const char *lengths = mappedFile.data() + dimensionNames.offset;
+    const char *characters = lengths + Format::pad(dimensionNames.header.rows * sizeof(std::uint64_t));
+    std::vector<std::string> names;
+    std::uint64_t position = 0;
+    for (std::uint64_t i = 0; i < dimensionNames.header.rows; ++i) {
+        std::uint64_t length;
+        std::memcpy(&length, lengths + i * sizeof(std::uint64_t), sizeof(length));
+        if (position + length > dimensionNames.header.size) {
+            throw std::runtime_error(file + " contains invalid dimension names.");
+        }
+        names.emplace_back(characters + position, length);
+        position += length;
+    }
+    return names;
+}
+
+Eigen::Map<const Eigen::MatrixXd> hops::PolytopeBundleReader::mapDense(const Section &section) const {
+    return {reinterpret_cast<const double *>(mappedFile.data() + section.offset),
+            static_cast<long>(section.header.rows),
+            static_cast<long>(section.header.cols)};
+}
@@ -0,0 +1,87 @@
+#ifndef HOPS_POLYTOPEBUNDLEREADER_HPP
+#define HOPS_POLYTOPEBUNDLEREADER_HPP
+
+#include <Eigen/Core>
+#include <Eigen/Sparse>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "hops/FileWriter/PolytopeBundleFormat.hpp"
+#include "MemoryMappedFile.hpp"
+
+namespace hops {
+    /**
+     * @brief Memory-maps a polytope bundle written by the PolytopeBundleWriter and exposes its matrices and vectors as
+     * Eigen::Map without copying.
+     * @details The maps are valid as long as the reader exists. Absent optional entries are mapped as empty matrices.
+     */
+    class PolytopeBundleReader {
+    public:
+        using SparseMatrixMap = Eigen::Map<const Eigen::SparseMatrix<double, Eigen::ColMajor, int>>;
+
+        explicit PolytopeBundleReader(const std::string &file);
+
+        [[nodiscard]] bool isASparse() const;
+
+        /**
+         * @throws std::runtime_error if A is stored sparse.
+         */
+        [[nodiscard]] Eigen::Map<const Eigen::MatrixXd> getDenseA() const;
+
+        /**
+         * @throws std::runtime_error if A is stored dense.
+         */
+        [[nodiscard]] SparseMatrixMap getSparseA() const;
+
+        /**
+         * @return copy of A in the requested representation, e.g. Eigen::MatrixXd or Eigen::SparseMatrix<double>,
+         * regardless of how A is stored.
+         */
+        template<typename MatrixType>
+        [[nodiscard]] MatrixType getA() const {
+            if constexpr (std::is_base_of_v<Eigen::SparseMatrixBase<MatrixType>, MatrixType>) {
+                return isASparse() ? MatrixType(getSparseA()) : MatrixType(getDenseA().sparseView());
+            } else {
+                return isASparse() ? MatrixType(getSparseA()) : MatrixType(getDenseA());
+            }
+        }
+
+        [[nodiscard]] Eigen::Map<const Eigen::VectorXd> getB() const;
+
+        [[nodiscard]] Eigen::Map<const Eigen::MatrixXd> getTransformation() const;
+
+        [[nodiscard]] Eigen::Map<const Eigen::VectorXd> getShift() const;
+
+        [[nodiscard]] Eigen::Map<const Eigen::VectorXd> getStartingPoint() const;
+
+        [[nodiscard]] std::vector<std::string> getDimensionNames() const;
+
+    private:
+        struct Section {
+            internal::PolytopeBundleFormat::SectionHeader header{};
+            std::uint64_t offset = 0;
+        };
+
+        /**
+         * @brief Reads the section header at offset and moves offset behind the arrays of the section.
+         * @param arraySizes computes the sizes of the arrays of the section in bytes from its header.
+         */
+        template<typename ArraySizes>
+        Section readSection(std::uint64_t &offset, const ArraySizes &arraySizes) const;
+
+        [[nodiscard]] Eigen::Map<const Eigen::MatrixXd> mapDense(const Section &section) const;
+
+        internal::MemoryMappedFile mappedFile;
+        std::string file;
+        std::uint32_t flags = 0;
+        Section A;
+        Section b;
+        Section transformation;
+        Section shift;
+        Section startingPoint;
+        Section dimensionNames;
+    };
+}
+
+#endif //HOPS_POLYTOPEBUNDLEREADER_HPP
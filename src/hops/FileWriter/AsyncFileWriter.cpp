@@ -0,0 +1,124 @@
+#include <stdexcept>
+
+#include "AsyncFileWriter.hpp"
+
+hops::AsyncFileWriter::AsyncFileWriter(std::unique_ptr<FileWriter> fileWriter, long maximumNumberOfPendingBatches) :
+        fileWriter(std::move(fileWriter)),
+        maximumNumberOfPendingBatches(maximumNumberOfPendingBatches) {
+    if (!this->fileWriter) {
+        throw std::invalid_argument("AsyncFileWriter requires a file writer.");
+    }
+    if (maximumNumberOfPendingBatches < 0) {
+        throw std::invalid_argument("Maximum number of pending batches must not be negative.");
+    }
+    ioThread = std::thread(&AsyncFileWriter::processBatches, this);
+}
+
+hops::AsyncFileWriter::~AsyncFileWriter() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        isStopping = true;
+    }
+    batchAvailable.notify_one();
+    ioThread.join();
+}
+
+template<typename Records>
+void hops::AsyncFileWriter::enqueue(const std::string &description, const Records &records) const {
+    std::unique_lock<std::mutex> lock(mutex);
+    rethrowError();
+    batchWritten.wait(lock, [this]() {
+        return maximumNumberOfPendingBatches == 0 ||
+               static_cast<long>(batches.size()) < maximumNumberOfPendingBatches;
+    });
+    // Copies the records, so the caller can reuse its buffers while the batch is written.
+    batches.emplace_back([writer = fileWriter.get(), description, records]() {
+        writer->write(description, records);
+    });
+    lock.unlock();
+    batchAvailable.notify_one();
+}
+
+void hops::AsyncFileWriter::processBatches() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        batchAvailable.wait(lock, [this]() { return isStopping || !batches.empty(); });
+        if (batches.empty()) {
+            return;
+        }
+        std::function<void()> batch = std::move(batches.front());
+        batches.pop_front();
+        ++numberOfBatchesInProgress;
+        lock.unlock();
+        batchWritten.notify_all();
+        std::exception_ptr batchError;
+        try {
+            batch();
+        }
+        catch (...) {
+            batchError = std::current_exception();
+        }
+        lock.lock();
+        if (batchError && !error) {
+            error = batchError;
+        }
+        --numberOfBatchesInProgress;
+        batchWritten.notify_all();
+    }
+}
+
+void hops::AsyncFileWriter::rethrowError() const {
+    if (error) {
+        std::exception_ptr rethrownError = error;
+        error = nullptr;
+        std::rethrow_exception(rethrownError);
+    }
+}
+
+void hops::AsyncFileWriter::flush() const {
+    std::unique_lock<std::mutex> lock(mutex);
+    batchWritten.wait(lock, [this]() { return batches.empty() && numberOfBatchesInProgress == 0; });
+    rethrowError();
+}
+
+long hops::AsyncFileWriter::getNumberOfPendingBatches() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return static_cast<long>(batches.size()) + numberOfBatchesInProgress;
+}
+
+void hops::AsyncFileWriter::write(const std::string &description, const std::vector<float> &records) const {
+    enqueue(description, records);
+}
+
+void hops::AsyncFileWriter::write(const std::string &description, const std::vector<double> &records) const {
+    enqueue(description, records);
+}
+
+void hops::AsyncFileWriter::write(const std::string &description, const std::vector<long> &records) const {
+    enqueue(description, records);
+}
+
+void hops::AsyncFileWriter::write(const std::string &description, const std::vector<Eigen::VectorXf> &records) const {
+    enqueue(description, records);
+}
+
+void hops::AsyncFileWriter::write(const std::string &description, const std::vector<Eigen::VectorXd> &records) const {
+    enqueue(description, records);
+}
+
+void hops::AsyncFileWriter::write(const std::string &description, const std::vector<std::string> &records) const {
+    enqueue(description, records);
+}
+
+void hops::AsyncFileWriter::write(const std::string &description,
+                                  const std::vector<Eigen::Matrix<std::uint16_t, Eigen::Dynamic, 1>> &records) const {
+    enqueue(description, records);
+}
+
+void hops::AsyncFileWriter::write(const std::string &description, const Eigen::MatrixXd &matrix) const {
+    enqueue(description, matrix);
+}
+
+void hops::AsyncFileWriter::write(const std::string &description, const Eigen::VectorXd &vector) const {
+    enqueue(description, vector);
+}
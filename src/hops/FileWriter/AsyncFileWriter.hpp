@@ -0,0 +1,91 @@
+#ifndef HOPS_ASYNCFILEWRITER_HPP
+#define HOPS_ASYNCFILEWRITER_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "FileWriter.hpp"
+
+namespace hops {
+    /**
+     * @brief Decorates a FileWriter, such that records are formatted and written on a dedicated I/O thread.
+     * @details Every write copies the records into a batch and returns immediately, so the caller can clear and reuse
+     * its record buffers while the previous batch is still being written. Batches are written in the order of the
+     * calls. If maximumNumberOfPendingBatches batches are pending, write blocks until the I/O thread caught up, which
+     * bounds the memory held by the queue. Errors of the decorated writer are rethrown by the next call to write or
+     * flush.
+     */
+    class AsyncFileWriter : public FileWriter {
+    public:
+        /**
+         * @param fileWriter decorated writer, which is only used by the I/O thread.
+         * @param maximumNumberOfPendingBatches number of batches before write blocks, 0 for no limit.
+         */
+        explicit AsyncFileWriter(std::unique_ptr<FileWriter> fileWriter, long maximumNumberOfPendingBatches = 16);
+
+        AsyncFileWriter(const AsyncFileWriter &) = delete;
+
+        AsyncFileWriter &operator=(const AsyncFileWriter &) = delete;
+
+        /**
+         * @brief Writes all pending batches before joining the I/O thread.
+         */
+        ~AsyncFileWriter() override;
+
+        void write(const std::string &description, const std::vector<float> &records) const override;
+
+        void write(const std::string &description, const std::vector<double> &records) const override;
+
+        void write(const std::string &description, const std::vector<long> &records) const override;
+
+        void write(const std::string &description, const std::vector<Eigen::VectorXf> &records) const override;
+
+        void write(const std::string &description, const std::vector<Eigen::VectorXd> &records) const override;
+
+        void write(const std::string &description, const std::vector<std::string> &records) const override;
+
+        void write(const std::string &description,
+                   const std::vector<Eigen::Matrix<std::uint16_t, Eigen::Dynamic, 1>> &records) const override;
+
+        void write(const std::string &description, const Eigen::MatrixXd &matrix) const override;
+
+        void write(const std::string &description, const Eigen::VectorXd &vector) const override;
+
+        /**
+         * @brief Blocks until all batches passed to write before have been written by the decorated writer, e.g. to
+         * ensure that the records on disk match a checkpoint.
+         * @throws the first exception thrown by the decorated writer since the last call.
+         */
+        void flush() const;
+
+        [[nodiscard]] long getNumberOfPendingBatches() const;
+
+    private:
+        template<typename Records>
+        void enqueue(const std::string &description, const Records &records) const;
+
+        void processBatches();
+
+        void rethrowError() const;
+
+        std::unique_ptr<FileWriter> fileWriter;
+        long maximumNumberOfPendingBatches;
+
+        mutable std::mutex mutex;
+        mutable std::condition_variable batchAvailable;
+        mutable std::condition_variable batchWritten;
+        mutable std::deque<std::function<void()>> batches;
+        mutable long numberOfBatchesInProgress = 0;
+        mutable std::exception_ptr error;
+        bool isStopping = false;
+
+        std::thread ioThread;
+    };
+}
+
+#endif //HOPS_ASYNCFILEWRITER_HPP
@@ -0,0 +1,117 @@
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+#ifdef HOPS_ZLIB_SUPPORT
+#include <zlib.h>
+#endif
+
+#include "ChainStoreFormat.hpp"
+
+namespace {
+    /**
+     * @brief Stores the i-th bytes of all values next to each other.
+     */
+    void shuffle(const char *values, std::uint64_t numberOfBytes, std::uint64_t scalarSize, char *shuffled) {
+        std::uint64_t numberOfValues = numberOfBytes / scalarSize;
+        for (std::uint64_t byte = 0; byte < scalarSize; ++byte) {
+            for (std::uint64_t value = 0; value < numberOfValues; ++value) {
+                shuffled[byte * numberOfValues + value] = values[value * scalarSize + byte];
+            }
+        }
+    }
+
+    void unshuffle(const char *shuffled, std::uint64_t numberOfBytes, std::uint64_t scalarSize, char *values) {
+        std::uint64_t numberOfValues = numberOfBytes / scalarSize;
+        for (std::uint64_t byte = 0; byte < scalarSize; ++byte) {
+            for (std::uint64_t value = 0; value < numberOfValues; ++value) {
+                values[value * scalarSize + byte] = shuffled[byte * numberOfValues + value];
+            }
+        }
+    }
+}
+
+std::size_t hops::internal::ChainStoreFormat::getScalarSize(std::uint32_t scalarType) {
+    switch (scalarType) {
+        case FLOAT32:
+            return 4;
+        case FLOAT64:
+        case INT64:
+            return 8;
+        case UINT16:
+            return 2;
+        default:
+            throw std::runtime_error("Unknown scalar type " + std::to_string(scalarType) + " in chain store.");
+    }
+}
+
+std::string hops::internal::ChainStoreFormat::encodeChunk(const char *records,
+                                                          std::uint64_t numberOfRecords,
+                                                          std::uint64_t recordSize,
+                                                          std::uint64_t scalarSize,
+                                                          [[maybe_unused]] int compressionLevel) {
+    std::uint64_t numberOfBytes = numberOfRecords * recordSize;
+    std::vector<char> deltas(records, records + numberOfBytes);
+    for (std::uint64_t i = numberOfBytes; i-- > recordSize;) {
+        deltas[i] ^= deltas[i - recordSize];
+    }
+    std::vector<char> shuffled(numberOfBytes);
+    shuffle(deltas.data(), numberOfBytes, scalarSize, shuffled.data());
+
+    ChunkHeader header{numberOfRecords, numberOfBytes, SHUFFLE, 0};
+    std::string chunk(sizeof(ChunkHeader), '\0');
+#ifdef HOPS_ZLIB_SUPPORT
+    if (compressionLevel > 0) {
+        uLongf compressedSize = compressBound(numberOfBytes);
+        chunk.resize(sizeof(ChunkHeader) + compressedSize);
+        int status = compress2(reinterpret_cast<Bytef *>(chunk.data() + sizeof(ChunkHeader)), &compressedSize,
+                               reinterpret_cast<const Bytef *>(shuffled.data()), numberOfBytes, compressionLevel);
+        if (status != Z_OK) {
+            throw std::runtime_error("Failed to compress chunk of chain store.");
+        }
+        // Incompressible chunks are stored uncompressed.
+        if (compressedSize < numberOfBytes) {
+            header.encodedSize = compressedSize;
+            header.codec = SHUFFLE_ZLIB;
+        }
+    }
+#endif
+    if (header.codec == SHUFFLE) {
+        chunk.resize(sizeof(ChunkHeader));
+        chunk.append(shuffled.data(), numberOfBytes);
+    }
+    chunk.resize(sizeof(ChunkHeader) + header.encodedSize);
+    std::memcpy(chunk.data(), &header, sizeof(ChunkHeader));
+    return chunk;
+}
+
+void hops::internal::ChainStoreFormat::decodeChunk(const ChunkHeader &header,
+                                                   const char *encodedRecords,
+                                                   std::uint64_t recordSize,
+                                                   std::uint64_t scalarSize,
+                                                   char *records) {
+    std::uint64_t numberOfBytes = header.numberOfRecords * recordSize;
+    std::vector<char> shuffled;
+    const char *shuffledRecords = encodedRecords;
+    if (header.codec == SHUFFLE_ZLIB) {
+#ifdef HOPS_ZLIB_SUPPORT
+        shuffled.resize(numberOfBytes);
+        uLongf decompressedSize = numberOfBytes;
+        int status = uncompress(reinterpret_cast<Bytef *>(shuffled.data()), &decompressedSize,
+                                reinterpret_cast<const Bytef *>(encodedRecords), header.encodedSize);
+        if (status != Z_OK || decompressedSize != numberOfBytes) {
+            throw std::runtime_error("Failed to decompress chunk of chain store.");
+        }
+        shuffledRecords = shuffled.data();
+#else
+        throw std::runtime_error("Decoding compressed chain stores requires hops with zlib support.");
+#endif
+    } else if (header.codec != SHUFFLE || header.encodedSize != numberOfBytes) {
+        throw std::runtime_error("Invalid chunk in chain store.");
+    }
+
+    unshuffle(shuffledRecords, numberOfBytes, scalarSize, records);
+    for (std::uint64_t i = recordSize; i < numberOfBytes; ++i) {
+        records[i] ^= records[i - recordSize];
+    }
+}
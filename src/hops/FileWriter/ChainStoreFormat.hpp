@@ -0,0 +1,91 @@
+#ifndef HOPS_CHAINSTOREFORMAT_HPP
+#define HOPS_CHAINSTOREFORMAT_HPP
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace hops::internal {
+    /**
+     * @brief Layout and chunk encoding of chain stores, which store records of fixed dimension in independently
+     * compressed chunks.
+     * @details A chain store starts with the magic bytes and the Header, followed by the chunks. Every chunk starts
+     * with its ChunkHeader, which allows skipping it without decoding. Chunks are encoded by
+     * 1. XOR-ing every record with the previous record of the same chunk, which zeroes all bytes that did not change,
+     * e.g. all coordinates but one for coordinate hit-and-run,
+     * 2. shuffling the bytes, so the i-th bytes of all values are stored next to each other, and
+     * 3. compressing the result with zlib, if available.
+     * The first record of every chunk is stored as is, so every chunk can be decoded on its own.
+     * Values are stored in the native representation of the machine.
+     */
+    struct ChainStoreFormat {
+        static constexpr char MAGIC[8] = {'H', 'O', 'P', 'S', 'C', 'H', 'S', 'T'};
+        static constexpr std::uint32_t VERSION = 1;
+
+        enum ScalarType : std::uint32_t {
+            FLOAT32 = 1,
+            FLOAT64 = 2,
+            INT64 = 3,
+            UINT16 = 4,
+        };
+
+        enum Codec : std::uint32_t {
+            SHUFFLE = 0,
+            SHUFFLE_ZLIB = 1,
+        };
+
+        struct Header {
+            std::uint32_t version;
+            std::uint32_t scalarType;
+            std::uint64_t dimension;
+        };
+
+        struct ChunkHeader {
+            std::uint64_t numberOfRecords;
+            std::uint64_t encodedSize;
+            std::uint32_t codec;
+            std::uint32_t reserved;
+        };
+
+        template<typename Scalar>
+        static constexpr ScalarType getScalarType() {
+            if constexpr (std::is_same_v<Scalar, float>) {
+                return FLOAT32;
+            } else if constexpr (std::is_same_v<Scalar, double>) {
+                return FLOAT64;
+            } else if constexpr (std::is_same_v<Scalar, std::uint16_t>) {
+                return UINT16;
+            } else {
+                static_assert(std::is_integral_v<Scalar> && std::is_signed_v<Scalar> && sizeof(Scalar) == 8,
+                              "Chain stores support float, double, 64 bit integers and uint16_t.");
+                return INT64;
+            }
+        }
+
+        static std::size_t getScalarSize(std::uint32_t scalarType);
+
+        /**
+         * @param records numberOfRecords records of recordSize bytes each, which consist of values of scalarSize
+         * bytes.
+         * @param compressionLevel zlib compression level from 1 (fastest) to 9 (smallest), 0 disables compression.
+         * @return chunk header followed by the encoded records.
+         */
+        static std::string encodeChunk(const char *records,
+                                       std::uint64_t numberOfRecords,
+                                       std::uint64_t recordSize,
+                                       std::uint64_t scalarSize,
+                                       int compressionLevel);
+
+        /**
+         * @brief Reverts encodeChunk.
+         * @param records destination for header.numberOfRecords records of recordSize bytes each.
+         */
+        static void decodeChunk(const ChunkHeader &header,
+                                const char *encodedRecords,
+                                std::uint64_t recordSize,
+                                std::uint64_t scalarSize,
+                                char *records);
+    };
+}
+
+#endif //HOPS_CHAINSTOREFORMAT_HPP
@@ -0,0 +1,140 @@
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include "ChainStoreFormat.hpp"
+#include "ChainStoreWriter.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+    template<typename Scalar>
+    std::vector<Scalar> concatenateRecords(const std::vector<Eigen::Matrix<Scalar, Eigen::Dynamic, 1>> &records,
+                                           const std::string &description) {
+        std::vector<Scalar> rows;
+        if (records.empty()) {
+            return rows;
+        }
+        rows.reserve(records.size() * records.front().rows());
+        for (const auto &record: records) {
+            if (record.rows() != records.front().rows()) {
+                throw std::invalid_argument("Records of " + description + " have different dimensions.");
+            }
+            rows.insert(rows.end(), record.data(), record.data() + record.rows());
+        }
+        return rows;
+    }
+}
+
+hops::ChainStoreWriter::ChainStoreWriter(std::string path, long chunkSize, int compressionLevel) :
+        m_path(std::move(path)),
+        m_chunkSize(chunkSize),
+        m_compressionLevel(compressionLevel) {
+    if (chunkSize <= 0) {
+        throw std::invalid_argument("Chunk size has to be positive.");
+    }
+    fs::create_directories(m_path);
+}
+
+std::string hops::ChainStoreWriter::getFileName(const std::string &description) const {
+    fs::path fileName(m_path);
+    fileName /= fileName.filename().string() + "_" + description + ".hcs";
+    return fileName.string();
+}
+
+template<typename Scalar>
+void hops::ChainStoreWriter::append(const std::string &description,
+                                    const Scalar *data,
+                                    std::uint64_t numberOfRecords,
+                                    std::uint64_t dimension) const {
+    using internal::ChainStoreFormat;
+    std::string fileName = getFileName(description);
+    ChainStoreFormat::Header header{ChainStoreFormat::VERSION, ChainStoreFormat::getScalarType<Scalar>(), dimension};
+
+    if (fs::exists(fileName)) {
+        std::ifstream in(fileName, std::ios::binary);
+        char magic[sizeof(ChainStoreFormat::MAGIC)];
+        ChainStoreFormat::Header existingHeader{};
+        in.read(magic, sizeof(magic));
+        in.read(reinterpret_cast<char *>(&existingHeader), sizeof(existingHeader));
+        if (!in || !std::equal(magic, magic + sizeof(magic), ChainStoreFormat::MAGIC) ||
+            existingHeader.version != header.version || existingHeader.scalarType != header.scalarType ||
+            existingHeader.dimension != header.dimension) {
+            throw std::runtime_error("Records do not match the existing file " + fileName + ".");
+        }
+    } else {
+        std::ofstream out(fileName, std::ios::binary);
+        out.write(ChainStoreFormat::MAGIC, sizeof(ChainStoreFormat::MAGIC));
+        out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        if (!out) {
+            throw std::runtime_error("Failed to write " + fileName + ".");
+        }
+    }
+
+    std::ofstream out(fileName, std::ios::binary | std::ios::app);
+    std::uint64_t recordSize = dimension * sizeof(Scalar);
+    for (std::uint64_t first = 0; first < numberOfRecords; first += m_chunkSize) {
+        std::uint64_t numberOfChunkRecords = std::min<std::uint64_t>(m_chunkSize, numberOfRecords - first);
+        std::string chunk = ChainStoreFormat::encodeChunk(reinterpret_cast<const char *>(data + first * dimension),
+                                                          numberOfChunkRecords,
+                                                          recordSize,
+                                                          sizeof(Scalar),
+                                                          m_compressionLevel);
+        out.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+    }
+    if (!out) {
+        throw std::runtime_error("Failed to append to " + fileName + ".");
+    }
+}
+
+void hops::ChainStoreWriter::write(const std::string &description, const std::vector<float> &records) const {
+    append(description, records.data(), records.size(), 1);
+}
+
+void hops::ChainStoreWriter::write(const std::string &description, const std::vector<double> &records) const {
+    append(description, records.data(), records.size(), 1);
+}
+
+void hops::ChainStoreWriter::write(const std::string &description, const std::vector<long> &records) const {
+    append(description, records.data(), records.size(), 1);
+}
+
+void hops::ChainStoreWriter::write(const std::string &description,
+                                   const std::vector<Eigen::VectorXf> &records) const {
+    if (!records.empty()) {
+        append(description, concatenateRecords(records, description).data(), records.size(), records.front().rows());
+    }
+}
+
+void hops::ChainStoreWriter::write(const std::string &description,
+                                   const std::vector<Eigen::VectorXd> &records) const {
+    if (!records.empty()) {
+        append(description, concatenateRecords(records, description).data(), records.size(), records.front().rows());
+    }
+}
+
+void hops::ChainStoreWriter::write(const std::string &description,
+                                   const std::vector<Eigen::Matrix<std::uint16_t, Eigen::Dynamic, 1>> &records) const {
+    if (!records.empty()) {
+        append(description, concatenateRecords(records, description).data(), records.size(), records.front().rows());
+    }
+}
+
+void hops::ChainStoreWriter::write(const std::string &description, const std::vector<std::string> &records) const {
+    fs::path fileName(getFileName(description));
+    std::ofstream out(fileName.replace_extension(".txt"), std::ios_base::app);
+    for (const auto &record: records) {
+        out << record << "\n";
+    }
+}
+
+void hops::ChainStoreWriter::write(const std::string &description, const Eigen::MatrixXd &matrix) const {
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> rows = matrix;
+    append(description, rows.data(), matrix.rows(), matrix.cols());
+}
+
+void hops::ChainStoreWriter::write(const std::string &description, const Eigen::VectorXd &vector) const {
+    append(description, vector.data(), vector.rows(), 1);
+}
@@ -0,0 +1,60 @@
+#ifndef HOPS_CHAINSTOREWRITER_HPP
+#define HOPS_CHAINSTOREWRITER_HPP
+
+#include <cstdint>
+#include <string>
+
+#include "FileWriter.hpp"
+
+namespace hops {
+    /**
+     * @brief Writes records into compressed chain stores, see ChainStoreFormat, which the ChainStoreReader reads by
+     * chunk.
+     * @details Like the CsvWriter, every description is written to its own file "<path>/<name>_<description>.hcs"
+     * and repeated writes append chunks. Vector records and matrix rows are stored as records, one-dimensional
+     * records as records of dimension one. String records are written as lines to "<path>/<name>_<description>.txt".
+     */
+    class ChainStoreWriter : public FileWriter {
+    public:
+        /**
+         * @param chunkSize maximum number of records per chunk. Larger chunks compress better, smaller chunks are
+         * faster to access randomly.
+         * @param compressionLevel zlib compression level from 1 (fastest) to 9 (smallest), 0 disables compression.
+         */
+        explicit ChainStoreWriter(std::string path, long chunkSize = 1024, int compressionLevel = 1);
+
+        void write(const std::string &description, const std::vector<float> &records) const override;
+
+        void write(const std::string &description, const std::vector<double> &records) const override;
+
+        void write(const std::string &description, const std::vector<long> &records) const override;
+
+        void write(const std::string &description, const std::vector<Eigen::VectorXf> &records) const override;
+
+        void write(const std::string &description, const std::vector<Eigen::VectorXd> &records) const override;
+
+        void write(const std::string &description, const std::vector<std::string> &records) const override;
+
+        void write(const std::string &description,
+                   const std::vector<Eigen::Matrix<std::uint16_t, Eigen::Dynamic, 1>> &records) const override;
+
+        void write(const std::string &description, const Eigen::MatrixXd &matrix) const override;
+
+        void write(const std::string &description, const Eigen::VectorXd &vector) const override;
+
+        [[nodiscard]] std::string getFileName(const std::string &description) const;
+
+    private:
+        template<typename Scalar>
+        void append(const std::string &description,
+                    const Scalar *data,
+                    std::uint64_t numberOfRecords,
+                    std::uint64_t dimension) const;
+
+        std::string m_path;
+        long m_chunkSize;
+        int m_compressionLevel;
+    };
+}
+
+#endif //HOPS_CHAINSTOREWRITER_HPP
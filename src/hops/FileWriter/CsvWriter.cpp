@@ -1,4 +1,7 @@
-#include <fstream>
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+#include <thread>
 
 #include <filesystem>
 namespace fs = std::filesystem;
@@ -15,68 +18,161 @@ namespace fs = std::filesystem;
 
 
 namespace {
-    std::ofstream createOutputStream(const std::string &outputPath, const std::string &description, int precision) {
-        fs::path outPath(outputPath);
-        outPath /= outPath.filename().string() + "_" + description + ".csv";
-        std::ofstream out(outPath.string(), std::ios_base::app);
-        out.precision(precision);
-        return out;
+    constexpr size_t BUFFER_SIZE = 1 << 22;
+    constexpr size_t RECORDS_PER_BLOCK = 1024;
+    constexpr size_t RECORDS_PER_THREAD = 16 * RECORDS_PER_BLOCK;
+
+    class OutputFile {
+    public:
+        OutputFile(const std::string &outputPath, const std::string &description) {
+            fs::path outPath(outputPath);
+            outPath /= outPath.filename().string() + "_" + description + ".csv";
+            file = std::fopen(outPath.string().c_str(), "ab");
+            if (!file) {
+                throw std::runtime_error("Failed to open " + outPath.string() + ".");
+            }
+        }
+
+        OutputFile(const OutputFile &) = delete;
+
+        OutputFile &operator=(const OutputFile &) = delete;
+
+        ~OutputFile() {
+            std::fclose(file);
+        }
+
+        void write(std::string &buffer) {
+            if (std::fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size()) {
+                throw std::runtime_error("Failed to write records.");
+            }
+            buffer.clear();
+        }
+
+    private:
+        std::FILE *file;
+    };
+
+    /**
+     * @brief Formats records [0, numberOfRecords) with format(buffer, begin, end) and appends them to the file.
+     */
+    template<typename Format>
+    void writeFormatted(const std::string &outputPath,
+                        const std::string &description,
+                        size_t numberOfRecords,
+                        long numberOfThreads,
+                        const Format &format) {
+        OutputFile out(outputPath, description);
+        if (numberOfThreads <= 1 || numberOfRecords < 2 * RECORDS_PER_THREAD) {
+            // The buffer keeps its capacity, so repeated writes of the same thread do not allocate.
+            thread_local std::string buffer;
+            buffer.clear();
+            for (size_t begin = 0; begin < numberOfRecords; begin += RECORDS_PER_BLOCK) {
+                format(buffer, begin, std::min(begin + RECORDS_PER_BLOCK, numberOfRecords));
+                if (buffer.size() >= BUFFER_SIZE) {
+                    out.write(buffer);
+                }
+            }
+            out.write(buffer);
+            return;
+        }
+
+        std::vector<std::string> buffers(numberOfThreads);
+        std::vector<std::thread> threads;
+        for (size_t begin = 0; begin < numberOfRecords; begin += numberOfThreads * RECORDS_PER_THREAD) {
+            for (long thread = 0; thread < numberOfThreads; ++thread) {
+                size_t threadBegin = std::min(begin + thread * RECORDS_PER_THREAD, numberOfRecords);
+                size_t threadEnd = std::min(threadBegin + RECORDS_PER_THREAD, numberOfRecords);
+                threads.emplace_back([&format, &buffer = buffers[thread], threadBegin, threadEnd]() {
+                    format(buffer, threadBegin, threadEnd);
+                });
+            }
+            for (auto &thread: threads) {
+                thread.join();
+            }
+            threads.clear();
+            for (auto &buffer: buffers) {
+                out.write(buffer);
+            }
+        }
     }
 }
 
-hops::CsvWriter::CsvWriter(std::string path, int outputPrecision) : m_path(std::move(path)),
-                                                                    m_outputPrecision(outputPrecision) {
+hops::CsvWriter::CsvWriter(std::string path, int outputPrecision, long numberOfThreads) :
+        m_path(std::move(path)),
+        m_outputPrecision(outputPrecision),
+        m_numberOfThreads(numberOfThreads) {
     fs::create_directories(CsvWriter::m_path);
 }
 
 void hops::CsvWriter::write(const std::string &description, const std::vector<float> &records) const {
-    auto out = createOutputStream(CsvWriter::m_path, description, this->m_outputPrecision);
-    internal::CsvWriterImpl::writeOneDimensionalRecords(out, records);
+    writeFormatted(m_path, description, records.size(), m_numberOfThreads,
+                   [&](std::string &buffer, size_t begin, size_t end) {
+                       internal::CsvWriterImpl::formatOneDimensionalRecords(buffer, records, m_outputPrecision,
+                                                                            begin, end);
+                   });
 }
 
 void hops::CsvWriter::write(const std::string &description, const std::vector<double> &records) const {
-    auto out = createOutputStream(CsvWriter::m_path, description, this->m_outputPrecision);
-    internal::CsvWriterImpl::writeOneDimensionalRecords(out, records);
+    writeFormatted(m_path, description, records.size(), m_numberOfThreads,
+                   [&](std::string &buffer, size_t begin, size_t end) {
+                       internal::CsvWriterImpl::formatOneDimensionalRecords(buffer, records, m_outputPrecision,
+                                                                            begin, end);
+                   });
 }
 
 void hops::CsvWriter::write(const std::string &description, const std::vector<long> &records) const {
-    auto out = createOutputStream(CsvWriter::m_path, description, this->m_outputPrecision);
-    internal::CsvWriterImpl::writeOneDimensionalRecords(out, records);
+    writeFormatted(m_path, description, records.size(), m_numberOfThreads,
+                   [&](std::string &buffer, size_t begin, size_t end) {
+                       internal::CsvWriterImpl::formatOneDimensionalRecords(buffer, records, m_outputPrecision,
+                                                                            begin, end);
+                   });
 }
 
 void hops::CsvWriter::write(const std::string &description, const std::vector<Eigen::VectorXf> &records) const {
-    auto out = createOutputStream(CsvWriter::m_path, description, this->m_outputPrecision);
-    internal::CsvWriterImpl::writeEigenVectorRecords(out, records);
+    writeFormatted(m_path, description, records.size(), m_numberOfThreads,
+                   [&](std::string &buffer, size_t begin, size_t end) {
+                       internal::CsvWriterImpl::formatEigenVectorRecords(buffer, records, m_outputPrecision,
+                                                                         begin, end);
+                   });
 }
 
 void hops::CsvWriter::write(const std::string &description, const std::vector<Eigen::VectorXd> &records) const {
-    auto out = createOutputStream(CsvWriter::m_path, description, this->m_outputPrecision);
-    internal::CsvWriterImpl::writeEigenVectorRecords(out, records);
+    writeFormatted(m_path, description, records.size(), m_numberOfThreads,
+                   [&](std::string &buffer, size_t begin, size_t end) {
+                       internal::CsvWriterImpl::formatEigenVectorRecords(buffer, records, m_outputPrecision,
+                                                                         begin, end);
+                   });
 }
 
 void hops::CsvWriter::write(const std::string &description, const std::vector<std::string> &records) const {
-    auto out = createOutputStream(CsvWriter::m_path, description, this->m_outputPrecision);
-    internal::CsvWriterImpl::writeOneDimensionalRecords(out, records);
+    writeFormatted(m_path, description, records.size(), 1,
+                   [&](std::string &buffer, size_t begin, size_t end) {
+                       internal::CsvWriterImpl::formatOneDimensionalRecords(buffer, records, m_outputPrecision,
+                                                                            begin, end);
+                   });
 }
 
 void hops::CsvWriter::write(const std::string &description, const Eigen::MatrixXd &matrix) const {
-    auto out = createOutputStream(CsvWriter::m_path, description, this->m_outputPrecision);
-    for (long i = 0; i < matrix.rows(); ++i) {
-        for (long j = 0; j < matrix.cols(); ++j) {
-            out << matrix(i, j);
-            if (j != matrix.cols() - 1) {
-                out << ",";
-            }
-        }
-        out << "\n";
-    }
+    writeFormatted(m_path, description, matrix.rows(), m_numberOfThreads,
+                   [&](std::string &buffer, size_t begin, size_t end) {
+                       for (size_t i = begin; i < end; ++i) {
+                           for (long j = 0; j < matrix.cols(); ++j) {
+                               internal::CsvWriterImpl::appendNumber(buffer, matrix(i, j), m_outputPrecision);
+                               if (j != matrix.cols() - 1) {
+                                   buffer += ',';
+                               }
+                           }
+                           buffer += '\n';
+                       }
+                   });
 }
 
 void hops::CsvWriter::write(const std::string &description, const Eigen::VectorXd &vector) const {
-    auto out = createOutputStream(CsvWriter::m_path, description, this->m_outputPrecision);
-    for (long i = 0; i < vector.rows(); ++i) {
-        out << vector(i);
-        out << "\n";
-    }
+    writeFormatted(m_path, description, vector.rows(), m_numberOfThreads,
+                   [&](std::string &buffer, size_t begin, size_t end) {
+                       for (size_t i = begin; i < end; ++i) {
+                           internal::CsvWriterImpl::appendNumber(buffer, vector(i), m_outputPrecision);
+                           buffer += '\n';
+                       }
+                   });
 }
-
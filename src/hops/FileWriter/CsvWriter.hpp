@@ -4,9 +4,18 @@
 #include "FileWriter.hpp"
 
 namespace hops {
+    /**
+     * @brief Appends records to "<path>/<name>_<description>.csv".
+     * @details Numbers are formatted with std::to_chars into large buffers, which are written with a single fwrite
+     * each. With the default precision, numbers are written in the shortest representation that reads back exactly.
+     */
     class CsvWriter : public FileWriter {
     public:
-        explicit CsvWriter(std::string path, int outputPrecision = 17);
+        /**
+         * @param outputPrecision number of significant digits, 17 or more for the shortest exact representation.
+         * @param numberOfThreads that format large batches of records in parallel.
+         */
+        explicit CsvWriter(std::string path, int outputPrecision = 17, long numberOfThreads = 1);
 
         void write(const std::string &description, const std::vector<float> &records) const override;
 
@@ -27,6 +36,7 @@ namespace hops {
     private:
         std::string m_path;
         int m_outputPrecision;
+        long m_numberOfThreads;
     };
 }
 
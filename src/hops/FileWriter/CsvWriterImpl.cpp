@@ -1,5 +1,8 @@
+#include <charconv>
 #include <Eigen/Core>
 #include <iostream>
+#include <limits>
+#include <type_traits>
 
 #include "CsvWriterImpl.hpp"
 
@@ -41,3 +44,92 @@ hops::internal::CsvWriterImpl::writeEigenVectorRecords(std::ostream &out, const
 
 template void
 hops::internal::CsvWriterImpl::writeEigenVectorRecords(std::ostream &out, const std::vector<Eigen::VectorXd> &records);
+
+template<typename T>
+void hops::internal::CsvWriterImpl::appendNumber(std::string &buffer, T value, int precision) {
+    char characters[64];
+    std::to_chars_result result{};
+    if constexpr (std::is_floating_point_v<T>) {
+        if (precision >= std::numeric_limits<T>::max_digits10) {
+            result = std::to_chars(characters, characters + sizeof(characters), value);
+        } else {
+            result = std::to_chars(characters, characters + sizeof(characters), value, std::chars_format::general,
+                                   precision);
+        }
+    } else {
+        result = std::to_chars(characters, characters + sizeof(characters), value);
+    }
+    buffer.append(characters, result.ptr);
+}
+
+template<typename Derived>
+void hops::internal::CsvWriterImpl::formatEigenVectorRecords(std::string &buffer,
+                                                             const std::vector<Derived> &records,
+                                                             int precision,
+                                                             size_t begin,
+                                                             size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        for (long j = 0; j < records[i].rows(); ++j) {
+            appendNumber(buffer, records[i](j), precision);
+            buffer += j < records[i].rows() - 1 ? ',' : '\n';
+        }
+    }
+}
+
+template void hops::internal::CsvWriterImpl::formatEigenVectorRecords(std::string &buffer,
+                                                                      const std::vector<Eigen::VectorXf> &records,
+                                                                      int precision,
+                                                                      size_t begin,
+                                                                      size_t end);
+
+template void hops::internal::CsvWriterImpl::formatEigenVectorRecords(std::string &buffer,
+                                                                      const std::vector<Eigen::VectorXd> &records,
+                                                                      int precision,
+                                                                      size_t begin,
+                                                                      size_t end);
+
+template<typename T>
+void hops::internal::CsvWriterImpl::formatOneDimensionalRecords(std::string &buffer,
+                                                                const std::vector<T> &records,
+                                                                int precision,
+                                                                size_t begin,
+                                                                size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        if constexpr (std::is_same_v<T, std::string>) {
+            buffer += records[i];
+        } else {
+            appendNumber(buffer, records[i], precision);
+        }
+        buffer += '\n';
+    }
+}
+
+template void hops::internal::CsvWriterImpl::formatOneDimensionalRecords(std::string &buffer,
+                                                                         const std::vector<long> &records,
+                                                                         int precision,
+                                                                         size_t begin,
+                                                                         size_t end);
+
+template void hops::internal::CsvWriterImpl::formatOneDimensionalRecords(std::string &buffer,
+                                                                         const std::vector<float> &records,
+                                                                         int precision,
+                                                                         size_t begin,
+                                                                         size_t end);
+
+template void hops::internal::CsvWriterImpl::formatOneDimensionalRecords(std::string &buffer,
+                                                                         const std::vector<double> &records,
+                                                                         int precision,
+                                                                         size_t begin,
+                                                                         size_t end);
+
+template void hops::internal::CsvWriterImpl::formatOneDimensionalRecords(std::string &buffer,
+                                                                         const std::vector<std::string> &records,
+                                                                         int precision,
+                                                                         size_t begin,
+                                                                         size_t end);
+
+template void hops::internal::CsvWriterImpl::appendNumber(std::string &buffer, double value, int precision);
+
+template void hops::internal::CsvWriterImpl::appendNumber(std::string &buffer, float value, int precision);
+
+template void hops::internal::CsvWriterImpl::appendNumber(std::string &buffer, long value, int precision);
@@ -2,6 +2,7 @@
 #define HOPS_CSVWRITERIMPL_HPP
 
 #include <ostream>
+#include <string>
 #include <vector>
 
 namespace hops::internal {
@@ -12,6 +13,34 @@ namespace hops::internal {
 
         template<typename Derived>
         static void writeOneDimensionalRecords(std::ostream &out, const std::vector<Derived> &records);
+
+        /**
+         * @brief Appends a number formatted with std::to_chars, which neither allocates nor depends on the locale.
+         * @param precision number of significant digits. If it is at least std::numeric_limits<T>::max_digits10, the
+         * shortest representation that reads back to the identical value is used.
+         */
+        template<typename T>
+        static void appendNumber(std::string &buffer, T value, int precision);
+
+        /**
+         * @brief Appends records[begin, end) as comma-separated lines, like writeEigenVectorRecords.
+         */
+        template<typename Derived>
+        static void formatEigenVectorRecords(std::string &buffer,
+                                             const std::vector<Derived> &records,
+                                             int precision,
+                                             size_t begin,
+                                             size_t end);
+
+        /**
+         * @brief Appends records[begin, end) as one record per line, like writeOneDimensionalRecords.
+         */
+        template<typename T>
+        static void formatOneDimensionalRecords(std::string &buffer,
+                                                const std::vector<T> &records,
+                                                int precision,
+                                                size_t begin,
+                                                size_t end);
     };
 }
 
@@ -1,6 +1,7 @@
 #ifndef HOPS_FILEWRITER_HPP
 #define HOPS_FILEWRITER_HPP
 
+#include <cstdint>
 #include <Eigen/Core>
 #include <string>
 #include <vector>
@@ -52,6 +53,23 @@ namespace hops {
          */
         virtual void write(const std::string &description, const std::vector<std::string> &records) const = 0;
 
+        /**
+         * @brief Writes quantized records, see StateQuantizer.
+         * @details The default implementation writes the records as floats, which represent 16 bit integers exactly.
+         * Binary writers override it to store 16 bit integers.
+         * @param description Description to attach to the records.
+         * @param records
+         */
+        virtual void write(const std::string &description,
+                           const std::vector<Eigen::Matrix<std::uint16_t, Eigen::Dynamic, 1>> &records) const {
+            std::vector<Eigen::VectorXf> floatRecords;
+            floatRecords.reserve(records.size());
+            for (const auto &record: records) {
+                floatRecords.emplace_back(record.cast<float>());
+            }
+            write(description, floatRecords);
+        }
+
         /**
          * @brief Writes a single matrix in double precision.
          * @param description
@@ -1,6 +1,11 @@
 #include "FileWriterFactory.hpp"
 #include "FileWriterType.hpp"
 #include "CsvWriter.hpp"
+#include "NpyWriter.hpp"
+
+#ifdef HOPS_HDF5_SUPPORT
+#include "Hdf5Writer.hpp"
+#endif //HOPS_HDF5_SUPPORT
 
 std::unique_ptr<hops::FileWriter>
 hops::FileWriterFactory::createFileWriter(const std::string &filename, FileWriterType fileWriterType) {
@@ -9,7 +14,14 @@ hops::FileWriterFactory::createFileWriter(const std::string &filename, FileWrite
             return std::make_unique<CsvWriter>(filename);
         }
         case FileWriterType::HDF5: {
-            return nullptr;
+#ifdef HOPS_HDF5_SUPPORT
+            return std::make_unique<Hdf5Writer>(filename);
+#else
+            throw std::runtime_error("HOPS was built without HDF5 support.");
+#endif //HOPS_HDF5_SUPPORT
+        }
+        case FileWriterType::NPY: {
+            return std::make_unique<NpyWriter>(filename);
         }
         default:
             throw std::runtime_error("Invalid Parameter for FileWriterType.");
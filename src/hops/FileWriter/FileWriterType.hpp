@@ -5,6 +5,7 @@ namespace hops {
     enum class FileWriterType {
         CSV,
         HDF5,
+        NPY,
     };
 }
 
@@ -0,0 +1,44 @@
+#ifndef HOPS_HDF5HANDLE_HPP
+#define HOPS_HDF5HANDLE_HPP
+
+#include <hdf5.h>
+#include <stdexcept>
+#include <string>
+
+namespace hops::internal {
+    inline void checkHdf5Status(herr_t status, const std::string &message) {
+        if (status < 0) {
+            throw std::runtime_error(message);
+        }
+    }
+
+    /**
+     * @brief Releases an HDF5 identifier at the end of the scope.
+     */
+    class Hdf5Handle {
+    public:
+        Hdf5Handle(hid_t id, herr_t (*close)(hid_t), const std::string &message) : id(id), close(close) {
+            if (id < 0) {
+                throw std::runtime_error(message);
+            }
+        }
+
+        Hdf5Handle(const Hdf5Handle &) = delete;
+
+        Hdf5Handle &operator=(const Hdf5Handle &) = delete;
+
+        ~Hdf5Handle() {
+            close(id);
+        }
+
+        operator hid_t() const { // NOLINT(google-explicit-constructor)
+            return id;
+        }
+
+    private:
+        hid_t id;
+        herr_t (*close)(hid_t);
+    };
+}
+
+#endif //HOPS_HDF5HANDLE_HPP
@@ -0,0 +1,205 @@
+#include <algorithm>
+#include <filesystem>
+#include <hdf5.h>
+#include <stdexcept>
+
+#include "Hdf5Handle.hpp"
+#include "Hdf5Writer.hpp"
+
+namespace fs = std::filesystem;
+using hops::internal::Hdf5Handle;
+using hops::internal::checkHdf5Status;
+
+namespace {
+    std::string createFileName(const std::string &path) {
+        return fs::path(path).has_extension() ? path : path + ".hdf5";
+    }
+
+    hid_t createDataset(hid_t file,
+                        const std::string &description,
+                        hid_t fileType,
+                        int rank,
+                        hsize_t numberOfColumns,
+                        unsigned compressionLevel,
+                        hsize_t chunkSize,
+                        bool isNumeric) {
+        hsize_t dimensions[2] = {0, numberOfColumns};
+        hsize_t maximumDimensions[2] = {H5S_UNLIMITED, numberOfColumns};
+        Hdf5Handle space(H5Screate_simple(rank, dimensions, maximumDimensions), H5Sclose,
+                         "Failed to create dataspace for " + description + ".");
+        Hdf5Handle properties(H5Pcreate(H5P_DATASET_CREATE), H5Pclose, "Failed to create dataset properties.");
+        hsize_t chunkDimensions[2] = {chunkSize, std::max<hsize_t>(numberOfColumns, 1)};
+        checkHdf5Status(H5Pset_chunk(properties, rank, chunkDimensions),
+                        "Failed to set chunk size of " + description + ".");
+        if (isNumeric && compressionLevel > 0 && H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0) {
+            // Shuffling groups the bytes by significance, which compresses much better for correlated samples.
+            checkHdf5Status(H5Pset_shuffle(properties), "Failed to set shuffle filter of " + description + ".");
+            checkHdf5Status(H5Pset_deflate(properties, compressionLevel),
+                            "Failed to set compression of " + description + ".");
+        }
+        hid_t dataset = H5Dcreate2(file, description.c_str(), fileType, space, H5P_DEFAULT, properties, H5P_DEFAULT);
+        if (dataset < 0) {
+            throw std::runtime_error("Failed to create dataset " + description + ".");
+        }
+        return dataset;
+    }
+
+    void appendRows(hid_t file,
+                    const std::string &description,
+                    const void *data,
+                    hid_t memoryType,
+                    hid_t fileType,
+                    int rank,
+                    hsize_t numberOfRows,
+                    hsize_t numberOfColumns,
+                    unsigned compressionLevel,
+                    hsize_t chunkSize,
+                    bool isNumeric = true) {
+        bool exists = H5Lexists(file, description.c_str(), H5P_DEFAULT) > 0;
+        Hdf5Handle dataset(exists ? H5Dopen2(file, description.c_str(), H5P_DEFAULT)
+                                  : createDataset(file, description, fileType, rank, numberOfColumns,
+                                                  compressionLevel, chunkSize, isNumeric),
+                           H5Dclose, "Failed to open dataset " + description + ".");
+
+        hsize_t dimensions[2] = {0, 0};
+        {
+            Hdf5Handle space(H5Dget_space(dataset), H5Sclose, "Failed to get dataspace of " + description + ".");
+            if (H5Sget_simple_extent_ndims(space) != rank) {
+                throw std::runtime_error("Dataset " + description + " has a different rank than the records.");
+            }
+            H5Sget_simple_extent_dims(space, dimensions, nullptr);
+        }
+        if (rank == 2 && dimensions[1] != numberOfColumns) {
+            throw std::runtime_error("Dataset " + description + " has " + std::to_string(dimensions[1]) +
+                                     " columns, but the records have " + std::to_string(numberOfColumns) + ".");
+        }
+        if (numberOfRows == 0) {
+            return;
+        }
+
+        hsize_t newDimensions[2] = {dimensions[0] + numberOfRows, numberOfColumns};
+        checkHdf5Status(H5Dset_extent(dataset, newDimensions), "Failed to extend dataset " + description + ".");
+        Hdf5Handle fileSpace(H5Dget_space(dataset), H5Sclose, "Failed to get dataspace of " + description + ".");
+        hsize_t offset[2] = {dimensions[0], 0};
+        hsize_t count[2] = {numberOfRows, numberOfColumns};
+        checkHdf5Status(H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, offset, nullptr, count, nullptr),
+                        "Failed to select rows of " + description + ".");
+        Hdf5Handle memorySpace(H5Screate_simple(rank, count, nullptr), H5Sclose,
+                               "Failed to create dataspace for " + description + ".");
+        checkHdf5Status(H5Dwrite(dataset, memoryType, memorySpace, fileSpace, H5P_DEFAULT, data),
+                        "Failed to write records to " + description + ".");
+    }
+
+    template<typename Scalar>
+    void appendVectorRecords(hid_t file,
+                             const std::string &description,
+                             const std::vector<Eigen::Matrix<Scalar, Eigen::Dynamic, 1>> &records,
+                             hid_t memoryType,
+                             hid_t fileType,
+                             unsigned compressionLevel,
+                             hsize_t chunkSize) {
+        if (records.empty()) {
+            return;
+        }
+        long numberOfColumns = records.front().rows();
+        // Column-major storage of the transposed records equals row-major storage of one record per row.
+        Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> rows(numberOfColumns, records.size());
+        for (size_t i = 0; i < records.size(); ++i) {
+            if (records[i].rows() != numberOfColumns) {
+                throw std::invalid_argument("Records of " + description + " have different dimensions.");
+            }
+            rows.col(i) = records[i];
+        }
+        appendRows(file, description, rows.data(), memoryType, fileType, 2, records.size(), numberOfColumns,
+                   compressionLevel, chunkSize);
+    }
+}
+
+hops::Hdf5Writer::Hdf5Writer(std::string path, unsigned compressionLevel, unsigned long long chunkSize) :
+        m_path(createFileName(path)),
+        m_compressionLevel(compressionLevel),
+        m_chunkSize(chunkSize) {
+    if (compressionLevel > 9) {
+        throw std::invalid_argument("Compression level has to be between 0 and 9.");
+    }
+    if (chunkSize == 0) {
+        throw std::invalid_argument("Chunk size has to be positive.");
+    }
+    fs::path parent = fs::path(m_path).parent_path();
+    if (!parent.empty()) {
+        fs::create_directories(parent);
+    }
+    if (fs::exists(m_path)) {
+        m_file = H5Fopen(m_path.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+    } else {
+        m_file = H5Fcreate(m_path.c_str(), H5F_ACC_EXCL, H5P_DEFAULT, H5P_DEFAULT);
+    }
+    if (m_file < 0) {
+        throw std::runtime_error("Failed to open " + m_path + ".");
+    }
+}
+
+hops::Hdf5Writer::~Hdf5Writer() {
+    H5Fclose(m_file);
+}
+
+void hops::Hdf5Writer::write(const std::string &description, const std::vector<float> &records) const {
+    appendRows(m_file, description, records.data(), H5T_NATIVE_FLOAT, H5T_IEEE_F32LE, 1, records.size(), 0,
+               m_compressionLevel, m_chunkSize);
+}
+
+void hops::Hdf5Writer::write(const std::string &description, const std::vector<double> &records) const {
+    appendRows(m_file, description, records.data(), H5T_NATIVE_DOUBLE, H5T_IEEE_F64LE, 1, records.size(), 0,
+               m_compressionLevel, m_chunkSize);
+}
+
+void hops::Hdf5Writer::write(const std::string &description, const std::vector<long> &records) const {
+    appendRows(m_file, description, records.data(), H5T_NATIVE_LONG, H5T_STD_I64LE, 1, records.size(), 0,
+               m_compressionLevel, m_chunkSize);
+}
+
+void hops::Hdf5Writer::write(const std::string &description, const std::vector<Eigen::VectorXf> &records) const {
+    appendVectorRecords(m_file, description, records, H5T_NATIVE_FLOAT, H5T_IEEE_F32LE, m_compressionLevel,
+                        m_chunkSize);
+}
+
+void hops::Hdf5Writer::write(const std::string &description, const std::vector<Eigen::VectorXd> &records) const {
+    appendVectorRecords(m_file, description, records, H5T_NATIVE_DOUBLE, H5T_IEEE_F64LE, m_compressionLevel,
+                        m_chunkSize);
+}
+
+void hops::Hdf5Writer::write(const std::string &description,
+                             const std::vector<Eigen::Matrix<std::uint16_t, Eigen::Dynamic, 1>> &records) const {
+    appendVectorRecords(m_file, description, records, H5T_NATIVE_UINT16, H5T_STD_U16LE, m_compressionLevel,
+                        m_chunkSize);
+}
+
+void hops::Hdf5Writer::write(const std::string &description, const std::vector<std::string> &records) const {
+    Hdf5Handle stringType(H5Tcopy(H5T_C_S1), H5Tclose, "Failed to create string type.");
+    checkHdf5Status(H5Tset_size(stringType, H5T_VARIABLE), "Failed to create string type.");
+    std::vector<const char *> strings;
+    for (const auto &record: records) {
+        strings.emplace_back(record.c_str());
+    }
+    appendRows(m_file, description, strings.data(), stringType, stringType, 1, strings.size(), 0,
+               m_compressionLevel, m_chunkSize, false);
+}
+
+void hops::Hdf5Writer::write(const std::string &description, const Eigen::MatrixXd &matrix) const {
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> rows = matrix;
+    appendRows(m_file, description, rows.data(), H5T_NATIVE_DOUBLE, H5T_IEEE_F64LE, 2, matrix.rows(), matrix.cols(),
+               m_compressionLevel, m_chunkSize);
+}
+
+void hops::Hdf5Writer::write(const std::string &description, const Eigen::VectorXd &vector) const {
+    appendRows(m_file, description, vector.data(), H5T_NATIVE_DOUBLE, H5T_IEEE_F64LE, 1, vector.rows(), 0,
+               m_compressionLevel, m_chunkSize);
+}
+
+void hops::Hdf5Writer::flush() const {
+    checkHdf5Status(H5Fflush(m_file, H5F_SCOPE_GLOBAL), "Failed to flush " + m_path + ".");
+}
+
+const std::string &hops::Hdf5Writer::getPath() const {
+    return m_path;
+}
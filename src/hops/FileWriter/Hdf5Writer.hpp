@@ -0,0 +1,67 @@
+#ifndef HOPS_HDF5WRITER_HPP
+#define HOPS_HDF5WRITER_HPP
+
+#include <cstdint>
+#include <string>
+
+#include "FileWriter.hpp"
+
+namespace hops {
+    /**
+     * @brief Writes every record description to an extendible, chunked dataset of a single HDF5 file.
+     * @details Records of repeated writes with the same description are appended to the dataset, like the CsvWriter
+     * appends to its files. Vector records and matrices are stored as two-dimensional datasets with one record or
+     * matrix row per dataset row, all other records as one-dimensional datasets. Numerical datasets are compressed with
+     * the shuffle and deflate filters, if the compression level is positive. The datasets can be read back with the
+     * Hdf5Reader.
+     */
+    class Hdf5Writer : public FileWriter {
+    public:
+        /**
+         * @param path of the output file, ".hdf5" is appended if it has no extension. An existing file is appended to.
+         * @param compressionLevel of the deflate filter from 0 (no compression) to 9.
+         * @param chunkSize number of dataset rows per chunk.
+         */
+        explicit Hdf5Writer(std::string path, unsigned compressionLevel = 4, unsigned long long chunkSize = 4096);
+
+        Hdf5Writer(const Hdf5Writer &) = delete;
+
+        Hdf5Writer &operator=(const Hdf5Writer &) = delete;
+
+        ~Hdf5Writer() override;
+
+        void write(const std::string &description, const std::vector<float> &records) const override;
+
+        void write(const std::string &description, const std::vector<double> &records) const override;
+
+        void write(const std::string &description, const std::vector<long> &records) const override;
+
+        void write(const std::string &description, const std::vector<Eigen::VectorXf> &records) const override;
+
+        void write(const std::string &description, const std::vector<Eigen::VectorXd> &records) const override;
+
+        void write(const std::string &description, const std::vector<std::string> &records) const override;
+
+        void write(const std::string &description,
+                   const std::vector<Eigen::Matrix<std::uint16_t, Eigen::Dynamic, 1>> &records) const override;
+
+        void write(const std::string &description, const Eigen::MatrixXd &matrix) const override;
+
+        void write(const std::string &description, const Eigen::VectorXd &vector) const override;
+
+        /**
+         * @brief Flushes all written records to disk.
+         */
+        void flush() const;
+
+        [[nodiscard]] const std::string &getPath() const;
+
+    private:
+        std::string m_path;
+        unsigned m_compressionLevel;
+        unsigned long long m_chunkSize;
+        std::int64_t m_file;
+    };
+}
+
+#endif //HOPS_HDF5WRITER_HPP
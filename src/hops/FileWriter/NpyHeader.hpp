@@ -0,0 +1,122 @@
+#ifndef HOPS_NPYHEADER_HPP
+#define HOPS_NPYHEADER_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hops::internal {
+    /**
+     * @brief Header of the .npy format version 1.0, see numpy.lib.format.
+     * @details The header is padded to a fixed size, so the shape can be rewritten in place when records are appended.
+     */
+    struct NpyHeader {
+        static constexpr char MAGIC[] = {'\x93', 'N', 'U', 'M', 'P', 'Y', 1, 0};
+        static constexpr size_t SIZE = 128;
+
+        std::string descr;
+        std::vector<std::uint64_t> shape;
+
+        template<typename Scalar>
+        static std::string createDescr() {
+            static_assert(std::is_arithmetic_v<Scalar>, "The npy format supports arithmetic types only.");
+            std::uint16_t one = 1;
+            char byteOrder;
+            std::memcpy(&byteOrder, &one, 1);
+            return std::string(byteOrder == 1 ? "<" : ">") +
+                   (std::is_floating_point_v<Scalar> ? "f" : std::is_signed_v<Scalar> ? "i" : "u") +
+                   std::to_string(sizeof(Scalar));
+        }
+
+        [[nodiscard]] std::uint64_t getNumberOfElements() const {
+            std::uint64_t numberOfElements = 1;
+            for (auto dimension: shape) {
+                numberOfElements *= dimension;
+            }
+            return numberOfElements;
+        }
+
+        [[nodiscard]] std::string format() const {
+            std::string dimensions;
+            for (size_t i = 0; i < shape.size(); ++i) {
+                dimensions += (i > 0 ? ", " : "") + std::to_string(shape[i]);
+            }
+            // Tuples with a single element require a trailing comma in Python.
+            if (shape.size() == 1) {
+                dimensions += ",";
+            }
+            std::string dictionary = "{'descr': '" + descr + "', 'fortran_order': False, 'shape': (" + dimensions +
+                                     "), }";
+            size_t headerLength = SIZE - sizeof(MAGIC) - 2;
+            if (dictionary.size() + 1 > headerLength) {
+                throw std::runtime_error("Shape is too large for the npy header.");
+            }
+            dictionary.append(headerLength - dictionary.size() - 1, ' ');
+            dictionary += '\n';
+
+            std::string header(MAGIC, sizeof(MAGIC));
+            header += static_cast<char>(headerLength & 0xFF);
+            header += static_cast<char>(headerLength >> 8);
+            return header + dictionary;
+        }
+
+        /**
+         * @param size number of available bytes, which has to be at least the size of the header.
+         * @return header and the offset of the data.
+         */
+        static std::pair<NpyHeader, size_t> parse(const char *data, size_t size) {
+            if (size < sizeof(MAGIC) + 2 || std::memcmp(data, MAGIC, 6) != 0) {
+                throw std::runtime_error("File is not in the npy format.");
+            }
+            if (data[6] != 1 && data[6] != 2) {
+                throw std::runtime_error("Npy format version " + std::to_string(data[6]) + " is not supported.");
+            }
+            size_t lengthSize = data[6] == 1 ? 2 : 4;
+            size_t headerLength = 0;
+            for (size_t i = 0; i < lengthSize; ++i) {
+                headerLength |= static_cast<size_t>(static_cast<unsigned char>(data[sizeof(MAGIC) + i])) << (8 * i);
+            }
+            size_t offset = sizeof(MAGIC) + lengthSize + headerLength;
+            if (size < offset) {
+                throw std::runtime_error("Npy header is truncated.");
+            }
+            std::string dictionary(data + sizeof(MAGIC) + lengthSize, headerLength);
+
+            NpyHeader header;
+            header.descr = readValue(dictionary, "descr");
+            header.descr = header.descr.substr(1, header.descr.size() - 2);
+            if (readValue(dictionary, "fortran_order") != "False") {
+                throw std::runtime_error("Npy files in Fortran order are not supported.");
+            }
+            std::string shape = readValue(dictionary, "shape");
+            for (size_t position = 1; position < shape.size();) {
+                size_t end = shape.find_first_of(",)", position);
+                std::string dimension = shape.substr(position, end - position);
+                if (dimension.find_first_not_of(' ') != std::string::npos) {
+                    header.shape.emplace_back(std::stoull(dimension));
+                }
+                position = end + 1;
+            }
+            return {header, offset};
+        }
+
+    private:
+        static std::string readValue(const std::string &dictionary, const std::string &key) {
+            size_t position = dictionary.find("'" + key + "'");
+            if (position == std::string::npos) {
+                throw std::runtime_error("Npy header does not contain " + key + ".");
+            }
+            position = dictionary.find(':', position) + 1;
+            position = dictionary.find_first_not_of(' ', position);
+            size_t end = dictionary[position] == '(' ? dictionary.find(')', position) + 1
+                                                     : dictionary.find_first_of(",}", position);
+            return dictionary.substr(position, end - position);
+        }
+    };
+}
+
+#endif //HOPS_NPYHEADER_HPP
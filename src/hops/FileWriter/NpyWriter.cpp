@@ -0,0 +1,132 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include "NpyHeader.hpp"
+#include "NpyWriter.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+    template<typename Scalar>
+    std::vector<Scalar> toRows(const std::vector<Eigen::Matrix<Scalar, Eigen::Dynamic, 1>> &records,
+                               const std::string &description) {
+        std::vector<Scalar> rows;
+        if (records.empty()) {
+            return rows;
+        }
+        rows.reserve(records.size() * records.front().rows());
+        for (const auto &record: records) {
+            if (record.rows() != records.front().rows()) {
+                throw std::invalid_argument("Records of " + description + " have different dimensions.");
+            }
+            rows.insert(rows.end(), record.data(), record.data() + record.rows());
+        }
+        return rows;
+    }
+}
+
+hops::NpyWriter::NpyWriter(std::string path) : m_path(std::move(path)) {
+    fs::create_directories(m_path);
+}
+
+std::string hops::NpyWriter::getFileName(const std::string &description) const {
+    fs::path fileName(m_path);
+    fileName /= fileName.filename().string() + "_" + description + ".npy";
+    return fileName.string();
+}
+
+template<typename Scalar>
+void hops::NpyWriter::append(const std::string &description,
+                             const Scalar *data,
+                             std::vector<std::uint64_t> shape) const {
+    using internal::NpyHeader;
+    std::string fileName = getFileName(description);
+    NpyHeader header;
+    header.descr = NpyHeader::createDescr<Scalar>();
+    header.shape = shape;
+    std::uint64_t numberOfBytes = header.getNumberOfElements() * sizeof(Scalar);
+
+    if (!fs::exists(fileName)) {
+        std::ofstream out(fileName, std::ios::binary);
+        out << header.format();
+        out.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(numberOfBytes));
+        if (!out) {
+            throw std::runtime_error("Failed to write " + fileName + ".");
+        }
+        return;
+    }
+
+    std::fstream file(fileName, std::ios::binary | std::ios::in | std::ios::out);
+    char existingHeaderBytes[NpyHeader::SIZE];
+    file.read(existingHeaderBytes, NpyHeader::SIZE);
+    auto[existingHeader, offset] = NpyHeader::parse(existingHeaderBytes, file.gcount());
+    if (offset != NpyHeader::SIZE || existingHeader.descr != header.descr ||
+        existingHeader.shape.size() != shape.size() ||
+        !std::equal(shape.begin() + 1, shape.end(), existingHeader.shape.begin() + 1)) {
+        throw std::runtime_error("Records do not match the existing file " + fileName + ".");
+    }
+    // Writes the records before updating the shape, so an interrupted write leaves a valid file.
+    file.seekp(0, std::ios::end);
+    file.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(numberOfBytes));
+    file.flush();
+    existingHeader.shape[0] += shape[0];
+    file.seekp(0);
+    file << existingHeader.format();
+    if (!file) {
+        throw std::runtime_error("Failed to append to " + fileName + ".");
+    }
+}
+
+void hops::NpyWriter::write(const std::string &description, const std::vector<float> &records) const {
+    append(description, records.data(), {records.size()});
+}
+
+void hops::NpyWriter::write(const std::string &description, const std::vector<double> &records) const {
+    append(description, records.data(), {records.size()});
+}
+
+void hops::NpyWriter::write(const std::string &description, const std::vector<long> &records) const {
+    append(description, records.data(), {records.size()});
+}
+
+void hops::NpyWriter::write(const std::string &description, const std::vector<Eigen::VectorXf> &records) const {
+    if (!records.empty()) {
+        append(description, toRows(records, description).data(),
+               {records.size(), static_cast<std::uint64_t>(records.front().rows())});
+    }
+}
+
+void hops::NpyWriter::write(const std::string &description, const std::vector<Eigen::VectorXd> &records) const {
+    if (!records.empty()) {
+        append(description, toRows(records, description).data(),
+               {records.size(), static_cast<std::uint64_t>(records.front().rows())});
+    }
+}
+
+void hops::NpyWriter::write(const std::string &description,
+                            const std::vector<Eigen::Matrix<std::uint16_t, Eigen::Dynamic, 1>> &records) const {
+    if (!records.empty()) {
+        append(description, toRows(records, description).data(),
+               {records.size(), static_cast<std::uint64_t>(records.front().rows())});
+    }
+}
+
+void hops::NpyWriter::write(const std::string &description, const std::vector<std::string> &records) const {
+    fs::path fileName(getFileName(description));
+    std::ofstream out(fileName.replace_extension(".txt"), std::ios_base::app);
+    for (const auto &record: records) {
+        out << record << "\n";
+    }
+}
+
+void hops::NpyWriter::write(const std::string &description, const Eigen::MatrixXd &matrix) const {
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> rows = matrix;
+    append(description, rows.data(),
+           {static_cast<std::uint64_t>(matrix.rows()), static_cast<std::uint64_t>(matrix.cols())});
+}
+
+void hops::NpyWriter::write(const std::string &description, const Eigen::VectorXd &vector) const {
+    append(description, vector.data(), {static_cast<std::uint64_t>(vector.rows())});
+}
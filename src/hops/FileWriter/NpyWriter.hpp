@@ -0,0 +1,49 @@
+#ifndef HOPS_NPYWRITER_HPP
+#define HOPS_NPYWRITER_HPP
+
+#include <cstdint>
+#include <string>
+
+#include "FileWriter.hpp"
+
+namespace hops {
+    /**
+     * @brief Writes records as raw binary arrays in the .npy format, which numpy and the NpyReader can memory-map.
+     * @details Like the CsvWriter, every description is written to its own file "<path>/<name>_<description>.npy"
+     * and repeated writes append. Vector records and matrices are stored with one record or matrix row per row.
+     * String records have no npy representation, so they are written as lines to "<path>/<name>_<description>.txt".
+     */
+    class NpyWriter : public FileWriter {
+    public:
+        explicit NpyWriter(std::string path);
+
+        void write(const std::string &description, const std::vector<float> &records) const override;
+
+        void write(const std::string &description, const std::vector<double> &records) const override;
+
+        void write(const std::string &description, const std::vector<long> &records) const override;
+
+        void write(const std::string &description, const std::vector<Eigen::VectorXf> &records) const override;
+
+        void write(const std::string &description, const std::vector<Eigen::VectorXd> &records) const override;
+
+        void write(const std::string &description, const std::vector<std::string> &records) const override;
+
+        void write(const std::string &description,
+                   const std::vector<Eigen::Matrix<std::uint16_t, Eigen::Dynamic, 1>> &records) const override;
+
+        void write(const std::string &description, const Eigen::MatrixXd &matrix) const override;
+
+        void write(const std::string &description, const Eigen::VectorXd &vector) const override;
+
+        [[nodiscard]] std::string getFileName(const std::string &description) const;
+
+    private:
+        template<typename Scalar>
+        void append(const std::string &description, const Scalar *data, std::vector<std::uint64_t> shape) const;
+
+        std::string m_path;
+    };
+}
+
+#endif //HOPS_NPYWRITER_HPP
@@ -0,0 +1,47 @@
+#ifndef HOPS_POLYTOPEBUNDLEFORMAT_HPP
+#define HOPS_POLYTOPEBUNDLEFORMAT_HPP
+
+#include <cstdint>
+
+namespace hops::internal {
+    /**
+     * @brief Layout of polytope bundles, which store A, b, transformation, shift, starting point and dimension names
+     * of a polytope in a single binary file.
+     * @details The file starts with the magic bytes and the Header. It is followed by the sections in the order
+     * A, b, transformation, shift, starting point and dimension names. Every section starts with its SectionHeader
+     * and every array is padded to ALIGNMENT bytes, so mapped arrays can be used without copying.
+     * Dense matrices are stored column-major. Sparse matrices are stored in compressed column-major format as outer
+     * indices, inner indices and values. Absent sections have zero rows and columns. Values are stored in the native
+     * representation of the machine.
+     */
+    struct PolytopeBundleFormat {
+        static constexpr char MAGIC[8] = {'H', 'O', 'P', 'S', 'P', 'B', 'D', 'L'};
+        static constexpr std::uint32_t VERSION = 1;
+        static constexpr std::uint64_t ALIGNMENT = 8;
+
+        enum Flags : std::uint32_t {
+            SPARSE_A = 1,
+        };
+
+        struct Header {
+            std::uint32_t version;
+            std::uint32_t flags;
+        };
+
+        struct SectionHeader {
+            std::uint64_t rows;
+            std::uint64_t cols;
+            /**
+             * @brief number of stored values, i.e. the number of non-zeros for sparse matrices and the number of
+             * characters of all names for the dimension names.
+             */
+            std::uint64_t size;
+        };
+
+        static constexpr std::uint64_t pad(std::uint64_t numberOfBytes) {
+            return (numberOfBytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+        }
+    };
+}
+
+#endif //HOPS_POLYTOPEBUNDLEFORMAT_HPP
@@ -0,0 +1,102 @@
+#include <Eigen/Sparse>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+
+#include "PolytopeBundleFormat.hpp"
+#include "PolytopeBundleWriter.hpp"
+
+namespace {
+    using Format = hops::internal::PolytopeBundleFormat;
+
+    template<typename T>
+    void writeArray(std::ostream &out, const T *data, std::uint64_t numberOfElements) {
+        std::uint64_t numberOfBytes = numberOfElements * sizeof(T);
+        out.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(numberOfBytes));
+        const char padding[Format::ALIGNMENT] = {};
+        out.write(padding, static_cast<std::streamsize>(Format::pad(numberOfBytes) - numberOfBytes));
+    }
+
+    void writeSectionHeader(std::ostream &out, std::uint64_t rows, std::uint64_t cols, std::uint64_t size) {
+        Format::SectionHeader header{rows, cols, size};
+        writeArray(out, &header, 1);
+    }
+
+    template<typename Derived>
+    void writeDense(std::ostream &out, const Eigen::PlainObjectBase<Derived> &matrix) {
+        writeSectionHeader(out, matrix.rows(), matrix.cols(), matrix.size());
+        writeArray(out, matrix.data(), matrix.size());
+    }
+
+    void writeSparse(std::ostream &out, const Eigen::SparseMatrix<double> &matrix) {
+        Eigen::SparseMatrix<double, Eigen::ColMajor, int> compressedMatrix = matrix;
+        compressedMatrix.makeCompressed();
+        writeSectionHeader(out, compressedMatrix.rows(), compressedMatrix.cols(), compressedMatrix.nonZeros());
+        writeArray(out, compressedMatrix.outerIndexPtr(), compressedMatrix.cols() + 1);
+        writeArray(out, compressedMatrix.innerIndexPtr(), compressedMatrix.nonZeros());
+        writeArray(out, compressedMatrix.valuePtr(), compressedMatrix.nonZeros());
+    }
+
+    void writeNames(std::ostream &out, const std::vector<std::string> &names) {
+        std::vector<std::uint64_t> lengths;
+        std::string characters;
+        for (const auto &name: names) {
+            lengths.push_back(name.size());
+            characters += name;
+        }
+        writeSectionHeader(out, names.size(), names.empty() ? 0 : 1, characters.size());
+        writeArray(out, lengths.data(), lengths.size());
+        writeArray(out, characters.data(), characters.size());
+    }
+}
+
+template<typename MatrixType>
+void hops::PolytopeBundleWriter::write(const std::string &file,
+                                       const MatrixType &A,
+                                       const Eigen::VectorXd &b,
+                                       const Eigen::MatrixXd &transformation,
+                                       const Eigen::VectorXd &shift,
+                                       const Eigen::VectorXd &startingPoint,
+                                       const std::vector<std::string> &dimensionNames) {
+    if (A.rows() != b.rows()) {
+        throw std::invalid_argument("A and b have different numbers of rows.");
+    }
+    std::ofstream out(file, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Failed to open " + file + ".");
+    }
+    constexpr bool isSparse = std::is_base_of_v<Eigen::SparseMatrixBase<MatrixType>, MatrixType>;
+    Format::Header header{Format::VERSION, isSparse ? Format::SPARSE_A : 0u};
+    out.write(Format::MAGIC, sizeof(Format::MAGIC));
+    writeArray(out, &header, 1);
+
+    if constexpr (isSparse) {
+        writeSparse(out, A);
+    } else {
+        writeDense(out, A);
+    }
+    writeDense(out, b);
+    writeDense(out, transformation);
+    writeDense(out, shift);
+    writeDense(out, startingPoint);
+    writeNames(out, dimensionNames);
+    if (!out) {
+        throw std::runtime_error("Failed to write " + file + ".");
+    }
+}
+
+template void hops::PolytopeBundleWriter::write(const std::string &file,
+                                                const Eigen::MatrixXd &A,
+                                                const Eigen::VectorXd &b,
+                                                const Eigen::MatrixXd &transformation,
+                                                const Eigen::VectorXd &shift,
+                                                const Eigen::VectorXd &startingPoint,
+                                                const std::vector<std::string> &dimensionNames);
+
+template void hops::PolytopeBundleWriter::write(const std::string &file,
+                                                const Eigen::SparseMatrix<double> &A,
+                                                const Eigen::VectorXd &b,
+                                                const Eigen::MatrixXd &transformation,
+                                                const Eigen::VectorXd &shift,
+                                                const Eigen::VectorXd &startingPoint,
+                                                const std::vector<std::string> &dimensionNames);
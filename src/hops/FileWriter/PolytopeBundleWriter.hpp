@@ -0,0 +1,32 @@
+#ifndef HOPS_POLYTOPEBUNDLEWRITER_HPP
+#define HOPS_POLYTOPEBUNDLEWRITER_HPP
+
+#include <Eigen/Core>
+#include <string>
+#include <vector>
+
+namespace hops {
+    /**
+     * @brief Writes A, b, transformation, shift, starting point and dimension names of a polytope into a single binary
+     * file, which can be memory-mapped by the PolytopeBundleReader.
+     */
+    class PolytopeBundleWriter {
+    public:
+        PolytopeBundleWriter() = delete;
+
+        /**
+         * @tparam MatrixType Eigen::MatrixXd or Eigen::SparseMatrix<double>, determines how A is stored.
+         * @param transformation, shift, startingPoint and dimensionNames are optional and omitted if empty.
+         */
+        template<typename MatrixType>
+        static void write(const std::string &file,
+                          const MatrixType &A,
+                          const Eigen::VectorXd &b,
+                          const Eigen::MatrixXd &transformation = Eigen::MatrixXd(),
+                          const Eigen::VectorXd &shift = Eigen::VectorXd(),
+                          const Eigen::VectorXd &startingPoint = Eigen::VectorXd(),
+                          const std::vector<std::string> &dimensionNames = {});
+    };
+}
+
+#endif //HOPS_POLYTOPEBUNDLEWRITER_HPP
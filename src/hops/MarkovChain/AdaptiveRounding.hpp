@@ -0,0 +1,326 @@
+#ifndef HOPS_ADAPTIVEROUNDING_HPP
+#define HOPS_ADAPTIVEROUNDING_HPP
+
+#include <Eigen/Cholesky>
+#include <Eigen/Eigenvalues>
+#include <any>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "hops/MarkovChain/Proposal/Proposal.hpp"
+#include "hops/MarkovChain/StateTransformation.hpp"
+#include "hops/Transformation/LinearTransformation.hpp"
+#include "hops/Utility/BinarySerialization.hpp"
+#include "hops/Utility/MatrixType.hpp"
+#include "hops/Utility/VectorType.hpp"
+
+namespace hops {
+    /**
+     * @brief Mixin, which rounds the polytope of a proposal on the fly from the sample covariance of the chain.
+     * @details Every roundingInterval steps, the sample covariance C of the states of the last roundingInterval
+     * steps is factorized as C = LL^T. The proposal is then recreated on the rounded polytope AL y <= b - As with
+     * state y = L^-1 (x - s), where s is the sample mean, and wrapped into a StateTransformation, such that states are
+     * still returned in the original coordinates. This is the iterative rounding of CHRR, built into the chain.
+     *
+     * Rounding stops once the condition number of the sample covariance in rounded coordinates changes by less than
+     * the relative tolerance between two consecutive roundings, or after maximumNumberOfRoundings roundings.
+     * Changing the rounding adapts the chain, so only states drawn after rounding stopped should be used as samples.
+     *
+     * Likelihoods of mixed in models are invariant under the rounding, because the Jacobian of the transformation is
+     * constant. The step size of the proposal and the dimension names are carried over to recreated proposals, other
+     * parameters are not.
+     * @tparam ProposalImpl proposal without likelihood
+     */
+    template<typename ProposalImpl>
+    class AdaptiveRounding : public Proposal {
+    public:
+        using ProposalFactory = std::function<ProposalImpl(const MatrixType &A, const VectorType &b,
+                                                           const VectorType &state)>;
+
+        /**
+         * @param proposal proposal on the original polytope, which has to be constructible from (A, b, state).
+         * @param roundingInterval number of steps between two roundings.
+         * @param relativeTolerance of the condition number, at which rounding stops.
+         * @param maximumNumberOfRoundings
+         */
+        explicit AdaptiveRounding(const ProposalImpl &proposal,
+                                  long roundingInterval = 1000,
+                                  double relativeTolerance = 0.1,
+                                  long maximumNumberOfRoundings = 20) :
+                AdaptiveRounding(proposal,
+                                 [](const MatrixType &A, const VectorType &b, const VectorType &state) {
+                                     return ProposalImpl(A, b, state);
+                                 },
+                                 roundingInterval,
+                                 relativeTolerance,
+                                 maximumNumberOfRoundings) {}
+
+        /**
+         * @param proposal proposal on the original polytope.
+         * @param proposalFactory recreates the proposal on the rounded polytope.
+         * @param roundingInterval number of steps between two roundings.
+         * @param relativeTolerance of the condition number, at which rounding stops.
+         * @param maximumNumberOfRoundings
+         */
+        AdaptiveRounding(const ProposalImpl &proposal,
+                         ProposalFactory proposalFactory,
+                         long roundingInterval = 1000,
+                         double relativeTolerance = 0.1,
+                         long maximumNumberOfRoundings = 20) :
+                A(proposal.getA()),
+                b(proposal.getB()),
+                proposalFactory(std::move(proposalFactory)),
+                roundingInterval(roundingInterval),
+                relativeTolerance(relativeTolerance),
+                maximumNumberOfRoundings(maximumNumberOfRoundings) {
+            if (proposal.hasNegativeLogLikelihood()) {
+                throw std::invalid_argument("AdaptiveRounding requires a proposal without likelihood, because "
+                                            "likelihoods are mixed in on the original coordinates.");
+            }
+            if (roundingInterval <= A.cols()) {
+                throw std::invalid_argument("Rounding interval has to be larger than the dimension.");
+            }
+            long dimension = A.cols();
+            roundedProposal.emplace(proposal, LinearTransformation(MatrixType::Identity(dimension, dimension),
+                                                                   VectorType::Zero(dimension)));
+            roundingTransformation = LinearTransformation(MatrixType::Identity(dimension, dimension),
+                                                          VectorType::Zero(dimension));
+            samples.resize(dimension, roundingInterval);
+        }
+
+        VectorType &propose(RandomNumberGenerator &rng) override {
+            recordState();
+            return roundedProposal->propose(rng);
+        }
+
+        VectorType &propose(RandomNumberGenerator &rng, const VectorType &activeSubspace) override {
+            recordState();
+            return roundedProposal->propose(rng, activeSubspace);
+        }
+
+        double computeLogAcceptanceProbability() override {
+            return roundedProposal->computeLogAcceptanceProbability();
+        }
+
+        VectorType &acceptProposal() override {
+            return roundedProposal->acceptProposal();
+        }
+
+        void setState(const VectorType &state) override {
+            roundedProposal->setState(state);
+        }
+
+        void setProposal(const VectorType &proposal) override {
+            roundedProposal->setProposal(proposal);
+        }
+
+        [[nodiscard]] VectorType getState() const override {
+            return roundedProposal->getState();
+        }
+
+        void copyStateTo(Eigen::Ref<VectorType> destination) const override {
+            roundedProposal->copyStateTo(destination);
+        }
+
+        [[nodiscard]] VectorType getProposal() const override {
+            return roundedProposal->getProposal();
+        }
+
+        void copyProposalTo(Eigen::Ref<VectorType> destination) const override {
+            roundedProposal->copyProposalTo(destination);
+        }
+
+        void setDimensionNames(const std::vector<std::string> &names) override {
+            roundedProposal->setDimensionNames(names);
+        }
+
+        [[nodiscard]] std::vector<std::string> getDimensionNames() const override {
+            return roundedProposal->getDimensionNames();
+        }
+
+        [[nodiscard]] std::vector<std::string> getParameterNames() const override {
+            return roundedProposal->getParameterNames();
+        }
+
+        [[nodiscard]] std::any getParameter(const ProposalParameter &parameter) const override {
+            return roundedProposal->getParameter(parameter);
+        }
+
+        [[nodiscard]] std::string getParameterType(const ProposalParameter &parameter) const override {
+            return roundedProposal->getParameterType(parameter);
+        }
+
+        void setParameter(const ProposalParameter &parameter, const std::any &value) override {
+            roundedProposal->setParameter(parameter, value);
+        }
+
+        [[nodiscard]] std::optional<double> getStepSize() const override {
+            return roundedProposal->getStepSize();
+        }
+
+        [[nodiscard]] std::string getProposalName() const override {
+            return roundedProposal->getProposalName() + " + adaptive rounding";
+        }
+
+        /**
+         * @return the inequality lhs of the original polytope
+         */
+        [[nodiscard]] const MatrixType &getA() const override {
+            return A;
+        }
+
+        /**
+         * @return the inequality rhs of the original polytope
+         */
+        [[nodiscard]] const VectorType &getB() const override {
+            return b;
+        }
+
+        [[nodiscard]] std::unique_ptr<Proposal> copyProposal() const override {
+            return std::make_unique<AdaptiveRounding>(*this);
+        }
+
+        [[nodiscard]] bool isSymmetric() const override {
+            return roundedProposal->isSymmetric();
+        }
+
+        void resetDistributions() override {
+            roundedProposal->resetDistributions();
+        }
+
+        void serialize(std::ostream &out) const override {
+            BinarySerialization::writeAll(out, rounding, numberOfRoundings, conditionNumbers,
+                                          roundingTransformation.getMatrix(), roundingTransformation.getShift(),
+                                          MatrixType(samples.leftCols(numberOfSamples)));
+            roundedProposal->serialize(out);
+        }
+
+        void deserialize(std::istream &in) override {
+            MatrixType roundingMatrix;
+            VectorType roundingShift;
+            MatrixType recordedSamples;
+            BinarySerialization::readAll(in, rounding, numberOfRoundings, conditionNumbers, roundingMatrix,
+                                         roundingShift, recordedSamples);
+            numberOfSamples = recordedSamples.cols();
+            samples.leftCols(numberOfSamples) = recordedSamples;
+
+            // Recreates the proposal on the stored rounding from any interior point and restores its state afterwards.
+            VectorType state = roundedProposal->getState();
+            roundingTransformation = LinearTransformation(roundingMatrix, roundingShift);
+            roundedProposal.emplace(proposalFactory(A * roundingMatrix,
+                                                    b - A * roundingShift,
+                                                    roundingTransformation.revert(state)),
+                                    roundingTransformation);
+            roundedProposal->deserialize(in);
+        }
+
+        /**
+         * @return whether the rounding is still adapted.
+         */
+        [[nodiscard]] bool isRounding() const {
+            return rounding;
+        }
+
+        /**
+         * @brief Stops adapting the rounding, e.g. at the end of warm-up.
+         */
+        void stopRounding() {
+            rounding = false;
+        }
+
+        [[nodiscard]] long getNumberOfRoundings() const {
+            return numberOfRoundings;
+        }
+
+        /**
+         * @return the condition numbers of the sample covariances in rounded coordinates, one per rounding.
+         */
+        [[nodiscard]] const std::vector<double> &getConditionNumbers() const {
+            return conditionNumbers;
+        }
+
+        /**
+         * @return transformation from rounded to original coordinates.
+         */
+        [[nodiscard]] const LinearTransformation &getRoundingTransformation() const {
+            return roundingTransformation;
+        }
+
+    private:
+        void recordState() {
+            if (!rounding) {
+                return;
+            }
+            roundedProposal->copyStateTo(samples.col(numberOfSamples++));
+            if (numberOfSamples == roundingInterval) {
+                round();
+                numberOfSamples = 0;
+            }
+        }
+
+        void round() {
+            VectorType mean = samples.rowwise().mean();
+            MatrixType centeredSamples = samples.colwise() - mean;
+            MatrixType covariance = centeredSamples * centeredSamples.transpose() / (roundingInterval - 1);
+            Eigen::LLT<MatrixType> solver(covariance);
+            if (solver.info() != Eigen::Success) {
+                // The chain has not explored all dimensions yet.
+                return;
+            }
+
+            // Sample covariance in the coordinates of the current rounding
+            const MatrixType &currentMatrix = roundingTransformation.getMatrix();
+            MatrixType roundedCovariance = currentMatrix.template triangularView<Eigen::Lower>().solve(covariance);
+            roundedCovariance = currentMatrix.template triangularView<Eigen::Lower>().solve(
+                    roundedCovariance.transpose()).transpose();
+            Eigen::SelfAdjointEigenSolver<MatrixType> eigenSolver(roundedCovariance, Eigen::EigenvaluesOnly);
+            double conditionNumber = eigenSolver.eigenvalues().maxCoeff() / eigenSolver.eigenvalues().minCoeff();
+            bool isConditionNumberStable = !conditionNumbers.empty() &&
+                                           std::abs(conditionNumber - conditionNumbers.back()) <
+                                           relativeTolerance * conditionNumbers.back();
+            conditionNumbers.emplace_back(conditionNumber);
+
+            VectorType state = roundedProposal->getState();
+            std::optional<double> stepSize = roundedProposal->getStepSize();
+            std::vector<std::string> dimensionNames = roundedProposal->getDimensionNames();
+
+            roundingTransformation = LinearTransformation(MatrixType(solver.matrixL()), mean);
+            ProposalImpl proposal = proposalFactory(A * roundingTransformation.getMatrix(),
+                                                    b - A * mean,
+                                                    roundingTransformation.revert(state));
+            if (stepSize) {
+                proposal.setParameter(ProposalParameter::STEP_SIZE, stepSize.value());
+            }
+            proposal.setDimensionNames(dimensionNames);
+            roundedProposal.emplace(proposal, roundingTransformation);
+            ++numberOfRoundings;
+
+            if (isConditionNumberStable || numberOfRoundings >= maximumNumberOfRoundings) {
+                rounding = false;
+            }
+        }
+
+        MatrixType A;
+        VectorType b;
+        ProposalFactory proposalFactory;
+        long roundingInterval;
+        double relativeTolerance;
+        long maximumNumberOfRoundings;
+
+        bool rounding = true;
+        long numberOfRoundings = 0;
+        std::vector<double> conditionNumbers;
+        LinearTransformation roundingTransformation;
+        std::optional<StateTransformation<ProposalImpl, LinearTransformation>> roundedProposal;
+        MatrixType samples;
+        long numberOfSamples = 0;
+    };
+}
+
+#endif //HOPS_ADAPTIVEROUNDING_HPP
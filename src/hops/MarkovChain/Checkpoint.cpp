@@ -0,0 +1,117 @@
+#include "Checkpoint.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include "hops/Utility/BinarySerialization.hpp"
+
+namespace {
+    constexpr char MAGIC[] = {'H', 'O', 'P', 'S', 'C', 'K', 'P', 'T'};
+}
+
+void hops::Checkpoint::write(std::ostream &out,
+                             const std::vector<const MarkovChain *> &markovChains,
+                             const std::vector<RandomNumberGenerator> &randomNumberGenerators) {
+    if (markovChains.size() != randomNumberGenerators.size()) {
+        throw std::invalid_argument("Every Markov chain requires a random number generator.");
+    }
+    std::ostringstream payload(std::ios::binary);
+    BinarySerialization::write(payload, static_cast<std::uint64_t>(markovChains.size()));
+    for (size_t chain = 0; chain < markovChains.size(); ++chain) {
+        randomNumberGenerators[chain].serialize(payload);
+        BinarySerialization::write(payload, static_cast<std::int64_t>(markovChains[chain]->getState().rows()));
+        markovChains[chain]->serialize(payload);
+    }
+
+    // The payload is written at once behind its size, so truncated checkpoints are detected when reading.
+    std::string bytes = payload.str();
+    out.write(MAGIC, sizeof(MAGIC));
+    BinarySerialization::writeAll(out, FORMAT_VERSION, static_cast<std::uint64_t>(bytes.size()));
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    if (!out) {
+        throw std::runtime_error("Failed to write checkpoint.");
+    }
+}
+
+void hops::Checkpoint::read(std::istream &in,
+                            const std::vector<MarkovChain *> &markovChains,
+                            std::vector<RandomNumberGenerator> &randomNumberGenerators) {
+    char magic[sizeof(MAGIC)];
+    in.read(magic, sizeof(magic));
+    if (!in || !std::equal(magic, magic + sizeof(magic), MAGIC)) {
+        throw std::runtime_error("Stream does not contain a hops checkpoint.");
+    }
+    std::uint32_t formatVersion;
+    std::uint64_t payloadSize;
+    BinarySerialization::readAll(in, formatVersion, payloadSize);
+    if (formatVersion != FORMAT_VERSION) {
+        throw std::runtime_error("Checkpoint has format version " + std::to_string(formatVersion) +
+                                 ", but only version " + std::to_string(FORMAT_VERSION) + " is supported.");
+    }
+    std::string bytes(payloadSize, '\0');
+    in.read(bytes.data(), static_cast<std::streamsize>(payloadSize));
+    if (!in) {
+        throw std::runtime_error("Checkpoint is truncated.");
+    }
+
+    std::istringstream payload(bytes, std::ios::binary);
+    std::uint64_t numberOfMarkovChains;
+    BinarySerialization::read(payload, numberOfMarkovChains);
+    if (numberOfMarkovChains != markovChains.size()) {
+        throw std::runtime_error("Checkpoint contains " + std::to_string(numberOfMarkovChains) +
+                                 " Markov chains, but " + std::to_string(markovChains.size()) + " were given.");
+    }
+    randomNumberGenerators.clear();
+    for (size_t chain = 0; chain < markovChains.size(); ++chain) {
+        randomNumberGenerators.emplace_back(RandomNumberGenerator::deserialize(payload));
+        std::int64_t dimension;
+        BinarySerialization::read(payload, dimension);
+        if (dimension != markovChains[chain]->getState().rows()) {
+            throw std::runtime_error("Dimension of Markov chain " + std::to_string(chain) +
+                                     " does not match the checkpoint.");
+        }
+        markovChains[chain]->deserialize(payload);
+    }
+    if (payload.peek() != std::char_traits<char>::eof()) {
+        throw std::runtime_error("Checkpoint does not match the Markov chains.");
+    }
+}
+
+void hops::Checkpoint::write(std::ostream &out,
+                             const MarkovChain &markovChain,
+                             const RandomNumberGenerator &randomNumberGenerator) {
+    write(out, std::vector<const MarkovChain *>{&markovChain}, {randomNumberGenerator});
+}
+
+void hops::Checkpoint::read(std::istream &in, MarkovChain &markovChain, RandomNumberGenerator &randomNumberGenerator) {
+    std::vector<RandomNumberGenerator> randomNumberGenerators;
+    read(in, std::vector<MarkovChain *>{&markovChain}, randomNumberGenerators);
+    randomNumberGenerator = randomNumberGenerators.front();
+}
+
+void hops::Checkpoint::writeFile(const std::string &fileName,
+                                 const std::vector<const MarkovChain *> &markovChains,
+                                 const std::vector<RandomNumberGenerator> &randomNumberGenerators) {
+    std::string temporaryFileName = fileName + ".tmp";
+    {
+        std::ofstream out(temporaryFileName, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            throw std::runtime_error("Failed to open " + temporaryFileName + ".");
+        }
+        write(out, markovChains, randomNumberGenerators);
+    }
+    std::filesystem::rename(temporaryFileName, fileName);
+}
+
+void hops::Checkpoint::readFile(const std::string &fileName,
+                                const std::vector<MarkovChain *> &markovChains,
+                                std::vector<RandomNumberGenerator> &randomNumberGenerators) {
+    std::ifstream in(fileName, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("Failed to open " + fileName + ".");
+    }
+    read(in, markovChains, randomNumberGenerators);
+}
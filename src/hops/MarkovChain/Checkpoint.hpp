@@ -0,0 +1,60 @@
+#ifndef HOPS_CHECKPOINT_HPP
+#define HOPS_CHECKPOINT_HPP
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "hops/MarkovChain/MarkovChain.hpp"
+#include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
+
+namespace hops {
+    /**
+     * @brief Versioned binary checkpoint of Markov chains and their random number generators.
+     * @details A checkpoint consists of the magic bytes "HOPSCKPT", the format version, the size of the payload and the
+     * payload. The payload holds the number of chains and, for every chain, its random number generator, the dimension
+     * of its state and the serialized chain, see MarkovChain::serialize.
+     *
+     * Chains continue bitwise identically after reading a checkpoint. Construction arguments like the polytope or the
+     * model are not part of the checkpoint, so the chains have to be constructed with the same arguments before reading
+     * into them.
+     */
+    class Checkpoint {
+    public:
+        static constexpr std::uint32_t FORMAT_VERSION = 1;
+
+        static void write(std::ostream &out,
+                          const std::vector<const MarkovChain *> &markovChains,
+                          const std::vector<RandomNumberGenerator> &randomNumberGenerators);
+
+        /**
+         * @throws std::runtime_error if the checkpoint is truncated, has an unsupported format version or does not
+         * match the chains.
+         */
+        static void read(std::istream &in,
+                         const std::vector<MarkovChain *> &markovChains,
+                         std::vector<RandomNumberGenerator> &randomNumberGenerators);
+
+        static void write(std::ostream &out,
+                          const MarkovChain &markovChain,
+                          const RandomNumberGenerator &randomNumberGenerator);
+
+        static void read(std::istream &in, MarkovChain &markovChain, RandomNumberGenerator &randomNumberGenerator);
+
+        /**
+         * @brief Writes the checkpoint to a temporary file and renames it to fileName afterwards, such that a job,
+         * which is killed while writing, leaves the previous checkpoint intact.
+         */
+        static void writeFile(const std::string &fileName,
+                              const std::vector<const MarkovChain *> &markovChains,
+                              const std::vector<RandomNumberGenerator> &randomNumberGenerators);
+
+        static void readFile(const std::string &fileName,
+                             const std::vector<MarkovChain *> &markovChains,
+                             std::vector<RandomNumberGenerator> &randomNumberGenerators);
+    };
+}
+
+#endif //HOPS_CHECKPOINT_HPP
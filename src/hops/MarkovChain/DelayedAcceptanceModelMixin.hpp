@@ -0,0 +1,348 @@
+#ifndef HOPS_DELAYEDACCEPTANCEMODELMIXIN_HPP
+#define HOPS_DELAYEDACCEPTANCEMODELMIXIN_HPP
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <stdexcept>
+
+#include "hops/MarkovChain/Proposal/Proposal.hpp"
+#include "hops/Model/GaussianProcessSurrogate.hpp"
+#include "hops/Model/Model.hpp"
+#include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
+#include "hops/Utility/VectorType.hpp"
+
+namespace hops {
+    /**
+     * @brief Mixin to add a model likelihood with delayed acceptance (Christen & Fox 2005, DOI: 10.1198/106186005X76983)
+     * to computeLogAcceptanceRate().
+     * @details Proposals are first screened with a cheap surrogate model. The expensive model is only evaluated for
+     * proposals, which pass the first stage. The second stage corrects for the error of the surrogate, such that the
+     * chain still targets the exact posterior. The uniform number of the first stage is drawn in propose, the
+     * second stage is the usual Metropolis-Hastings test, e.g. from the MetropolisHastingsFilter.
+     *
+     * If the surrogate is a GaussianProcessSurrogate, it is fitted online to every evaluation of the expensive
+     * model. The surrogate only changes between transitions and stops changing once the Gaussian process is full.
+     * @tparam ProposalType
+     * @tparam ModelType
+     */
+    template<typename ProposalType, typename ModelType>
+    class DelayedAcceptanceModelMixin : public Proposal, public ModelType {
+    public:
+        /**
+         * @param proposal
+         * @param model expensive model
+         * @param surrogate cheap approximation of the model, by default a GaussianProcessSurrogate.
+         * @param coldness
+         */
+        DelayedAcceptanceModelMixin(const ProposalType &proposal,
+                                    const ModelType &model,
+                                    std::unique_ptr<Model> surrogate = std::make_unique<GaussianProcessSurrogate>(),
+                                    double coldness = 1.) :
+                ModelType(model),
+                proposal(proposal),
+                surrogate(std::move(surrogate)),
+                coldness(coldness) {
+            if (proposal.hasNegativeLogLikelihood()) {
+                throw std::invalid_argument("Can't mix in model with ProposalType that already has likelihood.");
+            }
+            if (!this->surrogate) {
+                throw std::invalid_argument("Surrogate model is required for delayed acceptance.");
+            }
+            gaussianProcessSurrogate = dynamic_cast<GaussianProcessSurrogate *>(this->surrogate.get());
+            proposalNegativeLogLikelihood = 0;
+            stateNegativeLogLikelihood = ModelType::computeNegativeLogLikelihood(this->proposal.getState());
+            std::vector<std::string> modelDimensionNames = ModelType::getDimensionNames();
+            if (!modelDimensionNames.empty()) {
+                // If the model does provide dimension names, update the proposal dimension names
+                this->proposal.setDimensionNames(modelDimensionNames);
+            }
+        }
+
+        DelayedAcceptanceModelMixin(const DelayedAcceptanceModelMixin &other) :
+                ModelType(other),
+                proposal(other.proposal),
+                surrogate(other.surrogate->copyModel()),
+                gaussianProcessSurrogate(dynamic_cast<GaussianProcessSurrogate *>(surrogate.get())),
+                coldness(other.coldness),
+                logStageOneUniform(other.logStageOneUniform),
+                proposalNegativeLogLikelihood(other.proposalNegativeLogLikelihood),
+                stateNegativeLogLikelihood(other.stateNegativeLogLikelihood),
+                numberOfProposals(other.numberOfProposals),
+                numberOfModelEvaluations(other.numberOfModelEvaluations) {}
+
+        VectorType &propose(RandomNumberGenerator &rng) override;
+
+        VectorType &propose(RandomNumberGenerator &rng, const Eigen::VectorXd &activeIndices) override;
+
+        double computeLogAcceptanceProbability() override;
+
+        VectorType &acceptProposal() override;
+
+        void setState(const VectorType &state) override;
+
+        void setProposal(const VectorType &proposal) override;
+
+        [[nodiscard]] VectorType getState() const override;
+
+        void copyStateTo(Eigen::Ref<VectorType> destination) const override;
+
+        [[nodiscard]] VectorType getProposal() const override;
+
+        void copyProposalTo(Eigen::Ref<VectorType> destination) const override;
+
+        [[nodiscard]] std::optional<double> getStepSize() const override;
+
+        [[nodiscard]] double getStateNegativeLogLikelihood() override;
+
+        [[nodiscard]] double getProposalNegativeLogLikelihood() override;
+
+        [[nodiscard]] bool hasNegativeLogLikelihood() const override;
+
+        [[nodiscard]] std::vector<std::string> getParameterNames() const override;
+
+        [[nodiscard]] std::any getParameter(const ProposalParameter &parameter) const override;
+
+        [[nodiscard]] std::string getParameterType(const ProposalParameter &parameter) const override;
+
+        void setParameter(const ProposalParameter &parameter, const std::any &value) override;
+
+        [[nodiscard]] std::string getProposalName() const override;
+
+        [[nodiscard]] const MatrixType &getA() const override;
+
+        [[nodiscard]] const VectorType &getB() const override;
+
+        void setDimensionNames(const std::vector<std::string> &names) override;
+
+        [[nodiscard]] std::vector<std::string> getDimensionNames() const override;
+
+        [[nodiscard]] std::unique_ptr<Proposal> copyProposal() const override;
+
+        [[nodiscard]] bool isSymmetric() const override;
+
+        void resetDistributions() override;
+
+        /**
+         * @return number of proposals, which were screened by the surrogate.
+         */
+        [[nodiscard]] unsigned long long getNumberOfProposals() const;
+
+        /**
+         * @return number of evaluations of the expensive model during computeLogAcceptanceProbability.
+         */
+        [[nodiscard]] unsigned long long getNumberOfModelEvaluations() const;
+
+        [[nodiscard]] const Model &getSurrogate() const;
+
+    private:
+        ProposalType proposal;
+        std::unique_ptr<Model> surrogate;
+        GaussianProcessSurrogate *gaussianProcessSurrogate = nullptr;
+        double coldness = 1.;
+        double logStageOneUniform = 0;
+        double proposalNegativeLogLikelihood;
+        double stateNegativeLogLikelihood;
+        unsigned long long numberOfProposals = 0;
+        unsigned long long numberOfModelEvaluations = 0;
+        std::uniform_real_distribution<double> uniformRealDistribution;
+        VectorType proposalWorkspace;
+        VectorType stateWorkspace;
+    };
+
+    template<typename ProposalType, typename ModelType>
+    VectorType &DelayedAcceptanceModelMixin<ProposalType, ModelType>::propose(RandomNumberGenerator &rng) {
+        logStageOneUniform = std::log(uniformRealDistribution(rng));
+        return proposal.propose(rng);
+    }
+
+    template<typename ProposalType, typename ModelType>
+    VectorType &DelayedAcceptanceModelMixin<ProposalType, ModelType>::propose(RandomNumberGenerator &rng,
+                                                                             const Eigen::VectorXd &activeIndices) {
+        logStageOneUniform = std::log(uniformRealDistribution(rng));
+        return proposal.propose(rng, activeIndices);
+    }
+
+    template<typename ProposalType, typename ModelType>
+    double DelayedAcceptanceModelMixin<ProposalType, ModelType>::computeLogAcceptanceProbability() {
+        double acceptanceProbability = proposal.computeLogAcceptanceProbability();
+        if (!std::isfinite(acceptanceProbability)) {
+            return acceptanceProbability;
+        }
+
+        numberOfProposals++;
+        if (proposalWorkspace.rows() == 0) {
+            proposalWorkspace = proposal.getProposal();
+            stateWorkspace = proposal.getState();
+        } else {
+            proposal.copyProposalTo(proposalWorkspace);
+            proposal.copyStateTo(stateWorkspace);
+        }
+        const VectorType &proposalVector = proposalWorkspace;
+        double surrogateLogRatio = coldness * (surrogate->computeNegativeLogLikelihood(stateWorkspace) -
+                                               surrogate->computeNegativeLogLikelihood(proposalVector));
+        if (logStageOneUniform >= std::min(0., acceptanceProbability + surrogateLogRatio)) {
+            return -std::numeric_limits<double>::infinity();
+        }
+
+        proposalNegativeLogLikelihood = ModelType::computeNegativeLogLikelihood(proposalVector);
+        numberOfModelEvaluations++;
+        if (gaussianProcessSurrogate) {
+            gaussianProcessSurrogate->addObservation(proposalVector, proposalNegativeLogLikelihood);
+        }
+
+        return coldness * (stateNegativeLogLikelihood - proposalNegativeLogLikelihood) - surrogateLogRatio;
+    }
+
+    template<typename ProposalType, typename ModelType>
+    VectorType &DelayedAcceptanceModelMixin<ProposalType, ModelType>::acceptProposal() {
+        stateNegativeLogLikelihood = proposalNegativeLogLikelihood;
+        return proposal.acceptProposal();
+    }
+
+    template<typename ProposalType, typename ModelType>
+    void DelayedAcceptanceModelMixin<ProposalType, ModelType>::setState(const VectorType &state) {
+        proposal.setState(state);
+        stateNegativeLogLikelihood = ModelType::computeNegativeLogLikelihood(state);
+    }
+
+    template<typename ProposalType, typename ModelType>
+    VectorType DelayedAcceptanceModelMixin<ProposalType, ModelType>::getState() const {
+        return proposal.getState();
+    }
+
+    template<typename ProposalType, typename ModelType>
+    void DelayedAcceptanceModelMixin<ProposalType, ModelType>::copyStateTo(Eigen::Ref<VectorType> destination) const {
+        proposal.copyStateTo(destination);
+    }
+
+    template<typename ProposalType, typename ModelType>
+    void DelayedAcceptanceModelMixin<ProposalType, ModelType>::setProposal(const VectorType &proposalVector) {
+        proposal.setProposal(proposalVector);
+        proposalNegativeLogLikelihood = ModelType::computeNegativeLogLikelihood(proposalVector);
+    }
+
+    template<typename ProposalType, typename ModelType>
+    VectorType DelayedAcceptanceModelMixin<ProposalType, ModelType>::getProposal() const {
+        return proposal.getProposal();
+    }
+
+    template<typename ProposalType, typename ModelType>
+    void DelayedAcceptanceModelMixin<ProposalType, ModelType>::copyProposalTo(Eigen::Ref<VectorType> destination) const {
+        proposal.copyProposalTo(destination);
+    }
+
+    template<typename ProposalType, typename ModelType>
+    std::vector<std::string> DelayedAcceptanceModelMixin<ProposalType, ModelType>::getParameterNames() const {
+        std::vector<std::string> parameterNames = {"coldness"};
+        std::vector<std::string> proposalParameterNames = proposal.getParameterNames();
+        parameterNames.insert(parameterNames.end(), proposalParameterNames.begin(), proposalParameterNames.end());
+        return parameterNames;
+    }
+
+    template<typename ProposalType, typename ModelType>
+    std::any DelayedAcceptanceModelMixin<ProposalType, ModelType>::getParameter(
+            const ProposalParameter &parameter) const {
+        if (parameter == ProposalParameter::COLDNESS) {
+            return std::any(this->coldness);
+        }
+        return proposal.getParameter(parameter);
+    }
+
+    template<typename ProposalType, typename ModelType>
+    std::string DelayedAcceptanceModelMixin<ProposalType, ModelType>::getParameterType(
+            const ProposalParameter &parameter) const {
+        if (parameter == ProposalParameter::COLDNESS) {
+            return "double";
+        }
+        return proposal.getParameterType(parameter);
+    }
+
+    template<typename ProposalType, typename ModelType>
+    void DelayedAcceptanceModelMixin<ProposalType, ModelType>::setParameter(const ProposalParameter &parameter,
+                                                                           const std::any &value) {
+        if (parameter == ProposalParameter::COLDNESS) {
+            coldness = std::any_cast<double>(value);
+        } else {
+            proposal.setParameter(parameter, value);
+        }
+    }
+
+    template<typename ProposalType, typename ModelType>
+    std::string DelayedAcceptanceModelMixin<ProposalType, ModelType>::getProposalName() const {
+        return proposal.getProposalName() + " + mixed in Model with delayed acceptance";
+    }
+
+    template<typename ProposalType, typename ModelType>
+    const MatrixType &DelayedAcceptanceModelMixin<ProposalType, ModelType>::getA() const {
+        return proposal.getA();
+    }
+
+    template<typename ProposalType, typename ModelType>
+    const VectorType &DelayedAcceptanceModelMixin<ProposalType, ModelType>::getB() const {
+        return proposal.getB();
+    }
+
+    template<typename ProposalType, typename ModelType>
+    std::unique_ptr<Proposal> DelayedAcceptanceModelMixin<ProposalType, ModelType>::copyProposal() const {
+        return std::make_unique<DelayedAcceptanceModelMixin<ProposalType, ModelType>>(*this);
+    }
+
+    template<typename ProposalType, typename ModelType>
+    std::optional<double> DelayedAcceptanceModelMixin<ProposalType, ModelType>::getStepSize() const {
+        return proposal.getStepSize();
+    }
+
+    template<typename ProposalType, typename ModelType>
+    double DelayedAcceptanceModelMixin<ProposalType, ModelType>::getStateNegativeLogLikelihood() {
+        return stateNegativeLogLikelihood;
+    }
+
+    template<typename ProposalType, typename ModelType>
+    double DelayedAcceptanceModelMixin<ProposalType, ModelType>::getProposalNegativeLogLikelihood() {
+        return proposalNegativeLogLikelihood;
+    }
+
+    template<typename ProposalType, typename ModelType>
+    bool DelayedAcceptanceModelMixin<ProposalType, ModelType>::hasNegativeLogLikelihood() const {
+        return true;
+    }
+
+    template<typename ProposalType, typename ModelType>
+    std::vector<std::string> DelayedAcceptanceModelMixin<ProposalType, ModelType>::getDimensionNames() const {
+        return proposal.getDimensionNames();
+    }
+
+    template<typename ProposalType, typename ModelType>
+    bool DelayedAcceptanceModelMixin<ProposalType, ModelType>::isSymmetric() const {
+        return proposal.isSymmetric();
+    }
+
+    template<typename ProposalType, typename ModelType>
+    void DelayedAcceptanceModelMixin<ProposalType, ModelType>::setDimensionNames(const std::vector<std::string> &names) {
+        proposal.setDimensionNames(names);
+    }
+
+    template<typename ProposalType, typename ModelType>
+    void DelayedAcceptanceModelMixin<ProposalType, ModelType>::resetDistributions() {
+        proposal.resetDistributions();
+    }
+
+    template<typename ProposalType, typename ModelType>
+    unsigned long long DelayedAcceptanceModelMixin<ProposalType, ModelType>::getNumberOfProposals() const {
+        return numberOfProposals;
+    }
+
+    template<typename ProposalType, typename ModelType>
+    unsigned long long DelayedAcceptanceModelMixin<ProposalType, ModelType>::getNumberOfModelEvaluations() const {
+        return numberOfModelEvaluations;
+    }
+
+    template<typename ProposalType, typename ModelType>
+    const Model &DelayedAcceptanceModelMixin<ProposalType, ModelType>::getSurrogate() const {
+        return *surrogate;
+    }
+}// namespace hops
+
+#endif//HOPS_DELAYEDACCEPTANCEMODELMIXIN_HPP
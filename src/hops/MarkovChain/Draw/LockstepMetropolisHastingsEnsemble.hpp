@@ -0,0 +1,217 @@
+#ifndef HOPS_LOCKSTEPMETROPOLISHASTINGSENSEMBLE_HPP
+#define HOPS_LOCKSTEPMETROPOLISHASTINGSENSEMBLE_HPP
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "hops/Model/Model.hpp"
+#include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
+#include "hops/Utility/MatrixType.hpp"
+#include "hops/Utility/VectorType.hpp"
+
+namespace hops {
+    /**
+     * @brief Advances several Metropolis-Hastings chains of the same model in lockstep.
+     * @details Every step proposes for all chains first and then evaluates the likelihoods of all proposals with a
+     * single call to Model::computeNegativeLogLikelihoods, e.g. one matrix-matrix product for the Gaussian instead of
+     * one matrix-vector product per chain. Proposals outside of the support of the proposal distribution are not
+     * evaluated. Afterwards, every chain is accepted or rejected individually.
+     *
+     * Every chain is only advanced by its own random number generator, in the same order as the
+     * MetropolisHastingsFilter of a ModelMixin. Therefore, the chains match sequential chains up to the rounding
+     * differences of the batched model evaluation.
+     * @tparam ProposalType proposal without likelihood, which is shared by all chains.
+     */
+    template<typename ProposalType>
+    class LockstepMetropolisHastingsEnsemble {
+    public:
+        /**
+         * @param proposals one proposal per chain, which also holds the starting state of the chain.
+         * @param model is evaluated for the proposals of all chains at once.
+         * @param coldness
+         */
+        LockstepMetropolisHastingsEnsemble(std::vector<ProposalType> proposals,
+                                           std::shared_ptr<Model> model,
+                                           double coldness = 1.);
+
+        /**
+         * @brief Advances every chain by thinning steps.
+         * @param randomNumberGenerators one random number generator per chain.
+         * @param thinning
+         * @return the acceptance rate of every chain throughout the thinning.
+         */
+        const VectorType &draw(std::vector<RandomNumberGenerator> &randomNumberGenerators, long thinning = 1);
+
+        [[nodiscard]] long getNumberOfMarkovChains() const;
+
+        /**
+         * @return the states of all chains, one chain per column.
+         */
+        [[nodiscard]] const MatrixType &getStates() const;
+
+        void setState(long chainIndex, const VectorType &state);
+
+        [[nodiscard]] const VectorType &getStateNegativeLogLikelihoods() const;
+
+        [[nodiscard]] const ProposalType &getProposal(long chainIndex) const;
+
+        [[nodiscard]] double getColdness() const;
+
+        void setColdness(double coldness);
+
+    private:
+        void step(std::vector<RandomNumberGenerator> &randomNumberGenerators);
+
+        std::vector<ProposalType> proposals;
+        std::shared_ptr<Model> model;
+        double coldness;
+        std::uniform_real_distribution<double> uniformRealDistribution;
+
+        MatrixType states;
+        VectorType stateNegativeLogLikelihoods;
+        VectorType acceptanceRates;
+
+        // workspaces of a step
+        VectorType logAcceptanceProbabilities;
+        MatrixType proposalStates;
+        VectorType proposalNegativeLogLikelihoods;
+        std::vector<long> evaluatedChains;
+    };
+
+    template<typename ProposalType>
+    LockstepMetropolisHastingsEnsemble<ProposalType>::LockstepMetropolisHastingsEnsemble(
+            std::vector<ProposalType> proposals,
+            std::shared_ptr<Model> model,
+            double coldness) :
+            proposals(std::move(proposals)),
+            model(std::move(model)),
+            coldness(coldness) {
+        if (this->proposals.empty()) {
+            throw std::invalid_argument("LockstepMetropolisHastingsEnsemble requires at least one proposal.");
+        }
+        if (!this->model) {
+            throw std::invalid_argument("LockstepMetropolisHastingsEnsemble requires a model.");
+        }
+
+        long numberOfChains = static_cast<long>(this->proposals.size());
+        long dimension = this->proposals.front().getState().rows();
+        states.resize(dimension, numberOfChains);
+        for (long i = 0; i < numberOfChains; ++i) {
+            if (this->proposals[i].hasNegativeLogLikelihood()) {
+                throw std::invalid_argument("Can't mix in model with ProposalType that already has likelihood.");
+            }
+            if (this->proposals[i].getState().rows() != dimension) {
+                throw std::invalid_argument("All proposals of the ensemble need states of dimension " +
+                                            std::to_string(dimension) + ".");
+            }
+            this->proposals[i].copyStateTo(states.col(i));
+        }
+
+        stateNegativeLogLikelihoods.resize(numberOfChains);
+        this->model->computeNegativeLogLikelihoods(states, stateNegativeLogLikelihoods);
+        acceptanceRates.resize(numberOfChains);
+        logAcceptanceProbabilities.resize(numberOfChains);
+        proposalStates.resize(dimension, numberOfChains);
+        proposalNegativeLogLikelihoods.resize(numberOfChains);
+        evaluatedChains.resize(numberOfChains);
+    }
+
+    template<typename ProposalType>
+    const VectorType &LockstepMetropolisHastingsEnsemble<ProposalType>::draw(
+            std::vector<RandomNumberGenerator> &randomNumberGenerators,
+            long thinning) {
+        if (static_cast<long>(randomNumberGenerators.size()) != getNumberOfMarkovChains()) {
+            throw std::invalid_argument("LockstepMetropolisHastingsEnsemble requires one random number generator per "
+                                        "chain.");
+        }
+        if (thinning <= 0) {
+            throw std::invalid_argument("thinning has to be positive.");
+        }
+
+        acceptanceRates.setZero();
+        for (long i = 0; i < thinning; ++i) {
+            step(randomNumberGenerators);
+        }
+        acceptanceRates /= static_cast<double>(thinning);
+        return acceptanceRates;
+    }
+
+    template<typename ProposalType>
+    void LockstepMetropolisHastingsEnsemble<ProposalType>::step(
+            std::vector<RandomNumberGenerator> &randomNumberGenerators) {
+        long numberOfEvaluations = 0;
+        for (long i = 0; i < getNumberOfMarkovChains(); ++i) {
+            proposals[i].propose(randomNumberGenerators[i]);
+            logAcceptanceProbabilities(i) = proposals[i].computeLogAcceptanceProbability();
+            if (std::isfinite(logAcceptanceProbabilities(i))) {
+                proposals[i].copyProposalTo(proposalStates.col(numberOfEvaluations));
+                evaluatedChains[numberOfEvaluations++] = i;
+            }
+        }
+
+        model->computeNegativeLogLikelihoods(proposalStates.leftCols(numberOfEvaluations),
+                                             proposalNegativeLogLikelihoods.head(numberOfEvaluations));
+
+        for (long j = 0, i = 0; i < getNumberOfMarkovChains(); ++i) {
+            bool isEvaluated = j < numberOfEvaluations && evaluatedChains[j] == i;
+            double proposalNegativeLogLikelihood = 0;
+            if (isEvaluated) {
+                proposalNegativeLogLikelihood = proposalNegativeLogLikelihoods(j++);
+                logAcceptanceProbabilities(i) += coldness * (stateNegativeLogLikelihoods(i) -
+                                                             proposalNegativeLogLikelihood);
+            }
+
+            double acceptanceChance = std::log(uniformRealDistribution(randomNumberGenerators[i]));
+            if (acceptanceChance < logAcceptanceProbabilities(i)) {
+                proposals[i].acceptProposal();
+                proposals[i].copyStateTo(states.col(i));
+                stateNegativeLogLikelihoods(i) = proposalNegativeLogLikelihood;
+                acceptanceRates(i) += 1;
+            }
+        }
+    }
+
+    template<typename ProposalType>
+    long LockstepMetropolisHastingsEnsemble<ProposalType>::getNumberOfMarkovChains() const {
+        return static_cast<long>(proposals.size());
+    }
+
+    template<typename ProposalType>
+    const MatrixType &LockstepMetropolisHastingsEnsemble<ProposalType>::getStates() const {
+        return states;
+    }
+
+    template<typename ProposalType>
+    void LockstepMetropolisHastingsEnsemble<ProposalType>::setState(long chainIndex, const VectorType &state) {
+        proposals.at(chainIndex).setState(state);
+        proposals[chainIndex].copyStateTo(states.col(chainIndex));
+        stateNegativeLogLikelihoods(chainIndex) = model->computeNegativeLogLikelihood(state);
+    }
+
+    template<typename ProposalType>
+    const VectorType &LockstepMetropolisHastingsEnsemble<ProposalType>::getStateNegativeLogLikelihoods() const {
+        return stateNegativeLogLikelihoods;
+    }
+
+    template<typename ProposalType>
+    const ProposalType &LockstepMetropolisHastingsEnsemble<ProposalType>::getProposal(long chainIndex) const {
+        return proposals.at(chainIndex);
+    }
+
+    template<typename ProposalType>
+    double LockstepMetropolisHastingsEnsemble<ProposalType>::getColdness() const {
+        return coldness;
+    }
+
+    template<typename ProposalType>
+    void LockstepMetropolisHastingsEnsemble<ProposalType>::setColdness(double newColdness) {
+        coldness = newColdness;
+    }
+}
+
+#endif //HOPS_LOCKSTEPMETROPOLISHASTINGSENSEMBLE_HPP
@@ -0,0 +1,191 @@
+#ifndef HOPS_SPECULATIVEMETROPOLISHASTINGSFILTER_HPP
+#define HOPS_SPECULATIVEMETROPOLISHASTINGSFILTER_HPP
+
+#include <any>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "hops/MarkovChain/Proposal/ProposalParameter.hpp"
+#include "hops/Parallel/ThreadPool.hpp"
+#include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
+#include "hops/Utility/VectorType.hpp"
+
+namespace hops {
+    /**
+     * @brief Metropolis-Hastings filter, which evaluates the acceptance probabilities of several consecutive steps in
+     * parallel.
+     * @details Every speculative round proposes the next numberOfSpeculativeSteps steps sequentially from copies of the
+     * chain, assuming that all of them are rejected, and then evaluates their acceptance probabilities in parallel.
+     * The steps are committed in order up to and including the first accepted step. The remaining steps are discarded,
+     * because they were proposed from the wrong state. Committed steps are returned one at a time by draw, which
+     * also sets the random number generator to the state it would have after the step in a sequential chain.
+     * Therefore, the states, acceptances and random number streams are identical to the MetropolisHastingsFilter.
+     *
+     * Speculation pays off if the acceptance probability, usually the likelihood, is expensive compared to copying the
+     * chain and the acceptance rate is low. On average, a round commits 1/acceptanceRate steps at most.
+     *
+     * The results are only exact if computeLogAcceptanceProbability does not change anything that affects the following
+     * steps, except for data that is overwritten by the next call. This holds for all proposals and for the ModelMixin,
+     * but not for the DelayedAcceptanceModelMixin, which trains its surrogate on every evaluated proposal.
+     * Copies of the chain must not share mutable data, e.g. models, since they are evaluated concurrently.
+     * @tparam MarkovChainProposer
+     */
+    template<typename MarkovChainProposer>
+    class SpeculativeMetropolisHastingsFilter : public MarkovChainProposer {
+    public:
+        /**
+         * @param markovChainProposer
+         * @param numberOfSpeculativeSteps number of steps per speculative round. Non-positive values select the number
+         * of threads of the thread pool.
+         * @param threadPool evaluates the speculative steps. If none is given, a pool with numberOfSpeculativeSteps
+         * threads is created. Copies of the filter share the pool.
+         */
+        explicit SpeculativeMetropolisHastingsFilter(const MarkovChainProposer &markovChainProposer,
+                                                     long numberOfSpeculativeSteps = 0,
+                                                     std::shared_ptr<ThreadPool> threadPool = nullptr);
+
+        double draw(RandomNumberGenerator &randomNumberGenerator);
+
+        void setState(const VectorType &state);
+
+        void setParameter(const ProposalParameter &parameter, const std::any &value);
+
+        [[nodiscard]] long getNumberOfSpeculativeSteps() const;
+
+        void setNumberOfSpeculativeSteps(long numberOfSpeculativeSteps);
+
+    private:
+        void speculate(RandomNumberGenerator &randomNumberGenerator);
+
+        void discardSpeculativeSteps();
+
+        long numberOfSpeculativeSteps;
+        std::shared_ptr<ThreadPool> threadPool;
+        std::uniform_real_distribution<double> uniformRealDistribution;
+
+        /**
+         * @brief speculativeChains[i] is the chain after proposing step i of the current round, assuming that all
+         * previous steps were rejected.
+         */
+        std::vector<MarkovChainProposer> speculativeChains;
+        /**
+         * @brief speculativeRandomNumberGenerators[i] is the random number generator after step i of the current round.
+         */
+        std::vector<RandomNumberGenerator> speculativeRandomNumberGenerators;
+        std::vector<double> logAcceptanceChances;
+        std::vector<double> logAcceptanceProbabilities;
+        long numberOfCommittableSteps = 0;
+        long nextStep = 0;
+    };
+
+    template<typename MarkovChainProposer>
+    SpeculativeMetropolisHastingsFilter<MarkovChainProposer>::SpeculativeMetropolisHastingsFilter(
+            const MarkovChainProposer &markovChainProposer,
+            long numberOfSpeculativeSteps,
+            std::shared_ptr<ThreadPool> threadPool) :
+            MarkovChainProposer(markovChainProposer),
+            threadPool(std::move(threadPool)) {
+        if (!this->threadPool) {
+            this->threadPool = std::make_shared<ThreadPool>(numberOfSpeculativeSteps);
+        }
+        setNumberOfSpeculativeSteps(numberOfSpeculativeSteps);
+    }
+
+    template<typename MarkovChainProposer>
+    double SpeculativeMetropolisHastingsFilter<MarkovChainProposer>::draw(RandomNumberGenerator &randomNumberGenerator) {
+        // Steps of the current round are only valid, if nobody else has used the random number generator since.
+        bool isRoundValid = nextStep > 0 && nextStep < numberOfCommittableSteps &&
+                            randomNumberGenerator.rng_ == speculativeRandomNumberGenerators[nextStep - 1].rng_;
+        if (!isRoundValid) {
+            speculate(randomNumberGenerator);
+        }
+
+        long step = nextStep++;
+        static_cast<MarkovChainProposer &>(*this) = std::move(speculativeChains[step]);
+        randomNumberGenerator = speculativeRandomNumberGenerators[step];
+
+        if (logAcceptanceChances[step] < logAcceptanceProbabilities[step]) {
+            MarkovChainProposer::acceptProposal();
+            return 1;
+        }
+        return 0;
+    }
+
+    template<typename MarkovChainProposer>
+    void SpeculativeMetropolisHastingsFilter<MarkovChainProposer>::speculate(
+            RandomNumberGenerator &randomNumberGenerator) {
+        // The chains are copy constructed instead of assigned, because only copy constructors are guaranteed to copy
+        // models deeply, e.g. the ModelWrapper.
+        speculativeChains.clear();
+        speculativeChains.reserve(numberOfSpeculativeSteps);
+        speculativeRandomNumberGenerators.assign(numberOfSpeculativeSteps, randomNumberGenerator);
+        logAcceptanceChances.resize(numberOfSpeculativeSteps);
+        logAcceptanceProbabilities.resize(numberOfSpeculativeSteps);
+
+        RandomNumberGenerator speculativeRandomNumberGenerator = randomNumberGenerator;
+        for (long i = 0; i < numberOfSpeculativeSteps; ++i) {
+            if (i == 0) {
+                speculativeChains.emplace_back(static_cast<const MarkovChainProposer &>(*this));
+            } else {
+                speculativeChains.emplace_back(speculativeChains.back());
+            }
+            speculativeChains.back().propose(speculativeRandomNumberGenerator);
+            logAcceptanceChances[i] = std::log(uniformRealDistribution(speculativeRandomNumberGenerator));
+            speculativeRandomNumberGenerators[i] = speculativeRandomNumberGenerator;
+        }
+
+        threadPool->parallelFor(numberOfSpeculativeSteps, [&](long i) {
+            logAcceptanceProbabilities[i] = speculativeChains[i].computeLogAcceptanceProbability();
+        });
+
+        numberOfCommittableSteps = numberOfSpeculativeSteps;
+        for (long i = 0; i < numberOfSpeculativeSteps; ++i) {
+            if (logAcceptanceChances[i] < logAcceptanceProbabilities[i]) {
+                numberOfCommittableSteps = i + 1;
+                break;
+            }
+        }
+        nextStep = 0;
+    }
+
+    template<typename MarkovChainProposer>
+    void SpeculativeMetropolisHastingsFilter<MarkovChainProposer>::discardSpeculativeSteps() {
+        numberOfCommittableSteps = 0;
+        nextStep = 0;
+        speculativeChains.clear();
+    }
+
+    template<typename MarkovChainProposer>
+    void SpeculativeMetropolisHastingsFilter<MarkovChainProposer>::setState(const VectorType &state) {
+        discardSpeculativeSteps();
+        MarkovChainProposer::setState(state);
+    }
+
+    template<typename MarkovChainProposer>
+    void SpeculativeMetropolisHastingsFilter<MarkovChainProposer>::setParameter(const ProposalParameter &parameter,
+                                                                             const std::any &value) {
+        discardSpeculativeSteps();
+        MarkovChainProposer::setParameter(parameter, value);
+    }
+
+    template<typename MarkovChainProposer>
+    long SpeculativeMetropolisHastingsFilter<MarkovChainProposer>::getNumberOfSpeculativeSteps() const {
+        return numberOfSpeculativeSteps;
+    }
+
+    template<typename MarkovChainProposer>
+    void SpeculativeMetropolisHastingsFilter<MarkovChainProposer>::setNumberOfSpeculativeSteps(
+            long newNumberOfSpeculativeSteps) {
+        if (newNumberOfSpeculativeSteps <= 0) {
+            newNumberOfSpeculativeSteps = threadPool->getNumberOfThreads();
+        }
+        numberOfSpeculativeSteps = newNumberOfSpeculativeSteps;
+        discardSpeculativeSteps();
+    }
+}
+
+#endif //HOPS_SPECULATIVEMETROPOLISHASTINGSFILTER_HPP
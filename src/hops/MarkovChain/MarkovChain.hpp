@@ -1,12 +1,17 @@
 #ifndef HOPS_MARKOVCHAIN_HPP
 #define HOPS_MARKOVCHAIN_HPP
 
+#include <istream>
 #include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
 #include <utility>
 
 #include "hops/MarkovChain/Proposal/Proposal.hpp"
 #include "hops/MarkovChain/Proposal/ProposalParameter.hpp"
 #include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
+#include "hops/Utility/MatrixType.hpp"
 #include "hops/Utility/VectorType.hpp"
 
 namespace hops {
@@ -21,6 +26,40 @@ namespace hops {
          */
         virtual std::pair<double, VectorType> draw(RandomNumberGenerator &randomNumberGenerator, long thinning = 1) = 0;
 
+        /**
+         * @brief Draws numberOfSamples states and writes them column by column into samples.
+         * @details Produces the same states as calling draw numberOfSamples times. The storage is provided by the
+         * caller, e.g. a block of a larger matrix, such that no memory is allocated per sample.
+         * @param randomNumberGenerator
+         * @param numberOfSamples
+         * @param thinning Number of samples to draw but discard before reporting a single new sample.
+         * @param samples Matrix with getState().rows() rows and numberOfSamples columns.
+         * @param acceptanceRates Either empty or of size numberOfSamples, in which case the acceptance rate of each
+         * sample is stored.
+         */
+        virtual void drawBatch(RandomNumberGenerator &randomNumberGenerator,
+                               long numberOfSamples,
+                               long thinning,
+                               Eigen::Ref<MatrixType> samples,
+                               Eigen::Ref<VectorType> acceptanceRates) {
+            checkDrawBatchArguments(numberOfSamples, thinning, getState().rows(), samples, acceptanceRates);
+            for (long i = 0; i < numberOfSamples; ++i) {
+                auto[acceptanceRate, state] = draw(randomNumberGenerator, thinning);
+                samples.col(i) = state;
+                if (acceptanceRates.rows() > 0) {
+                    acceptanceRates(i) = acceptanceRate;
+                }
+            }
+        }
+
+        void drawBatch(RandomNumberGenerator &randomNumberGenerator,
+                       long numberOfSamples,
+                       long thinning,
+                       Eigen::Ref<MatrixType> samples) {
+            VectorType noAcceptanceRates;
+            drawBatch(randomNumberGenerator, numberOfSamples, thinning, samples, noAcceptanceRates);
+        }
+
         [[nodiscard]] virtual VectorType getState() const = 0;
 
         virtual void setState(const VectorType &) = 0;
@@ -38,6 +77,38 @@ namespace hops {
          * @details Implementations should list possible parameterNames in the exception message.
          */
         virtual void setParameter(const ProposalParameter &parameter, const std::any &value) = 0;
+
+        /**
+         * @brief Writes the complete state of the chain, such that a chain constructed with the same arguments
+         * continues bitwise identically after deserialize. Used by Checkpoint.
+         * @throws std::runtime_error if the chain does not support serialization.
+         */
+        virtual void serialize(std::ostream &) const {
+            throw std::runtime_error("Markov chain does not support serialization.");
+        }
+
+        virtual void deserialize(std::istream &) {
+            throw std::runtime_error("Markov chain does not support serialization.");
+        }
+
+    protected:
+        static void checkDrawBatchArguments(long numberOfSamples,
+                                            long thinning,
+                                            long stateDimension,
+                                            const Eigen::Ref<MatrixType> &samples,
+                                            const Eigen::Ref<VectorType> &acceptanceRates) {
+            if (numberOfSamples < 0 || thinning <= 0) {
+                throw std::invalid_argument("numberOfSamples has to be non-negative and thinning positive.");
+            }
+            if (samples.cols() != numberOfSamples || samples.rows() != stateDimension) {
+                throw std::invalid_argument(
+                        "samples has to have " + std::to_string(stateDimension) + " rows and " +
+                        std::to_string(numberOfSamples) + " columns.");
+            }
+            if (acceptanceRates.rows() != 0 && acceptanceRates.rows() != numberOfSamples) {
+                throw std::invalid_argument("acceptanceRates has to be empty or of size numberOfSamples.");
+            }
+        }
     };
 }
 
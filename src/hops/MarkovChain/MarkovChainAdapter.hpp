@@ -1,6 +1,8 @@
 #ifndef HOPS_MARKOVCHAINADAPTER_HPP
 #define HOPS_MARKOVCHAINADAPTER_HPP
 
+#include <type_traits>
+
 #include "hops/Utility/HopsWithinHopsy.hpp"
 
 #include "MarkovChain.hpp"
@@ -9,7 +11,9 @@ namespace hops {
     template<typename MarkovChainImpl>
     class MarkovChainAdapter : public MarkovChain, public MarkovChainImpl {
     public:
-        explicit MarkovChainAdapter(MarkovChainImpl markovChainImpl) : MarkovChainImpl(markovChainImpl) {}
+        explicit MarkovChainAdapter(MarkovChainImpl markovChainImpl) :
+                MarkovChainImpl(markovChainImpl),
+                stateDimension(MarkovChainImpl::getState().rows()) {}
 
         std::pair<double, VectorType> draw(RandomNumberGenerator &randomNumberGenerator, long thinning = 1) override {
             double acceptanceRate = 0;
@@ -20,12 +24,34 @@ namespace hops {
             return {acceptanceRate / thinning, MarkovChainImpl::getState()};
         }
 
+        using MarkovChain::drawBatch;
+
+        void drawBatch(RandomNumberGenerator &randomNumberGenerator,
+                       long numberOfSamples,
+                       long thinning,
+                       Eigen::Ref<MatrixType> samples,
+                       Eigen::Ref<VectorType> acceptanceRates) override {
+            MarkovChain::checkDrawBatchArguments(numberOfSamples, thinning, stateDimension, samples, acceptanceRates);
+            for (long i = 0; i < numberOfSamples; ++i) {
+                double acceptanceRate = 0;
+                for (long j = 0; j < thinning; ++j) {
+                    ABORTABLE;
+                    acceptanceRate += MarkovChainImpl::draw(randomNumberGenerator);
+                }
+                MarkovChainImpl::copyStateTo(samples.col(i));
+                if (acceptanceRates.rows() > 0) {
+                    acceptanceRates(i) = acceptanceRate / thinning;
+                }
+            }
+        }
+
         [[nodiscard]] VectorType getState() const override {
             return MarkovChainImpl::getState();
         }
 
         void setState(const VectorType &state) override {
             MarkovChainImpl::setState(state);
+            stateDimension = state.rows();
         }
 
         double getStateNegativeLogLikelihood() override {
@@ -47,6 +73,26 @@ namespace hops {
         void setParameter(const ProposalParameter &parameter, const std::any &value) override {
             MarkovChainImpl::setParameter(parameter, value);
         }
+
+        void serialize(std::ostream &out) const override {
+            if constexpr (std::is_base_of_v<Proposal, MarkovChainImpl>) {
+                MarkovChainImpl::serialize(out);
+            } else {
+                MarkovChain::serialize(out);
+            }
+        }
+
+        void deserialize(std::istream &in) override {
+            if constexpr (std::is_base_of_v<Proposal, MarkovChainImpl>) {
+                MarkovChainImpl::deserialize(in);
+            } else {
+                MarkovChain::deserialize(in);
+            }
+        }
+
+    private:
+        // Cached, because querying the state of transformed chains allocates.
+        long stateDimension;
     };
 }
 
@@ -1,7 +1,10 @@
 #ifndef HOPS_MARKOVCHAINFACTORY_HPP
 #define HOPS_MARKOVCHAINFACTORY_HPP
 
+#include <memory>
+#include <stdexcept>
 #include <type_traits>
+#include <typeinfo>
 
 #include "hops/MarkovChain/MarkovChain.hpp"
 #include "hops/MarkovChain/MarkovChainType.hpp"
@@ -18,6 +21,8 @@
 #include "hops/MarkovChain/Proposal/DikinProposal.hpp"
 #include "hops/MarkovChain/Proposal/GaussianProposal.hpp"
 #include "hops/MarkovChain/Proposal/HitAndRunProposal.hpp"
+#include "hops/MarkovChain/Proposal/JohnProposal.hpp"
+#include "hops/MarkovChain/Proposal/VaidyaProposal.hpp"
 #include "hops/MarkovChain/Recorder/AcceptanceRateRecorder.hpp"
 #include "hops/MarkovChain/Recorder/NegativeLogLikelihoodRecorder.hpp"
 #include "hops/MarkovChain/Recorder/StateRecorder.hpp"
@@ -27,6 +32,10 @@
 #include "hops/MarkovChain/ModelWrapper.hpp"
 #include "hops/Transformation/LinearTransformation.hpp"
 #include "hops/MarkovChain/Recorder/NegativeLogLikelihoodRecorder.hpp"
+#include "hops/Model/DegenerateGaussian.hpp"
+#include "hops/Model/Gaussian.hpp"
+#include "hops/Model/Model.hpp"
+#include "hops/Model/Rosenbrock.hpp"
 
 namespace hops {
     class MarkovChainFactory {
@@ -139,6 +148,31 @@ namespace hops {
                 Model model
         );
 
+        /**
+         * @brief Creates a Markov chain for sampling the likelihood of a model, which is only known at runtime, with the
+         * domain of a convex polytope.
+         * @details Built-in models (Gaussian, DegenerateGaussian and Rosenbrock) are copied into a chain that is
+         * statically typed on the model, such that the per-step calls through proposal, Metropolis-Hastings filter and
+         * model are resolved at compile time. Only the returned MarkovChain is type-erased. Other models are called
+         * through a ModelWrapper.
+         * @tparam MatrixType
+         * @tparam VectorType
+         * @param type
+         * @param inequalityLhs
+         * @param inequalityRhs
+         * @param startingPoint
+         * @param model
+         * @return
+         */
+        template<typename MatrixType, typename VectorType>
+        static std::unique_ptr<MarkovChain> createMarkovChain(
+                MarkovChainType type,
+                MatrixType inequalityLhs,
+                VectorType inequalityRhs,
+                VectorType startingPoint,
+                const std::shared_ptr<Model> &model
+        );
+
         /**
          * @brief Creates a Markov chain for sampling the likelihood of a model with the domain of a convex polytope with parallel tempering.
          * @tparam MatrixType
@@ -207,6 +241,32 @@ namespace hops {
                 Model model
         );
 
+        /**
+         * @brief Creates a Markov chain for sampling the likelihood of a model, which is only known at runtime, with the
+         * domain of a rounded convex polytope.
+         * @details Built-in models are dispatched to statically typed chains as in the unrounded case.
+         * @tparam MatrixType
+         * @tparam VectorType
+         * @param type
+         * @param roundedInequalityLhs
+         * @param roundedInequalityRhs
+         * @param startingPoint
+         * @param unroundingTransformation
+         * @param unroundingShift
+         * @param model
+         * @return
+         */
+        template<typename MatrixType, typename VectorType>
+        static std::unique_ptr<MarkovChain> createMarkovChain(
+                MarkovChainType type,
+                MatrixType roundedInequalityLhs,
+                VectorType roundedInequalityRhs,
+                VectorType startingPoint,
+                MatrixType unroundingTransformation,
+                VectorType unroundingShift,
+                const std::shared_ptr<Model> &model
+        );
+
         /**
          * @brief Creates a Markov chain for sampling the likelihood of a model with the domain of a rounded convex polytope with parallel tempering.
          * @tparam MatrixType
@@ -239,6 +299,29 @@ namespace hops {
         static bool isInteriorPoint(const MatrixType &A, const VectorType &b, const VectorType &x) {
             return ((b - A * x).array() >= 0).all();
         }
+
+        /**
+         * @brief Calls createChain with a copy of model as its concrete type, if it is exactly one of the built-in
+         * models. Derived models keep their overrides, because they are wrapped in a ModelWrapper like any other model.
+         */
+        template<typename ChainCreator>
+        static std::unique_ptr<MarkovChain>
+        dispatchBuiltInModel(const std::shared_ptr<Model> &model, ChainCreator createChain) {
+            if (!model) {
+                throw std::invalid_argument("model is nullptr.");
+            }
+            const Model &modelReference = *model;
+            if (typeid(modelReference) == typeid(Gaussian)) {
+                return createChain(static_cast<const Gaussian &>(modelReference));
+            }
+            if (typeid(modelReference) == typeid(DegenerateGaussian)) {
+                return createChain(static_cast<const DegenerateGaussian &>(modelReference));
+            }
+            if (typeid(modelReference) == typeid(Rosenbrock)) {
+                return createChain(static_cast<const Rosenbrock &>(modelReference));
+            }
+            return createChain(ModelWrapper(model));
+        }
     };
 
 
@@ -315,6 +398,24 @@ namespace hops {
                         )
                 );
             }
+            case MarkovChainType::JohnWalk : {
+                return wrapMarkovChainImpl(
+                        MarkovChainAdapter(
+                                MetropolisHastingsFilter(
+                                        JohnProposal(inequalityLhs, inequalityRhs, startingPoint)
+                                )
+                        )
+                );
+            }
+            case MarkovChainType::VaidyaWalk : {
+                return wrapMarkovChainImpl(
+                        MarkovChainAdapter(
+                                MetropolisHastingsFilter(
+                                        VaidyaProposal(inequalityLhs, inequalityRhs, startingPoint)
+                                )
+                        )
+                );
+            }
             default: {
                 throw std::runtime_error("MarkovChainType not supported for uniform sampling.");
             }
@@ -433,6 +534,36 @@ namespace hops {
                         )
                 );
             }
+            case MarkovChainType::JohnWalk : {
+                return wrapMarkovChainImpl(
+                        MarkovChainAdapter(
+                                MetropolisHastingsFilter(
+                                        StateTransformation(
+                                                JohnProposal(
+                                                        roundedInequalityLhs,
+                                                        roundedInequalityRhs,
+                                                        startingPoint),
+                                                LinearTransformation(unroundingTransformation, unroundingShift)
+                                        )
+                                )
+                        )
+                );
+            }
+            case MarkovChainType::VaidyaWalk : {
+                return wrapMarkovChainImpl(
+                        MarkovChainAdapter(
+                                MetropolisHastingsFilter(
+                                        StateTransformation(
+                                                VaidyaProposal(
+                                                        roundedInequalityLhs,
+                                                        roundedInequalityRhs,
+                                                        startingPoint),
+                                                LinearTransformation(unroundingTransformation, unroundingShift)
+                                        )
+                                )
+                        )
+                );
+            }
             default: {
                 throw std::runtime_error("MarkovChainType not supported for uniform sampling.");
             }
@@ -617,12 +748,49 @@ namespace hops {
                         )
                 );
             }
+            case MarkovChainType::JohnWalk : {
+                return wrapMarkovChainImpl(
+                        MarkovChainAdapter(
+                                MetropolisHastingsFilter(
+                                        ModelMixin(
+                                                JohnProposal(inequalityLhs, inequalityRhs, startingPoint),
+                                                model
+                                        )
+                                )
+                        )
+                );
+            }
+            case MarkovChainType::VaidyaWalk : {
+                return wrapMarkovChainImpl(
+                        MarkovChainAdapter(
+                                MetropolisHastingsFilter(
+                                        ModelMixin(
+                                                VaidyaProposal(inequalityLhs, inequalityRhs, startingPoint),
+                                                model
+                                        )
+                                )
+                        )
+                );
+            }
             default: {
                 throw std::runtime_error("Type not supported.");
             }
         }
     }
 
+    template<typename MatrixType, typename VectorType>
+    std::unique_ptr<MarkovChain> MarkovChainFactory::createMarkovChain(
+            MarkovChainType type,
+            MatrixType inequalityLhs,
+            VectorType inequalityRhs,
+            VectorType startingPoint,
+            const std::shared_ptr<Model> &model
+    ) {
+        return dispatchBuiltInModel(model, [&](const auto &concreteModel) {
+            return createMarkovChain(type, inequalityLhs, inequalityRhs, startingPoint, concreteModel);
+        });
+    }
+
     template<typename MatrixType, typename VectorType, typename Model>
     std::unique_ptr<MarkovChain> MarkovChainFactory::createMarkovChainWithParallelTempering(
             MarkovChainType type,
@@ -755,6 +923,36 @@ namespace hops {
                         )
                 );
             }
+            case MarkovChainType::JohnWalk : {
+                return wrapMarkovChainImpl(
+                        MarkovChainAdapter(
+                                ParallelTempering(
+                                        MetropolisHastingsFilter(
+                                                ModelMixin(
+                                                        JohnProposal(inequalityLhs, inequalityRhs, startingPoint),
+                                                        model
+                                                )
+                                        ),
+                                        synchronizedRandomNumberGenerator
+                                )
+                        )
+                );
+            }
+            case MarkovChainType::VaidyaWalk : {
+                return wrapMarkovChainImpl(
+                        MarkovChainAdapter(
+                                ParallelTempering(
+                                        MetropolisHastingsFilter(
+                                                ModelMixin(
+                                                        VaidyaProposal(inequalityLhs, inequalityRhs, startingPoint),
+                                                        model
+                                                )
+                                        ),
+                                        synchronizedRandomNumberGenerator
+                                )
+                        )
+                );
+            }
             default: {
                 throw std::runtime_error("Type not supported.");
             }
@@ -938,6 +1136,22 @@ namespace hops {
     }
 
 
+    template<typename MatrixType, typename VectorType>
+    std::unique_ptr<MarkovChain> MarkovChainFactory::createMarkovChain(
+            MarkovChainType type,
+            MatrixType roundedInequalityLhs,
+            VectorType roundedInequalityRhs,
+            VectorType startingPoint,
+            MatrixType unroundingTransformation,
+            VectorType unroundingShift,
+            const std::shared_ptr<Model> &model
+    ) {
+        return dispatchBuiltInModel(model, [&](const auto &concreteModel) {
+            return createMarkovChain(type, roundedInequalityLhs, roundedInequalityRhs, startingPoint,
+                                     unroundingTransformation, unroundingShift, concreteModel);
+        });
+    }
+
     template<typename MatrixType, typename VectorType, typename Model>
     std::unique_ptr<MarkovChain> MarkovChainFactory::createMarkovChainWithParallelTempering(
             MarkovChainType type,
@@ -23,8 +23,12 @@ std::string hops::markovChainTypeToFullString(MarkovChainType markovChainType) {
             return "Gaussian Random Walk";
         case MarkovChainType::HitAndRun:
             return "Hit-and-Run";
+        case MarkovChainType::JohnWalk:
+            return "John Walk";
         case MarkovChainType::TruncatedGaussian:
             return "Truncated Gaussian";
+        case MarkovChainType::VaidyaWalk:
+            return "Vaidya Walk";
         default:
             throw std::runtime_error("Bug in switch case for markovChainTypeToFullString.");
     }
@@ -50,8 +54,12 @@ std::string hops::markovChainTypeToShortString(MarkovChainType markovChainType)
             return "G";
         case MarkovChainType::HitAndRun:
             return "HR";
+        case MarkovChainType::JohnWalk:
+            return "JW";
         case MarkovChainType::TruncatedGaussian:
             return "TMVN";
+        case MarkovChainType::VaidyaWalk:
+            return "VW";
         default:
             throw std::runtime_error("Bug in switch case for markovChainTypeToShortString.");
     }
@@ -74,7 +82,9 @@ hops::MarkovChainType hops::stringToMarkovChainType(const std::string &chainStri
             MarkovChainType::DikinWalk,
             MarkovChainType::Gaussian,
             MarkovChainType::HitAndRun,
-            MarkovChainType::TruncatedGaussian
+            MarkovChainType::JohnWalk,
+            MarkovChainType::TruncatedGaussian,
+            MarkovChainType::VaidyaWalk
     };
 
     for (const MarkovChainType &chainType: chainTypes) {
@@ -14,7 +14,9 @@ namespace hops {
         DikinWalk,
         Gaussian,
         HitAndRun,
+        JohnWalk,
         TruncatedGaussian,
+        VaidyaWalk,
     };
 
     std::string markovChainTypeToFullString(MarkovChainType markovChainType);
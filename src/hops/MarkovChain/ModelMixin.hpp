@@ -7,6 +7,7 @@
 #include "hops/MarkovChain/Proposal/Proposal.hpp"
 #include "hops/Model/Model.hpp"
 #include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
+#include "hops/Utility/BinarySerialization.hpp"
 #include "hops/Utility/VectorType.hpp"
 
 namespace hops {
@@ -63,8 +64,12 @@ namespace hops {
 
         [[nodiscard]] VectorType getState() const override;
 
+        void copyStateTo(Eigen::Ref<VectorType> destination) const override;
+
         [[nodiscard]] VectorType getProposal() const override;
 
+        void copyProposalTo(Eigen::Ref<VectorType> destination) const override;
+
         [[nodiscard]] std::optional<double> getStepSize() const override;
 
         [[nodiscard]] double getStateNegativeLogLikelihood() override;
@@ -97,11 +102,16 @@ namespace hops {
 
         void resetDistributions() override;
 
+        void serialize(std::ostream &out) const override;
+
+        void deserialize(std::istream &in) override;
+
     private:
         ProposalType proposal;
         double coldness = 1.;
         double proposalNegativeLogLikelihood;
         double stateNegativeLogLikelihood;
+        VectorType proposalWorkspace; // avoids allocating a copy of the proposal in every step
     };
 
 
@@ -190,8 +200,12 @@ namespace hops {
 
         [[nodiscard]] VectorType getState() const override;
 
+        void copyStateTo(Eigen::Ref<VectorType> destination) const override;
+
         [[nodiscard]] VectorType getProposal() const override;
 
+        void copyProposalTo(Eigen::Ref<VectorType> destination) const override;
+
         [[nodiscard]] std::optional<double> getStepSize() const override;
 
         [[nodiscard]] double getStateNegativeLogLikelihood() override;
@@ -224,6 +238,10 @@ namespace hops {
 
         void resetDistributions() override;
 
+        void serialize(std::ostream &out) const override;
+
+        void deserialize(std::istream &in) override;
+
         typename MatrixType::Scalar computeNegativeLogLikelihood(const VectorType &x) override;
 
         std::unique_ptr<Model> copyModel() const override;
@@ -234,6 +252,7 @@ namespace hops {
         double proposalNegativeLogLikelihood;
         double stateNegativeLogLikelihood;
         std::unique_ptr<Model> modelImpl;
+        VectorType proposalWorkspace; // avoids allocating a copy of the proposal in every step
     };
 
     template<typename ProposalType, typename ModelType>
@@ -251,7 +270,12 @@ namespace hops {
     double ModelMixin<ProposalType, ModelType>::computeLogAcceptanceProbability() {
         double acceptanceProbability = proposal.computeLogAcceptanceProbability();
         if (std::isfinite(acceptanceProbability)) {
-            proposalNegativeLogLikelihood = ModelType::computeNegativeLogLikelihood(proposal.getProposal());
+            if (proposalWorkspace.rows() == 0) {
+                proposalWorkspace = proposal.getProposal();
+            } else {
+                proposal.copyProposalTo(proposalWorkspace);
+            }
+            proposalNegativeLogLikelihood = ModelType::computeNegativeLogLikelihood(proposalWorkspace);
             acceptanceProbability += coldness * (stateNegativeLogLikelihood - proposalNegativeLogLikelihood);
         }
 
@@ -275,6 +299,11 @@ namespace hops {
         return proposal.getState();
     }
 
+    template<typename ProposalType, typename ModelType>
+    void ModelMixin<ProposalType, ModelType>::copyStateTo(Eigen::Ref<VectorType> destination) const {
+        proposal.copyStateTo(destination);
+    }
+
     template<typename MarkovChainProposer, typename ModelType>
     void ModelMixin<MarkovChainProposer, ModelType>::setProposal(const VectorType &proposalVector) {
         proposal.setProposal(proposalVector);
@@ -286,6 +315,11 @@ namespace hops {
         return proposal.getProposal();
     }
 
+    template<typename ProposalType, typename ModelType>
+    void ModelMixin<ProposalType, ModelType>::copyProposalTo(Eigen::Ref<VectorType> destination) const {
+        proposal.copyProposalTo(destination);
+    }
+
     template<typename ProposalType, typename ModelType>
     std::vector<std::string> ModelMixin<ProposalType, ModelType>::getParameterNames() const {
         std::vector<std::string> parameterNames = {"coldness"};
@@ -380,6 +414,18 @@ namespace hops {
         proposal.resetDistributions();
     }
 
+    template<typename ProposalType, typename ModelType>
+    void ModelMixin<ProposalType, ModelType>::serialize(std::ostream &out) const {
+        BinarySerialization::writeAll(out, coldness, proposalNegativeLogLikelihood, stateNegativeLogLikelihood);
+        proposal.serialize(out);
+    }
+
+    template<typename ProposalType, typename ModelType>
+    void ModelMixin<ProposalType, ModelType>::deserialize(std::istream &in) {
+        BinarySerialization::readAll(in, coldness, proposalNegativeLogLikelihood, stateNegativeLogLikelihood);
+        proposal.deserialize(in);
+    }
+
     template<typename ProposalType>
     VectorType &ModelMixin<ProposalType, std::unique_ptr<Model>>::propose(RandomNumberGenerator &rng) {
         return proposal.propose(rng);
@@ -395,7 +441,12 @@ namespace hops {
     double ModelMixin<ProposalType, std::unique_ptr<Model>>::computeLogAcceptanceProbability() {
         double acceptanceProbability = proposal.computeLogAcceptanceProbability();
         if (std::isfinite(acceptanceProbability)) {
-            proposalNegativeLogLikelihood = modelImpl->computeNegativeLogLikelihood(proposal.getProposal());
+            if (proposalWorkspace.rows() == 0) {
+                proposalWorkspace = proposal.getProposal();
+            } else {
+                proposal.copyProposalTo(proposalWorkspace);
+            }
+            proposalNegativeLogLikelihood = modelImpl->computeNegativeLogLikelihood(proposalWorkspace);
             acceptanceProbability += coldness * (stateNegativeLogLikelihood - proposalNegativeLogLikelihood);
         }
 
@@ -419,6 +470,11 @@ namespace hops {
         return proposal.getState();
     }
 
+    template<typename ProposalType>
+    void ModelMixin<ProposalType, std::unique_ptr<Model>>::copyStateTo(Eigen::Ref<VectorType> destination) const {
+        proposal.copyStateTo(destination);
+    }
+
     template<typename MarkovChainProposer>
     void ModelMixin<MarkovChainProposer, std::unique_ptr<Model>>::setProposal(const VectorType &proposalVector) {
         proposal.setProposal(proposalVector);
@@ -430,6 +486,11 @@ namespace hops {
         return proposal.getProposal();
     }
 
+    template<typename ProposalType>
+    void ModelMixin<ProposalType, std::unique_ptr<Model>>::copyProposalTo(Eigen::Ref<VectorType> destination) const {
+        proposal.copyProposalTo(destination);
+    }
+
     template<typename ProposalType>
     std::vector<std::string> ModelMixin<ProposalType, std::unique_ptr<Model>>::getParameterNames() const {
         std::vector<std::string> parameterNames = {"coldness"};
@@ -524,6 +585,18 @@ namespace hops {
         proposal.resetDistributions();
     }
 
+    template<typename ProposalType>
+    void ModelMixin<ProposalType, std::unique_ptr<Model>>::serialize(std::ostream &out) const {
+        BinarySerialization::writeAll(out, coldness, proposalNegativeLogLikelihood, stateNegativeLogLikelihood);
+        proposal.serialize(out);
+    }
+
+    template<typename ProposalType>
+    void ModelMixin<ProposalType, std::unique_ptr<Model>>::deserialize(std::istream &in) {
+        BinarySerialization::readAll(in, coldness, proposalNegativeLogLikelihood, stateNegativeLogLikelihood);
+        proposal.deserialize(in);
+    }
+
     template<typename ProposalType>
     typename MatrixType::Scalar ModelMixin<ProposalType, std::unique_ptr<Model>>::computeNegativeLogLikelihood(const VectorType &x) {
 		return modelImpl->computeNegativeLogLikelihood(x);
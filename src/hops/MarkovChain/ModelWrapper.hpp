@@ -26,6 +26,14 @@ namespace hops {
             return model->computeNegativeLogLikelihood(state);
         }
 
+        /**
+         * @Brief Virtual because later mixins are allowed to override, e.g. Coldness
+         */
+        virtual void computeNegativeLogLikelihoods(const Eigen::Ref<const MatrixType> &states,
+                                                   Eigen::Ref<VectorType> negativeLogLikelihoods) {
+            model->computeNegativeLogLikelihoods(states, negativeLogLikelihoods);
+        }
+
         /**
          * @Brief Virtual because later mixins are allowed to override, e.g. Coldness
          */
@@ -33,6 +41,13 @@ namespace hops {
                 return model->computeLogLikelihoodGradient(state);
         }
 
+        /**
+         * @Brief Virtual because later mixins are allowed to override, e.g. Coldness
+         */
+        virtual bool computeLogLikelihoodGradientInto(const VectorType &state, Eigen::Ref<VectorType> gradient) {
+            return model->computeLogLikelihoodGradientInto(state, gradient);
+        }
+
         /**
          * @Brief Virtual because later mixins are allowed to override, e.g. Coldness
          */
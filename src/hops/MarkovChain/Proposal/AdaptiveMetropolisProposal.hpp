@@ -1,6 +1,7 @@
 #ifndef HOPS_ADAPTIVEMETROPOLISPROPOSAL_HPP
 #define HOPS_ADAPTIVEMETROPOLISPROPOSAL_HPP
 
+#include <Eigen/Cholesky>
 #include <optional>
 #include <random>
 #include <stdexcept>
@@ -8,6 +9,7 @@
 #include "hops/MarkovChain/Proposal/Proposal.hpp"
 #include "hops/Polytope/MaximumVolumeEllipsoid.hpp"
 #include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
+#include "hops/Utility/BinarySerialization.hpp"
 #include "hops/Utility/DefaultDimensionNames.hpp"
 #include "hops/Utility/MatrixType.hpp"
 #include "hops/Utility/StringUtility.hpp"
@@ -54,8 +56,12 @@ namespace hops {
 
         [[nodiscard]] VectorType getState() const override;
 
+        void copyStateTo(Eigen::Ref<VectorType> destination) const override;
+
         [[nodiscard]] VectorType getProposal() const override;
 
+        void copyProposalTo(Eigen::Ref<VectorType> destination) const override;
+
         void setDimensionNames(const std::vector<std::string> &names) override;
 
         [[nodiscard]] std::vector<std::string> getDimensionNames() const override;
@@ -88,13 +94,17 @@ namespace hops {
 
         void resetDistributions() override;
 
+        void serialize(std::ostream &out) const override;
+
+        void deserialize(std::istream &in) override;
+
     protected:
         // These protected types are/should be accessed in BillliardAdaptiveMetropolisProposal only
         MatrixType A;
         VectorType b;
+        VectorType state;
 
     private:
-        VectorType state;
         VectorType proposal;
 
         VectorType stateMean;
@@ -121,17 +131,31 @@ namespace hops {
 
         std::normal_distribution<double> normal;
 
-        MatrixType updateCovariance(const MatrixType &covariance, const VectorType &mean, const VectorType &newState) {
+        // Workspaces, such that propose and computeLogAcceptanceProbability do not allocate after the first call.
+        VectorType standardNormalSample;
+        VectorType constraintValues;
+        VectorType newMean;
+        VectorType stateDifference;
+        VectorType whitenedStateDifference;
+        Eigen::LLT<MatrixType> proposalCovarianceSolver;
+
+        /**
+         * @brief Writes the covariance updated with newState into newCovariance, which must not alias covariance.
+         */
+        void updateCovariance(const MatrixType &covariance,
+                              const VectorType &mean,
+                              const VectorType &newState,
+                              MatrixType &newCovariance) {
             assert(t > 0 && "cannot update covariance without samples having been drawn");
 
             // recursive mean
-            VectorType newMean = (t * mean + newState) / (t + 1);
-            MatrixType newCovariance = ((t - 1) * covariance
-                                        + t * (mean * mean.transpose())
-                                        - (t + 1) * (newMean * newMean.transpose())
-                                        + newState * newState.transpose()
-                                        + eps * maximumVolumeEllipsoid) / t;
-            return newCovariance;
+            newMean = (t * mean + newState) / (t + 1);
+            // Outer products are evaluated lazily, because they are rank one and need no temporaries that way.
+            newCovariance = ((t - 1) * covariance
+                             + t * mean.lazyProduct(mean.transpose())
+                             - (t + 1) * newMean.lazyProduct(newMean.transpose())
+                             + newState.lazyProduct(newState.transpose())
+                             + eps * maximumVolumeEllipsoid) / t;
         }
     };
 
@@ -215,15 +239,17 @@ namespace hops {
             RandomNumberGenerator &randomNumberGenerator) {
         stateMean = (t * stateMean + state) / (t + 1);
 
-        for (long i = 0; i < proposal.rows(); ++i) {
-            proposal(i) = normal(randomNumberGenerator);
+        standardNormalSample.resize(proposal.rows());
+        for (long i = 0; i < standardNormalSample.rows(); ++i) {
+            standardNormalSample(i) = normal(randomNumberGenerator);
         }
 
         if (t > warmUp) {
-            proposal = state + stateCholeskyOfCovariance * proposal;
+            proposal.noalias() = stateCholeskyOfCovariance * standardNormalSample;
+            proposal += state;
         } else {
-            proposal = state +
-                       eps * choleskyOfMaximumVolumeEllipsoid.template triangularView<Eigen::Lower>().solve(proposal);
+            choleskyOfMaximumVolumeEllipsoid.template triangularView<Eigen::Lower>().solveInPlace(standardNormalSample);
+            proposal = state + eps * standardNormalSample;
         };
         ++t; // increment time
 
@@ -232,34 +258,35 @@ namespace hops {
 
     template<typename InternalMatrixType>
     double AdaptiveMetropolisProposal<InternalMatrixType>::computeLogAcceptanceProbability() {
-        bool isProposalInteriorPoint = ((A * proposal - b).array() < -boundaryCushion).all();
+        constraintValues.noalias() = A * proposal;
+        bool isProposalInteriorPoint = ((constraintValues - b).array() < -boundaryCushion).all();
         if (!isProposalInteriorPoint) {
             return -std::numeric_limits<double>::infinity();
         }
 
-        proposalCovariance = updateCovariance(stateCovariance, stateMean, proposal);
-        Eigen::LLT<decltype(proposalCovariance)> solver(
-                proposalCovariance);
-        if (solver.info() != Eigen::Success) {
+        updateCovariance(stateCovariance, stateMean, proposal, proposalCovariance);
+        proposalCovarianceSolver.compute(proposalCovariance);
+        if (proposalCovarianceSolver.info() != Eigen::Success) {
             return -std::numeric_limits<double>::infinity();
         }
-        proposalCholeskyOfCovariance = solver.matrixL();
+        proposalCholeskyOfCovariance = proposalCovarianceSolver.matrixL();
 
         proposalLogSqrtDeterminant = proposalCholeskyOfCovariance.diagonal().array().log().sum();
-        VectorType stateDifference = proposal - state;
+        stateDifference = proposal - state;
 
         double alpha = 0;
 
         // before warm up we have a symmetrical m_proposal distribution, so we do the next bit only after warm up
         if (t > warmUp) {
+            whitenedStateDifference = stateDifference;
+            proposalCholeskyOfCovariance.template triangularView<Eigen::Lower>().solveInPlace(
+                    whitenedStateDifference);
+            double proposalSquaredNorm = whitenedStateDifference.squaredNorm();
+            whitenedStateDifference = stateDifference;
+            stateCholeskyOfCovariance.template triangularView<Eigen::Lower>().solveInPlace(whitenedStateDifference);
             alpha = stateLogSqrtDeterminant
                     - proposalLogSqrtDeterminant
-                    - 0.5 * (
-                    proposalCholeskyOfCovariance.template triangularView<Eigen::Lower>().solve(
-                            stateDifference).squaredNorm()
-                    - stateCholeskyOfCovariance.template triangularView<Eigen::Lower>().solve(
-                            stateDifference).squaredNorm()
-            );
+                    - 0.5 * (proposalSquaredNorm - whitenedStateDifference.squaredNorm());
         }
 
         return alpha;
@@ -312,11 +339,21 @@ namespace hops {
         return state;
     }
 
+    template<typename InternalMatrixType>
+    void AdaptiveMetropolisProposal<InternalMatrixType>::copyStateTo(Eigen::Ref<VectorType> destination) const {
+        destination = state;
+    }
+
     template<typename InternalMatrixType>
     VectorType AdaptiveMetropolisProposal<InternalMatrixType>::getProposal() const {
         return proposal;
     }
 
+    template<typename InternalMatrixType>
+    void AdaptiveMetropolisProposal<InternalMatrixType>::copyProposalTo(Eigen::Ref<VectorType> destination) const {
+        destination = proposal;
+    }
+
     template<typename InternalMatrixType>
     void AdaptiveMetropolisProposal<InternalMatrixType>::setParameter(
             const ProposalParameter &parameter, const std::any &value) {
@@ -326,6 +363,16 @@ namespace hops {
             this->eps = std::any_cast<double>(value);
         } else if (parameter == ProposalParameter::WARM_UP) {
             this->warmUp = std::any_cast<long>(value);
+        } else if (parameter == ProposalParameter::COVARIANCE) {
+            // Replaces the adapted covariance, e.g. by one that was pooled from several chains.
+            auto covariance = std::any_cast<MatrixType>(value);
+            Eigen::LLT<MatrixType> solver(covariance);
+            if (covariance.rows() != state.rows() || solver.info() != Eigen::Success) {
+                throw std::invalid_argument("Covariance has to be positive definite with the dimension of the state.");
+            }
+            stateCovariance = std::move(covariance);
+            stateCholeskyOfCovariance = solver.matrixL();
+            stateLogSqrtDeterminant = stateCholeskyOfCovariance.diagonal().array().log().sum();
         } else {
             throw std::invalid_argument("Can't get parameter which doesn't exist in " + this->getProposalName());
         }
@@ -338,6 +385,7 @@ namespace hops {
                 ProposalParameterName[static_cast<int>(ProposalParameter::BOUNDARY_CUSHION)],
                 ProposalParameterName[static_cast<int>(ProposalParameter::EPSILON)],
                 ProposalParameterName[static_cast<int>(ProposalParameter::WARM_UP)],
+                ProposalParameterName[static_cast<int>(ProposalParameter::COVARIANCE)],
         };
     }
 
@@ -350,6 +398,8 @@ namespace hops {
             return std::any(eps);
         } else if (parameter == ProposalParameter::WARM_UP) {
             return std::any(warmUp);
+        } else if (parameter == ProposalParameter::COVARIANCE) {
+            return std::any(stateCovariance);
         } else {
             throw std::invalid_argument("Can't get parameter which doesn't exist in " + this->getProposalName());
         }
@@ -364,6 +414,8 @@ namespace hops {
             return "double";
         } else if (parameter == ProposalParameter::WARM_UP) {
             return "long";
+        } else if (parameter == ProposalParameter::COVARIANCE) {
+            return "MatrixType";
         } else {
             throw std::invalid_argument("Can't get parameter which doesn't exist in " + this->getProposalName());
         }
@@ -410,6 +462,24 @@ namespace hops {
     void AdaptiveMetropolisProposal<InternalMatrixType>::resetDistributions() {
         normal.reset();
     }
+
+    template<typename InternalMatrixType>
+    void AdaptiveMetropolisProposal<InternalMatrixType>::serialize(std::ostream &out) const {
+        BinarySerialization::writeAll(out, state, proposal, stateMean, stateCovariance, proposalCovariance,
+                                      maximumVolumeEllipsoid, stateCholeskyOfCovariance, proposalCholeskyOfCovariance,
+                                      choleskyOfMaximumVolumeEllipsoid, stateLogSqrtDeterminant,
+                                      proposalLogSqrtDeterminant, t, warmUp, eps, boundaryCushion, dimensionNames,
+                                      normal);
+    }
+
+    template<typename InternalMatrixType>
+    void AdaptiveMetropolisProposal<InternalMatrixType>::deserialize(std::istream &in) {
+        BinarySerialization::readAll(in, state, proposal, stateMean, stateCovariance, proposalCovariance,
+                                     maximumVolumeEllipsoid, stateCholeskyOfCovariance, proposalCholeskyOfCovariance,
+                                     choleskyOfMaximumVolumeEllipsoid, stateLogSqrtDeterminant,
+                                     proposalLogSqrtDeterminant, t, warmUp, eps, boundaryCushion, dimensionNames,
+                                     normal);
+    }
 }
 
 #endif //HOPS_ADAPTIVEMETROPOLISPROPOSAL_HPP
@@ -5,6 +5,8 @@
 #include <random>
 
 #include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
+#include "hops/Utility/BinarySerialization.hpp"
+#include "hops/Utility/DefaultDimensionNames.hpp"
 #include "hops/Utility/MatrixType.hpp"
 #include "hops/Utility/StringUtility.hpp"
 #include "hops/Utility/VectorType.hpp"
@@ -36,8 +38,12 @@ namespace hops {
 
         [[nodiscard]] VectorType getState() const override;
 
+        void copyStateTo(Eigen::Ref<VectorType> destination) const override;
+
         [[nodiscard]] VectorType getProposal() const override;
 
+        void copyProposalTo(Eigen::Ref<VectorType> destination) const override;
+
         void setDimensionNames(const std::vector<std::string> &names) override;
 
         [[nodiscard]] std::vector<std::string> getDimensionNames() const override;
@@ -68,6 +74,10 @@ namespace hops {
 
         void resetDistributions() override;
 
+        void serialize(std::ostream &out) const override;
+
+        void deserialize(std::istream &in) override;
+
     private:
         InternalMatrixType A;
         InternalVectorType b;
@@ -78,6 +88,8 @@ namespace hops {
 
         std::vector<std::string> dimensionNames;
 
+        VectorType constraintValues; // workspace for the interior point check
+
         std::uniform_real_distribution<typename InternalMatrixType::Scalar> uniform;
         std::normal_distribution<typename InternalMatrixType::Scalar> normal;
     };
@@ -152,7 +164,8 @@ namespace hops {
 
     template<typename InternalMatrixType, typename InternalVectorType>
     double BallWalkProposal<InternalMatrixType, InternalVectorType>::computeLogAcceptanceProbability() {
-        bool isProposalInteriorPoint = ((A * proposal - b).array() < 0).all();
+        constraintValues.noalias() = A * proposal;
+        bool isProposalInteriorPoint = ((constraintValues - b).array() < 0).all();
         if (!isProposalInteriorPoint) {
             return -std::numeric_limits<typename InternalMatrixType::Scalar>::infinity();
         }
@@ -174,11 +187,21 @@ namespace hops {
         return state;
     }
 
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void BallWalkProposal<InternalMatrixType, InternalVectorType>::copyStateTo(Eigen::Ref<VectorType> destination) const {
+        destination = state;
+    }
+
     template<typename InternalMatrixType, typename InternalVectorType>
     VectorType BallWalkProposal<InternalMatrixType, InternalVectorType>::getProposal() const {
         return proposal;
     }
 
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void BallWalkProposal<InternalMatrixType, InternalVectorType>::copyProposalTo(Eigen::Ref<VectorType> destination) const {
+        destination = proposal;
+    }
+
     template<typename InternalMatrixType, typename InternalVectorType>
     void BallWalkProposal<InternalMatrixType, InternalVectorType>::setParameter(const ProposalParameter &parameter,
                                                                                 const std::any &value) {
@@ -247,6 +270,16 @@ namespace hops {
         normal.reset();
         uniform.reset();
     }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void BallWalkProposal<InternalMatrixType, InternalVectorType>::serialize(std::ostream &out) const {
+        BinarySerialization::writeAll(out, state, proposal, stepSize, dimensionNames, normal);
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void BallWalkProposal<InternalMatrixType, InternalVectorType>::deserialize(std::istream &in) {
+        BinarySerialization::readAll(in, state, proposal, stepSize, dimensionNames, normal);
+    }
 }
 
 
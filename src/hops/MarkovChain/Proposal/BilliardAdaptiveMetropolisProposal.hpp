@@ -54,8 +54,13 @@ namespace hops {
 
         void resetDistributions() override;
 
+        void serialize(std::ostream &out) const override;
+
+        void deserialize(std::istream &in) override;
+
     private:
         long m_maxReflections;
+        Reflector::Workspace reflectorWorkspace;
     };
 
     template<typename InternalMatrixType>
@@ -109,12 +114,8 @@ namespace hops {
             RandomNumberGenerator &randomNumberGenerator) {
         VectorType &proposal = AdaptiveMetropolisProposal<InternalMatrixType>::propose(
                 randomNumberGenerator);
-        const VectorType &state = AdaptiveMetropolisProposal<InternalMatrixType>::getState();
-
 
-        const auto &reflectionResult = Reflector::reflectIntoPolytope(this->A, this->b, state, proposal,
-                                                                      m_maxReflections);
-        proposal = std::get<2>(reflectionResult);
+        Reflector::reflectIntoPolytope(this->A, this->b, this->state, proposal, m_maxReflections, reflectorWorkspace);
         return proposal;
     }
 
@@ -183,6 +184,18 @@ namespace hops {
     std::vector<std::string> BilliardAdaptiveMetropolisProposal<InternalMatrixType>::getDimensionNames() const {
         return AdaptiveMetropolisProposal<InternalMatrixType>::getDimensionNames();
     }
+
+    template<typename InternalMatrixType>
+    void BilliardAdaptiveMetropolisProposal<InternalMatrixType>::serialize(std::ostream &out) const {
+        AdaptiveMetropolisProposal<InternalMatrixType>::serialize(out);
+        BinarySerialization::write(out, m_maxReflections);
+    }
+
+    template<typename InternalMatrixType>
+    void BilliardAdaptiveMetropolisProposal<InternalMatrixType>::deserialize(std::istream &in) {
+        AdaptiveMetropolisProposal<InternalMatrixType>::deserialize(in);
+        BinarySerialization::read(in, m_maxReflections);
+    }
 }
 
 #endif //HOPS_BILLIARDADAPTIVEMETROPOLISPROPOSAL_HPP
@@ -9,12 +9,14 @@
 
 #include "hops/Model/Model.hpp"
 #include "hops/Transformation/Transformation.hpp"
+#include "hops/Utility/BinarySerialization.hpp"
 #include "hops/Utility/DefaultDimensionNames.hpp"
 #include "hops/Utility/LogSqrtDeterminant.hpp"
 #include "hops/Utility/MatrixType.hpp"
 #include "hops/Utility/StringUtility.hpp"
 #include "hops/Utility/VectorType.hpp"
 
+#include "IsComputeLogLikelihoodGradientIntoAvailable.hpp"
 #include "Proposal.hpp"
 #include "Reflector.hpp"
 
@@ -69,8 +71,12 @@ namespace hops {
 
         [[nodiscard]] VectorType getState() const override;
 
+        void copyStateTo(Eigen::Ref<VectorType> destination) const override;
+
         [[nodiscard]] VectorType getProposal() const override;
 
+        void copyProposalTo(Eigen::Ref<VectorType> destination) const override;
+
         [[nodiscard]] std::vector<std::string> getDimensionNames() const override;
 
         [[nodiscard]] std::optional<double> getStepSize() const override;
@@ -109,8 +115,15 @@ namespace hops {
 
         virtual void resetDistributions() override;
 
+        void serialize(std::ostream &out) const override;
+
+        void deserialize(std::istream &in) override;
+
     private:
-        VectorType computeGradient(VectorType x);
+        /**
+         * @brief Writes the gradient at x into the gradient member.
+         */
+        void computeGradient(const VectorType &x);
 
         InternalMatrixType A;
         MatrixType Adense;
@@ -146,6 +159,13 @@ namespace hops {
 
         long maxNumberOfReflections;
         double coldness=1;
+
+        // Workspaces, such that the steps do not allocate for models with constant expected fisher information.
+        VectorType gradient;
+        VectorType constraintValues;
+        VectorType difference;
+        Eigen::Matrix<typename MatrixType::Scalar, 1, Eigen::Dynamic> weightedDifference;
+        Reflector::Workspace reflectorWorkspace;
     };
 
     template<typename ModelType, typename InternalMatrixType>
@@ -217,27 +237,29 @@ namespace hops {
         for (long i = 0; i < proposal.rows(); ++i) {
             proposal(i) = normalDistribution(rng);
         }
-        unreflectedProposal = driftedState + covarianceFactor * stateSolver.matrixU().solve(proposal);
+        stateSolver.matrixU().solveInPlace(proposal);
+        unreflectedProposal = driftedState + covarianceFactor * proposal;
 
-        std::tuple<bool, long, VectorType> reflectionResult;
+        proposal = unreflectedProposal;
         if (quadraticConstraintsMatrix) {
-            reflectionResult = Reflector::reflectIntoPolytope(Adense,
-                                                              b,
-                                                              quadraticConstraintsMatrix.value(),
-                                                              quadraticConstraintsOffset.value(),
-                                                              quadraticConstraintsLhs.value(),
-                                                              state,
-                                                              unreflectedProposal,
-                                                              maxNumberOfReflections);
+            Reflector::reflectIntoPolytope(Adense,
+                                           b,
+                                           quadraticConstraintsMatrix.value(),
+                                           quadraticConstraintsOffset.value(),
+                                           quadraticConstraintsLhs.value(),
+                                           state,
+                                           proposal,
+                                           maxNumberOfReflections,
+                                           reflectorWorkspace);
         } else {
-            reflectionResult = Reflector::reflectIntoPolytope(Adense,
-                                                              b,
-                                                              state,
-                                                              unreflectedProposal,
-                                                              maxNumberOfReflections);
+            Reflector::reflectIntoPolytope(Adense,
+                                           b,
+                                           state,
+                                           proposal,
+                                           maxNumberOfReflections,
+                                           reflectorWorkspace);
         }
 
-        proposal = std::get<2>(reflectionResult);
         return proposal;
     }
 
@@ -248,7 +270,7 @@ namespace hops {
         stateNegativeLogLikelihood = proposalNegativeLogLikelihood;
         unreflectedProposal = state;
         if (!ModelType::hasConstantExpectedFisherInformation()) {
-            stateSolver = proposalSolver;
+            std::swap(stateSolver, proposalSolver);
             stateMetric.swap(proposalMetric);
             stateLogSqrtDeterminant = proposalLogSqrtDeterminant;
         }
@@ -264,7 +286,7 @@ namespace hops {
         state = newState;
         // Important: compute gradient before fisher info or else 13CFLUX2 will throw, since it uses internal
         // gradient data to construct fisher information.
-        VectorType gradient = computeGradient(state);
+        computeGradient(state);
 
         if (!ModelType::hasConstantExpectedFisherInformation()) {
             std::optional<decltype(stateMetric)> optionalFisherInformation = ModelType::computeExpectedFisherInformation(
@@ -320,12 +342,13 @@ namespace hops {
 
     template<typename ModelType, typename InternalMatrixType>
     double BilliardMALAProposal<ModelType, InternalMatrixType>::computeLogAcceptanceProbability() {
-        bool isProposalInteriorPoint = ((A * proposal - b).array() < 0).all();
+        constraintValues.noalias() = A * proposal;
+        bool isProposalInteriorPoint = ((constraintValues - b).array() < 0).all();
         if (!isProposalInteriorPoint) {
             return -std::numeric_limits<double>::infinity();
         }
         // Important: compute gradient before fisher info or else x3cflux2 will throw
-        VectorType gradient = computeGradient(proposal);
+        computeGradient(proposal);
 
         if (!ModelType::hasConstantExpectedFisherInformation()) {
             std::optional<decltype(proposalMetric)> optionalFisherInformation = ModelType::computeExpectedFisherInformation(
@@ -336,7 +359,7 @@ namespace hops {
                 proposalMetric = MatrixType::Identity(state.rows(), state.rows());
             }
 
-            proposalSolver = Eigen::LLT<MatrixType>(proposalMetric);
+            proposalSolver.compute(proposalMetric);
             if (proposalSolver.info() != Eigen::Success) {
                 // state is not valid, because metric is not positive definite.
                 return -std::numeric_limits<double>::infinity();
@@ -344,17 +367,18 @@ namespace hops {
             proposalLogSqrtDeterminant = logSqrtDeterminant(Eigen::MatrixXd(proposalSolver.matrixL()));
         }
 
-        driftedProposal = proposal +
-                          0.5 * std::pow(covarianceFactor, 2) *
-                          proposalSolver.matrixU().solve(
-                                  proposalSolver.matrixL().solve(gradient));
+        proposalSolver.matrixL().solveInPlace(gradient);
+        proposalSolver.matrixU().solveInPlace(gradient);
+        driftedProposal = proposal + 0.5 * std::pow(covarianceFactor, 2) * gradient;
 
         proposalNegativeLogLikelihood = ModelType::computeNegativeLogLikelihood(proposal);
 
-        double normDifference =
-                static_cast<double>((driftedState - unreflectedProposal).transpose() * stateMetric *
-                                    (driftedState - unreflectedProposal)) -
-                static_cast<double>((state - driftedProposal).transpose() * proposalMetric * (state - driftedProposal));
+        difference = driftedState - unreflectedProposal;
+        weightedDifference.noalias() = difference.transpose() * stateMetric;
+        double normDifference = static_cast<double>(weightedDifference * difference);
+        difference = state - driftedProposal;
+        weightedDifference.noalias() = difference.transpose() * proposalMetric;
+        normDifference -= static_cast<double>(weightedDifference * difference);
 
         return coldness * (-proposalNegativeLogLikelihood
                + stateNegativeLogLikelihood)
@@ -364,12 +388,21 @@ namespace hops {
     }
 
     template<typename ModelType, typename InternalMatrixType>
-    VectorType BilliardMALAProposal<ModelType, InternalMatrixType>::computeGradient(VectorType x) {
-        std::optional<Eigen::VectorXd> gradient = ModelType::computeLogLikelihoodGradient(x);
-        if (gradient) {
-            return coldness*gradient.value();
+    void BilliardMALAProposal<ModelType, InternalMatrixType>::computeGradient(const VectorType &x) {
+        if constexpr (IsComputeLogLikelihoodGradientIntoAvailable<ModelType>::value) {
+            gradient.resize(x.rows());
+            if (ModelType::computeLogLikelihoodGradientInto(x, gradient)) {
+                gradient *= coldness;
+                return;
+            }
+        } else {
+            std::optional<Eigen::VectorXd> optionalGradient = ModelType::computeLogLikelihoodGradient(x);
+            if (optionalGradient) {
+                gradient = coldness * optionalGradient.value();
+                return;
+            }
         }
-        return VectorType::Zero(x.rows());
+        gradient.setZero(x.rows());
     }
 
     template<typename ModelType, typename InternalMatrixType>
@@ -387,11 +420,21 @@ namespace hops {
         return state;
     }
 
+    template<typename ModelType, typename InternalMatrixType>
+    void BilliardMALAProposal<ModelType, InternalMatrixType>::copyStateTo(Eigen::Ref<VectorType> destination) const {
+        destination = state;
+    }
+
     template<typename ModelType, typename InternalMatrixType>
     VectorType BilliardMALAProposal<ModelType, InternalMatrixType>::getProposal() const {
         return proposal;
     }
 
+    template<typename ModelType, typename InternalMatrixType>
+    void BilliardMALAProposal<ModelType, InternalMatrixType>::copyProposalTo(Eigen::Ref<VectorType> destination) const {
+        destination = proposal;
+    }
+
     template<typename ModelType, typename InternalMatrixType>
     std::vector<std::string> BilliardMALAProposal<ModelType, InternalMatrixType>::getParameterNames() const {
         return {"step_size", "max_reflections", "coldness"};
@@ -487,6 +530,27 @@ namespace hops {
     void BilliardMALAProposal<ModelType, InternalMatrixType>::resetDistributions() {
         normalDistribution.reset();
     }
+
+    template<typename ModelType, typename InternalMatrixType>
+    void BilliardMALAProposal<ModelType, InternalMatrixType>::serialize(std::ostream &out) const {
+        BinarySerialization::writeAll(out, state, driftedState, proposal, unreflectedProposal, driftedProposal,
+                                      stateLogSqrtDeterminant, proposalLogSqrtDeterminant, stateNegativeLogLikelihood,
+                                      proposalNegativeLogLikelihood, stateMetric, proposalMetric, stepSize,
+                                      geometricFactor, covarianceFactor, dimensionNames, normalDistribution,
+                                      maxNumberOfReflections, coldness);
+    }
+
+    template<typename ModelType, typename InternalMatrixType>
+    void BilliardMALAProposal<ModelType, InternalMatrixType>::deserialize(std::istream &in) {
+        BinarySerialization::readAll(in, state, driftedState, proposal, unreflectedProposal, driftedProposal,
+                                     stateLogSqrtDeterminant, proposalLogSqrtDeterminant, stateNegativeLogLikelihood,
+                                     proposalNegativeLogLikelihood, stateMetric, proposalMetric, stepSize,
+                                     geometricFactor, covarianceFactor, dimensionNames, normalDistribution,
+                                     maxNumberOfReflections, coldness);
+        // The decompositions are deterministic, so recomputing them reproduces the stored ones bitwise.
+        stateSolver.compute(stateMetric);
+        proposalSolver.compute(proposalMetric);
+    }
 }// namespace hops
 
 #endif//HOPS_BILLIARDMALA_HPP
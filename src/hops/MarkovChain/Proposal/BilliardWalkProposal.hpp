@@ -5,6 +5,7 @@
 #include <random>
 #include <utility>
 
+#include "hops/Utility/BinarySerialization.hpp"
 #include "hops/Utility/DefaultDimensionNames.hpp"
 #include "hops/Utility/MatrixType.hpp"
 #include "hops/Utility/StringUtility.hpp"
@@ -49,8 +50,12 @@ namespace hops {
 
         [[nodiscard]] VectorType getState() const override;
 
+        void copyStateTo(Eigen::Ref<VectorType> destination) const override;
+
         [[nodiscard]] VectorType getProposal() const override;
 
+        void copyProposalTo(Eigen::Ref<VectorType> destination) const override;
+
         [[nodiscard]] std::vector<std::string> getDimensionNames() const override;
 
         [[nodiscard]] std::optional<double> getStepSize() const override;
@@ -85,6 +90,10 @@ namespace hops {
 
         virtual void resetDistributions() override;
 
+        void serialize(std::ostream &out) const override;
+
+        void deserialize(std::istream &in) override;
+
     private:
         InternalMatrixType A;
         MatrixType Adense;
@@ -107,6 +116,9 @@ namespace hops {
         std::vector<std::string> dimensionNames;
 
         std::normal_distribution<double> normalDistribution{0., 1.};
+
+        Reflector::Workspace reflectorWorkspace;
+        VectorType constraintValues;
     };
 
     /*
@@ -141,15 +153,12 @@ namespace hops {
         proposal = state + step*updateDirection;
 
 
-        std::tuple<bool, long, VectorType> reflectionResult = Reflector::reflectIntoPolytope(Adense,
+        std::tie(reflectionSuccessful, numberOfReflections) = Reflector::reflectIntoPolytope(Adense,
                                                                                              b,
                                                                                              state,
                                                                                              proposal,
-                                                                                             maxNumberOfReflections);
-
-        reflectionSuccessful = std::get<0>(reflectionResult);
-        numberOfReflections = std::get<1>(reflectionResult);
-        proposal = std::get<2>(reflectionResult);
+                                                                                             maxNumberOfReflections,
+                                                                                             reflectorWorkspace);
         return proposal;
     }
 
@@ -189,7 +198,8 @@ namespace hops {
 
     template<typename InternalMatrixType>
     double BilliardWalkProposal<InternalMatrixType>::computeLogAcceptanceProbability() {
-        bool isProposalInteriorPoint = ((A * proposal - b).array() < 0).all();
+        constraintValues.noalias() = A * proposal;
+        bool isProposalInteriorPoint = ((constraintValues - b).array() < 0).all();
         if (not isProposalInteriorPoint || not this->reflectionSuccessful) {
             return -std::numeric_limits<double>::infinity();
         }
@@ -211,11 +221,21 @@ namespace hops {
         return state;
     }
 
+    template<typename InternalMatrixType>
+    void BilliardWalkProposal<InternalMatrixType>::copyStateTo(Eigen::Ref<VectorType> destination) const {
+        destination = state;
+    }
+
     template<typename InternalMatrixType>
     VectorType BilliardWalkProposal<InternalMatrixType>::getProposal() const {
         return proposal;
     }
 
+    template<typename InternalMatrixType>
+    void BilliardWalkProposal<InternalMatrixType>::copyProposalTo(Eigen::Ref<VectorType> destination) const {
+        destination = proposal;
+    }
+
     template<typename InternalMatrixType>
     std::vector<std::string> BilliardWalkProposal<InternalMatrixType>::getParameterNames() const {
         return {"step_size", "max_reflections"};
@@ -299,6 +319,20 @@ namespace hops {
         normalDistribution.reset();
         chordStepDistribution.reset();
     }
+
+    template<typename InternalMatrixType>
+    void BilliardWalkProposal<InternalMatrixType>::serialize(std::ostream &out) const {
+        BinarySerialization::writeAll(out, state, proposal, unreflectedProposal, stepSize, maxNumberOfReflections,
+                                      reflectionSuccessful, numberOfReflections, updateDirection, step, dimensionNames,
+                                      normalDistribution);
+    }
+
+    template<typename InternalMatrixType>
+    void BilliardWalkProposal<InternalMatrixType>::deserialize(std::istream &in) {
+        BinarySerialization::readAll(in, state, proposal, unreflectedProposal, stepSize, maxNumberOfReflections,
+                                     reflectionSuccessful, numberOfReflections, updateDirection, step, dimensionNames,
+                                     normalDistribution);
+    }
 }// namespace hops
 
 #endif//HOPS_BILLIARDWALKPROPOSAL_HPP
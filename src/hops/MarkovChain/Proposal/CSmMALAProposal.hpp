@@ -8,6 +8,7 @@
 
 #include "hops/MarkovChain/Recorder/IsAddMessageAvailabe.hpp"
 #include "hops/Model/Model.hpp"
+#include "hops/Utility/BinarySerialization.hpp"
 #include "hops/Utility/DefaultDimensionNames.hpp"
 #include "hops/Utility/MatrixType.hpp"
 #include "hops/Utility/LogSqrtDeterminant.hpp"
@@ -15,6 +16,7 @@
 #include "hops/Utility/VectorType.hpp"
 
 #include "DikinEllipsoidCalculator.hpp"
+#include "IsComputeLogLikelihoodGradientIntoAvailable.hpp"
 #include "Proposal.hpp"
 
 namespace hops {
@@ -52,8 +54,12 @@ namespace hops {
 
         [[nodiscard]] VectorType getState() const override;
 
+        void copyStateTo(Eigen::Ref<VectorType> destination) const override;
+
         [[nodiscard]] VectorType getProposal() const override;
 
+        void copyProposalTo(Eigen::Ref<VectorType> destination) const override;
+
         void setDimensionNames(const std::vector<std::string> &names) override;
 
         [[nodiscard]] std::vector<std::string> getDimensionNames() const override;
@@ -92,8 +98,20 @@ namespace hops {
 
         void resetDistributions() override;
 
+        void serialize(std::ostream &out) const override;
+
+        void deserialize(std::istream &in) override;
+
     private:
-        VectorType computeTruncatedGradient(VectorType x);
+        /**
+         * @brief Writes the normalized gradient at x into the gradient member.
+         */
+        void computeTruncatedGradient(const VectorType &x);
+
+        /**
+         * @brief Adds the weighted fisher information and Dikin ellipsoid at x to metric.
+         */
+        void addToMetric(const VectorType &x, MatrixType &metric);
 
         InternalMatrixType A;
         MatrixType Adense;
@@ -123,6 +141,14 @@ namespace hops {
         DikinEllipsoidCalculator<MatrixType, VectorType> dikinEllipsoidCalculator;
 
         std::vector<std::string> dimensionNames;
+
+        // Workspaces, such that the steps do not allocate for models with constant expected fisher information.
+        VectorType gradient;
+        VectorType constraintValues;
+        VectorType difference;
+        Eigen::Matrix<typename MatrixType::Scalar, 1, Eigen::Dynamic> weightedDifference;
+        MatrixType dikinEllipsoid;
+        std::optional<MatrixType> constantFisherInformation;
     };
 
     template<typename ModelType, typename InternalMatrixType>
@@ -164,7 +190,8 @@ namespace hops {
         for (long i = 0; i < proposal.rows(); ++i) {
             proposal(i) = normalDistribution(rng);
         }
-        proposal = driftedState + covarianceFactor * (stateSolver.matrixL().transpose().solve(proposal));
+        stateSolver.matrixL().transpose().solveInPlace(proposal);
+        proposal = driftedState + covarianceFactor * proposal;
 
         return proposal;
     }
@@ -173,7 +200,7 @@ namespace hops {
     VectorType &CSmMALAProposal<ModelType, InternalMatrixType>::acceptProposal() {
         state.swap(proposal);
         driftedState.swap(driftedProposal);
-        stateSolver = proposalSolver;
+        std::swap(stateSolver, proposalSolver);
         stateMetric.swap(proposalMetric);
         stateLogSqrtDeterminant = proposalLogSqrtDeterminant;
         stateNegativeLogLikelihood = proposalNegativeLogLikelihood;
@@ -190,29 +217,22 @@ namespace hops {
 
         // Important: compute gradient before fisher info or else 13CFLUX2 will throw, since it uses internal
         // gradient data to construct fisher information.
-        VectorType gradient = computeTruncatedGradient(state);
-        stateMetric.setZero();
-        if (fisherWeight != 0) {
-            std::optional<decltype(stateMetric)> optionalFisherInformation = ModelType::computeExpectedFisherInformation(
-                    state);
-            if (optionalFisherInformation) {
-                decltype(stateMetric) fisherInformation = optionalFisherInformation.value();
-                stateMetric += fisherWeight * fisherScale * fisherInformation;
-            }
-        }
-        if (fisherWeight != 1.) {
-            decltype(stateMetric) dikinEllipsoid = dikinEllipsoidCalculator.computeDikinEllipsoid(state);
-            stateMetric += (1 - fisherWeight) * dikinEllipsoid;
+        computeTruncatedGradient(state);
+        if (ModelType::hasConstantExpectedFisherInformation()) {
+            constantFisherInformation = ModelType::computeExpectedFisherInformation(state);
         }
+        stateMetric.setZero();
+        addToMetric(state, stateMetric);
 
-        stateSolver = Eigen::LLT<MatrixType>(stateMetric);
+        stateSolver.compute(stateMetric);
         if (stateSolver.info() != Eigen::Success) {
             throw std::runtime_error("cholesky decomposition of fisher information failed,"
                                      "because fisher information is not positive definite.");
         };
         stateLogSqrtDeterminant = logSqrtDeterminant(stateSolver.matrixLLT());
-        driftedState = state + 0.5 * std::pow(covarianceFactor, 2) *
-                               stateSolver.matrixL().transpose().solve(stateSolver.matrixL().solve(gradient));
+        stateSolver.matrixL().solveInPlace(gradient);
+        stateSolver.matrixL().transpose().solveInPlace(gradient);
+        driftedState = state + 0.5 * std::pow(covarianceFactor, 2) * gradient;
         stateNegativeLogLikelihood = ModelType::computeNegativeLogLikelihood(state);
     }
 
@@ -248,44 +268,35 @@ namespace hops {
 
     template<typename ModelType, typename InternalMatrixType>
     double CSmMALAProposal<ModelType, InternalMatrixType>::computeLogAcceptanceProbability() {
-        bool isProposalInteriorPoint = ((A * proposal - b).array() < 0).all();
+        constraintValues.noalias() = A * proposal;
+        bool isProposalInteriorPoint = ((constraintValues - b).array() < 0).all();
         if (!isProposalInteriorPoint) {
             return -std::numeric_limits<double>::infinity();
         }
 
         // Important: compute gradient before fisher info or else x3cflux2 will throw
-        VectorType gradient = computeTruncatedGradient(proposal);
+        computeTruncatedGradient(proposal);
         proposalMetric.setZero();
-        if (fisherWeight != 0) {
-            std::optional<decltype(proposalMetric)> optionalFisherInformation = ModelType::computeExpectedFisherInformation(
-                    proposal);
-            if (optionalFisherInformation) {
-                decltype(proposalMetric) fisherInformation = optionalFisherInformation.value();
-                proposalMetric += (fisherWeight * fisherScale * fisherInformation);
-            }
-        }
-        if (fisherWeight != 1) {
-            decltype(proposalMetric) dikinEllipsoid = dikinEllipsoidCalculator.computeDikinEllipsoid(proposal);
-            proposalMetric += (1 - fisherWeight) * dikinEllipsoid;
-
-        }
+        addToMetric(proposal, proposalMetric);
         proposalMetric = coldness*coldness*proposalMetric;
-        proposalSolver = Eigen::LLT<MatrixType>(proposalMetric);
+        proposalSolver.compute(proposalMetric);
         if (proposalSolver.info() != Eigen::Success) {
             // state is not valid, because metric is not positive definite.
             return -std::numeric_limits<double>::infinity();
         };
 
         proposalLogSqrtDeterminant = logSqrtDeterminant(proposalSolver.matrixLLT());
-        driftedProposal = proposal +
-                          0.5 * std::pow(covarianceFactor, 2) *
-                          proposalSolver.matrixL().transpose().solve(
-                                  proposalSolver.matrixL().solve(gradient));
+        proposalSolver.matrixL().solveInPlace(gradient);
+        proposalSolver.matrixL().transpose().solveInPlace(gradient);
+        driftedProposal = proposal + 0.5 * std::pow(covarianceFactor, 2) * gradient;
         proposalNegativeLogLikelihood = ModelType::computeNegativeLogLikelihood(proposal);
 
-        double normDifference =
-                static_cast<double>((driftedState - proposal).transpose() * stateMetric * (driftedState - proposal)) -
-                static_cast<double>((state - driftedProposal).transpose() * proposalMetric * (state - driftedProposal));
+        difference = driftedState - proposal;
+        weightedDifference.noalias() = difference.transpose() * stateMetric;
+        double normDifference = static_cast<double>(weightedDifference * difference);
+        difference = state - driftedProposal;
+        weightedDifference.noalias() = difference.transpose() * proposalMetric;
+        normDifference -= static_cast<double>(weightedDifference * difference);
 
         return coldness*(-proposalNegativeLogLikelihood
                + stateNegativeLogLikelihood)
@@ -295,16 +306,46 @@ namespace hops {
     }
 
     template<typename ModelType, typename InternalMatrixType>
-    VectorType CSmMALAProposal<ModelType, InternalMatrixType>::computeTruncatedGradient(VectorType x) {
-        auto gradient = ModelType::computeLogLikelihoodGradient(x);
-        if (gradient) {
-            double norm = gradient.value().norm();
-            if (norm != 0) {
-                gradient.value() /= norm;
+    void CSmMALAProposal<ModelType, InternalMatrixType>::computeTruncatedGradient(const VectorType &x) {
+        bool hasGradient = false;
+        if constexpr (IsComputeLogLikelihoodGradientIntoAvailable<ModelType>::value) {
+            gradient.resize(x.rows());
+            hasGradient = ModelType::computeLogLikelihoodGradientInto(x, gradient);
+        } else {
+            std::optional<VectorType> optionalGradient = ModelType::computeLogLikelihoodGradient(x);
+            if (optionalGradient) {
+                gradient = optionalGradient.value();
+                hasGradient = true;
+            }
+        }
+        if (!hasGradient) {
+            gradient.setZero(x.rows());
+            return;
+        }
+        double norm = gradient.norm();
+        if (norm != 0) {
+            gradient /= norm;
+        }
+    }
+
+    template<typename ModelType, typename InternalMatrixType>
+    void CSmMALAProposal<ModelType, InternalMatrixType>::addToMetric(const VectorType &x, MatrixType &metric) {
+        if (fisherWeight != 0) {
+            if (ModelType::hasConstantExpectedFisherInformation()) {
+                if (constantFisherInformation) {
+                    metric += fisherWeight * fisherScale * constantFisherInformation.value();
+                }
+            } else {
+                std::optional<MatrixType> optionalFisherInformation = ModelType::computeExpectedFisherInformation(x);
+                if (optionalFisherInformation) {
+                    metric += fisherWeight * fisherScale * optionalFisherInformation.value();
+                }
             }
-            return gradient.value();
         }
-        return VectorType::Zero(x.rows());
+        if (fisherWeight != 1) {
+            dikinEllipsoidCalculator.computeDikinEllipsoid(x, dikinEllipsoid);
+            metric += (1 - fisherWeight) * dikinEllipsoid;
+        }
     }
 
     template<typename ModelType, typename InternalMatrixType>
@@ -322,11 +363,21 @@ namespace hops {
         return state;
     }
 
+    template<typename ModelType, typename InternalMatrixType>
+    void CSmMALAProposal<ModelType, InternalMatrixType>::copyStateTo(Eigen::Ref<VectorType> destination) const {
+        destination = state;
+    }
+
     template<typename ModelType, typename InternalMatrixType>
     VectorType CSmMALAProposal<ModelType, InternalMatrixType>::getProposal() const {
         return proposal;
     }
 
+    template<typename ModelType, typename InternalMatrixType>
+    void CSmMALAProposal<ModelType, InternalMatrixType>::copyProposalTo(Eigen::Ref<VectorType> destination) const {
+        destination = proposal;
+    }
+
     template<typename ModelType, typename InternalMatrixType>
     std::vector<std::string> CSmMALAProposal<ModelType, InternalMatrixType>::getParameterNames() const {
         return {"step_size", "fisher_weight", "coldness"};
@@ -420,6 +471,27 @@ namespace hops {
         normalDistribution.reset();
     }
 
+
+    template<typename ModelType, typename InternalMatrixType>
+    void CSmMALAProposal<ModelType, InternalMatrixType>::serialize(std::ostream &out) const {
+        BinarySerialization::writeAll(out, state, driftedState, proposal, driftedProposal, stateLogSqrtDeterminant,
+                                      proposalLogSqrtDeterminant, stateNegativeLogLikelihood,
+                                      proposalNegativeLogLikelihood, stateMetric, proposalMetric, stepSize, coldness,
+                                      fisherWeight, fisherScale, geometricFactor, covarianceFactor, normalDistribution,
+                                      dimensionNames, constantFisherInformation);
+    }
+
+    template<typename ModelType, typename InternalMatrixType>
+    void CSmMALAProposal<ModelType, InternalMatrixType>::deserialize(std::istream &in) {
+        BinarySerialization::readAll(in, state, driftedState, proposal, driftedProposal, stateLogSqrtDeterminant,
+                                     proposalLogSqrtDeterminant, stateNegativeLogLikelihood,
+                                     proposalNegativeLogLikelihood, stateMetric, proposalMetric, stepSize, coldness,
+                                     fisherWeight, fisherScale, geometricFactor, covarianceFactor, normalDistribution,
+                                     dimensionNames, constantFisherInformation);
+        // The decompositions are deterministic, so recomputing them reproduces the stored ones bitwise.
+        stateSolver.compute(stateMetric);
+        proposalSolver.compute(proposalMetric);
+    }
 }
 
 #endif //HOPS_CSMMALA_HPP
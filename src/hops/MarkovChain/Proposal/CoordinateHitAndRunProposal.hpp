@@ -6,6 +6,7 @@
 #include <random>
 
 #include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
+#include "hops/Utility/BinarySerialization.hpp"
 #include "hops/Utility/DefaultDimensionNames.hpp"
 #include "hops/Utility/MatrixType.hpp"
 #include "hops/Utility/StringUtility.hpp"
@@ -42,8 +43,12 @@ namespace hops {
 
         [[nodiscard]] VectorType getState() const override;
 
+        void copyStateTo(Eigen::Ref<VectorType> destination) const override;
+
         [[nodiscard]] VectorType getProposal() const override;
 
+        void copyProposalTo(Eigen::Ref<VectorType> destination) const override;
+
         void setDimensionNames(const std::vector<std::string> &names) override;
 
         [[nodiscard]] std::vector<std::string> getDimensionNames() const override;
@@ -76,6 +81,10 @@ namespace hops {
 
         void resetDistributions() override;
 
+        void serialize(std::ostream &out) const override;
+
+        void deserialize(std::istream &in) override;
+
     private:
         InternalMatrixType A;
         InternalVectorType b;
@@ -317,12 +326,22 @@ namespace hops {
         return state;
     }
 
+    template<typename InternalMatrixType, typename InternalVectorType, typename ChordStepDistribution>
+    void CoordinateHitAndRunProposal<InternalMatrixType, InternalVectorType, ChordStepDistribution>::copyStateTo(Eigen::Ref<VectorType> destination) const {
+        destination = state;
+    }
+
     template<typename InternalMatrixType, typename InternalVectorType, typename ChordStepDistribution>
     VectorType
     CoordinateHitAndRunProposal<InternalMatrixType, InternalVectorType, ChordStepDistribution>::getProposal() const {
         return proposal;
     }
 
+    template<typename InternalMatrixType, typename InternalVectorType, typename ChordStepDistribution>
+    void CoordinateHitAndRunProposal<InternalMatrixType, InternalVectorType, ChordStepDistribution>::copyProposalTo(Eigen::Ref<VectorType> destination) const {
+        destination = proposal;
+    }
+
     template<typename InternalMatrixType, typename InternalVectorType, typename ChordStepDistribution>
     std::vector<std::string>
     CoordinateHitAndRunProposal<InternalMatrixType, InternalVectorType, ChordStepDistribution>::getParameterNames() const {
@@ -399,6 +418,26 @@ namespace hops {
     CoordinateHitAndRunProposal<InternalMatrixType, InternalVectorType, ChordStepDistribution>::getDimensionNames() const {
         return dimensionNames;
     }
+
+    template<typename InternalMatrixType, typename InternalVectorType, typename ChordStepDistribution>
+    void CoordinateHitAndRunProposal<InternalMatrixType, InternalVectorType, ChordStepDistribution>::serialize(
+            std::ostream &out) const {
+        BinarySerialization::writeAll(out, state, proposal, slacks, proposalSlacks, shouldRecomputeSlacks,
+                                      detailedBalance, coordinateToUpdate, step, forwardDistance, backwardDistance,
+                                      getStepSize(), dimensionNames);
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType, typename ChordStepDistribution>
+    void CoordinateHitAndRunProposal<InternalMatrixType, InternalVectorType, ChordStepDistribution>::deserialize(
+            std::istream &in) {
+        std::optional<double> stepSize;
+        BinarySerialization::readAll(in, state, proposal, slacks, proposalSlacks, shouldRecomputeSlacks,
+                                     detailedBalance, coordinateToUpdate, step, forwardDistance, backwardDistance,
+                                     stepSize, dimensionNames);
+        if (stepSize) {
+            setStepSize(stepSize.value());
+        }
+    }
 }
 
 #endif //HOPS_COORDINATEHITANDRUNPROPOSAL_HPP
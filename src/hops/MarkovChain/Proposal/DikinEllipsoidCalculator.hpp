@@ -9,17 +9,75 @@ namespace hops {
     template<typename MatrixType, typename VectorType>
     class DikinEllipsoidCalculator {
     public:
+        using DenseMatrixType = Eigen::Matrix<typename MatrixType::Scalar, Eigen::Dynamic, Eigen::Dynamic>;
+        using DenseVectorType = Eigen::Matrix<typename MatrixType::Scalar, Eigen::Dynamic, 1>;
+
         DikinEllipsoidCalculator(MatrixType A, VectorType b);
 
-        std::pair<bool, Eigen::Matrix<typename MatrixType::Scalar, Eigen::Dynamic, Eigen::Dynamic>>
-        computeCholeskyFactorOfDikinEllipsoid(const VectorType &x);
+        std::pair<bool, DenseMatrixType> computeCholeskyFactorOfDikinEllipsoid(const VectorType &x);
+
+        /**
+         * @brief Writes the lower cholesky factor of the Dikin ellipsoid at x into choleskyFactor.
+         * @details Intermediate results are kept in the calculator, such that repeated calls do not allocate.
+         * @return whether the cholesky decomposition was successful
+         */
+        bool computeCholeskyFactorOfDikinEllipsoid(const VectorType &x, DenseMatrixType &choleskyFactor);
+
+        DenseMatrixType computeDikinEllipsoid(const VectorType &x);
+
+        void computeDikinEllipsoid(const VectorType &x, DenseMatrixType &dikinEllipsoid);
+
+        /**
+         * @brief Computes A^T S^-1 W S^-1 A, where S are the slacks at x and W are the constraint weights.
+         * @details With all weights equal to one this is the Dikin ellipsoid.
+         */
+        DenseMatrixType computeWeightedDikinEllipsoid(const VectorType &x, const VectorType &weights);
+
+        void computeWeightedDikinEllipsoid(const VectorType &x, const VectorType &weights, DenseMatrixType &dikinEllipsoid);
 
-        Eigen::Matrix<typename MatrixType::Scalar, Eigen::Dynamic, Eigen::Dynamic>
-        computeDikinEllipsoid(const VectorType &x);
+        std::pair<bool, DenseMatrixType>
+        computeCholeskyFactorOfWeightedDikinEllipsoid(const VectorType &x, const VectorType &weights);
+
+        bool computeCholeskyFactorOfWeightedDikinEllipsoid(const VectorType &x,
+                                                           const VectorType &weights,
+                                                           DenseMatrixType &choleskyFactor);
+
+        /**
+         * @brief Computes the leverage scores of W^1/2 S^-1 A at x.
+         * @param x
+         * @param weights
+         * @param choleskyFactor lower cholesky factor of the weighted Dikin ellipsoid at x with the same weights.
+         * @param sketch k x n matrix with i.i.d. standard normal entries. If empty, the leverage scores are computed
+         * exactly in O(m n^2), otherwise they are approximated in O(m n k) using the Johnson-Lindenstrauss sketch
+         * ||sketch L^-1 a_i||^2 / k. Keeping the sketch fixed keeps the scores a deterministic function of x.
+         * @return
+         */
+        DenseVectorType computeLeverageScores(const VectorType &x,
+                                              const VectorType &weights,
+                                              const DenseMatrixType &choleskyFactor,
+                                              const DenseMatrixType &sketch);
+
+        void computeLeverageScores(const VectorType &x,
+                                   const VectorType &weights,
+                                   const DenseMatrixType &choleskyFactor,
+                                   const DenseMatrixType &sketch,
+                                   DenseVectorType &leverageScores);
 
     private:
+        void computeScaledInverseSlacks(const VectorType &x, const VectorType &weights);
+
+        void computeCholeskyFactor(const DenseMatrixType &ellipsoid, DenseMatrixType &choleskyFactor);
+
         MatrixType A;
         VectorType b;
+
+        // Workspaces, which keep their sizes between calls.
+        DenseVectorType scaledInverseSlacks;
+        DenseMatrixType halfDikin;
+        DenseMatrixType ellipsoid;
+        DenseMatrixType projection;
+        DenseMatrixType sketchedRows;
+        Eigen::LLT<DenseMatrixType> solver;
     };
 
     template<typename MatrixType, typename VectorType>
@@ -27,27 +85,124 @@ namespace hops {
             A(std::move(A)), b(std::move(b)) {}
 
     template<typename MatrixType, typename VectorType>
-    std::pair<bool, Eigen::Matrix<typename MatrixType::Scalar, Eigen::Dynamic, Eigen::Dynamic>>
+    std::pair<bool, typename DikinEllipsoidCalculator<MatrixType, VectorType>::DenseMatrixType>
     DikinEllipsoidCalculator<MatrixType, VectorType>::computeCholeskyFactorOfDikinEllipsoid(const VectorType &x) {
-        Eigen::Matrix<typename MatrixType::Scalar, Eigen::Dynamic, Eigen::Dynamic> dikinEllipsoid =
-                computeDikinEllipsoid(x);
+        DenseMatrixType choleskyFactor;
+        bool successful = computeCholeskyFactorOfDikinEllipsoid(x, choleskyFactor);
+        return std::make_pair(successful, choleskyFactor);
+    }
 
-        Eigen::LLT<Eigen::Matrix<typename MatrixType::Scalar, Eigen::Dynamic, Eigen::Dynamic>> solver(dikinEllipsoid);
-        bool successful = solver.info() == Eigen::Success;
-        return std::make_pair(successful, solver.matrixL());
+    template<typename MatrixType, typename VectorType>
+    bool DikinEllipsoidCalculator<MatrixType, VectorType>::computeCholeskyFactorOfDikinEllipsoid(
+            const VectorType &x, DenseMatrixType &choleskyFactor) {
+        computeDikinEllipsoid(x, ellipsoid);
+        computeCholeskyFactor(ellipsoid, choleskyFactor);
+        return solver.info() == Eigen::Success;
     }
 
     template<typename MatrixType, typename VectorType>
-    Eigen::Matrix<typename MatrixType::Scalar, Eigen::Dynamic, Eigen::Dynamic>
+    typename DikinEllipsoidCalculator<MatrixType, VectorType>::DenseMatrixType
     DikinEllipsoidCalculator<MatrixType, VectorType>::computeDikinEllipsoid(const VectorType &x) {
-        Eigen::Matrix<typename MatrixType::Scalar, Eigen::Dynamic, 1> inv_slack = (this->b -
-                                                                                   this->A * x).cwiseInverse();
-
-        Eigen::Matrix<typename MatrixType::Scalar, Eigen::Dynamic, Eigen::Dynamic> halfDikin =
-                inv_slack.asDiagonal() * this->A;
-        Eigen::Matrix<typename MatrixType::Scalar, Eigen::Dynamic, Eigen::Dynamic> dikin =
-                halfDikin.transpose() * halfDikin;
-        return dikin;
+        DenseMatrixType dikinEllipsoid;
+        computeDikinEllipsoid(x, dikinEllipsoid);
+        return dikinEllipsoid;
+    }
+
+    template<typename MatrixType, typename VectorType>
+    void DikinEllipsoidCalculator<MatrixType, VectorType>::computeDikinEllipsoid(const VectorType &x,
+                                                                               DenseMatrixType &dikinEllipsoid) {
+        scaledInverseSlacks.noalias() = this->A * x;
+        scaledInverseSlacks = (this->b - scaledInverseSlacks).cwiseInverse();
+
+        halfDikin.noalias() = scaledInverseSlacks.asDiagonal() * this->A;
+        dikinEllipsoid.noalias() = halfDikin.transpose() * halfDikin;
+    }
+
+    template<typename MatrixType, typename VectorType>
+    typename DikinEllipsoidCalculator<MatrixType, VectorType>::DenseMatrixType
+    DikinEllipsoidCalculator<MatrixType, VectorType>::computeWeightedDikinEllipsoid(const VectorType &x,
+                                                                                  const VectorType &weights) {
+        DenseMatrixType dikinEllipsoid;
+        computeWeightedDikinEllipsoid(x, weights, dikinEllipsoid);
+        return dikinEllipsoid;
+    }
+
+    template<typename MatrixType, typename VectorType>
+    void DikinEllipsoidCalculator<MatrixType, VectorType>::computeWeightedDikinEllipsoid(
+            const VectorType &x, const VectorType &weights, DenseMatrixType &dikinEllipsoid) {
+        computeScaledInverseSlacks(x, weights);
+
+        halfDikin.noalias() = scaledInverseSlacks.asDiagonal() * this->A;
+        dikinEllipsoid.noalias() = halfDikin.transpose() * halfDikin;
+    }
+
+    template<typename MatrixType, typename VectorType>
+    std::pair<bool, typename DikinEllipsoidCalculator<MatrixType, VectorType>::DenseMatrixType>
+    DikinEllipsoidCalculator<MatrixType, VectorType>::computeCholeskyFactorOfWeightedDikinEllipsoid(
+            const VectorType &x, const VectorType &weights) {
+        DenseMatrixType choleskyFactor;
+        bool successful = computeCholeskyFactorOfWeightedDikinEllipsoid(x, weights, choleskyFactor);
+        return std::make_pair(successful, choleskyFactor);
+    }
+
+    template<typename MatrixType, typename VectorType>
+    bool DikinEllipsoidCalculator<MatrixType, VectorType>::computeCholeskyFactorOfWeightedDikinEllipsoid(
+            const VectorType &x, const VectorType &weights, DenseMatrixType &choleskyFactor) {
+        computeWeightedDikinEllipsoid(x, weights, ellipsoid);
+        computeCholeskyFactor(ellipsoid, choleskyFactor);
+        return solver.info() == Eigen::Success;
+    }
+
+    template<typename MatrixType, typename VectorType>
+    typename DikinEllipsoidCalculator<MatrixType, VectorType>::DenseVectorType
+    DikinEllipsoidCalculator<MatrixType, VectorType>::computeLeverageScores(
+            const VectorType &x,
+            const VectorType &weights,
+            const DenseMatrixType &choleskyFactor,
+            const DenseMatrixType &sketch) {
+        DenseVectorType leverageScores;
+        computeLeverageScores(x, weights, choleskyFactor, sketch, leverageScores);
+        return leverageScores;
+    }
+
+    template<typename MatrixType, typename VectorType>
+    void DikinEllipsoidCalculator<MatrixType, VectorType>::computeLeverageScores(
+            const VectorType &x,
+            const VectorType &weights,
+            const DenseMatrixType &choleskyFactor,
+            const DenseMatrixType &sketch,
+            DenseVectorType &leverageScores) {
+        computeScaledInverseSlacks(x, weights);
+
+        if (sketch.size() == 0) {
+            // Column i of L^-1 A^T S^-1 W^1/2 has the squared norm a_i^T (A^T S^-1 W S^-1 A)^-1 a_i w_i / s_i^2.
+            projection = this->A.transpose();
+            choleskyFactor.template triangularView<Eigen::Lower>().solveInPlace(projection);
+            leverageScores = projection.colwise().squaredNorm().transpose().cwiseProduct(
+                    scaledInverseSlacks.cwiseAbs2());
+            return;
+        }
+
+        // sketch L^-1 is computed as (L^-T sketch^T)^T, which costs O(n^2 k) instead of O(n^2 m).
+        projection = sketch.transpose();
+        choleskyFactor.template triangularView<Eigen::Lower>().transpose().solveInPlace(projection);
+        sketchedRows.noalias() = this->A * projection;
+        leverageScores = sketchedRows.rowwise().squaredNorm().cwiseProduct(scaledInverseSlacks.cwiseAbs2()) /
+                         static_cast<typename MatrixType::Scalar>(sketch.rows());
+    }
+
+    template<typename MatrixType, typename VectorType>
+    void DikinEllipsoidCalculator<MatrixType, VectorType>::computeScaledInverseSlacks(const VectorType &x,
+                                                                                    const VectorType &weights) {
+        scaledInverseSlacks.noalias() = this->A * x;
+        scaledInverseSlacks = weights.cwiseSqrt().cwiseQuotient(this->b - scaledInverseSlacks);
+    }
+
+    template<typename MatrixType, typename VectorType>
+    void DikinEllipsoidCalculator<MatrixType, VectorType>::computeCholeskyFactor(const DenseMatrixType &ellipsoidMatrix,
+                                                                               DenseMatrixType &choleskyFactor) {
+        solver.compute(ellipsoidMatrix);
+        choleskyFactor = solver.matrixL();
     }
 }
 
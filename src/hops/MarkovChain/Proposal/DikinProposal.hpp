@@ -6,6 +6,7 @@
 #include <random>
 
 #include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
+#include "hops/Utility/BinarySerialization.hpp"
 #include "hops/Utility/DefaultDimensionNames.hpp"
 #include "hops/Utility/MatrixType.hpp"
 #include "hops/Utility/StringUtility.hpp"
@@ -43,8 +44,12 @@ namespace hops {
 
         [[nodiscard]] VectorType getState() const override;
 
+        void copyStateTo(Eigen::Ref<VectorType> destination) const override;
+
         [[nodiscard]] VectorType getProposal() const override;
 
+        void copyProposalTo(Eigen::Ref<VectorType> destination) const override;
+
         void setDimensionNames(const std::vector<std::string> &names) override;
 
         std::vector<std::string> getDimensionNames() const override;
@@ -75,6 +80,10 @@ namespace hops {
 
         void resetDistributions() override;
 
+        void serialize(std::ostream &out) const override;
+
+        void deserialize(std::istream &in) override;
+
     private:
         MatrixType A;
         VectorType b;
@@ -87,6 +96,11 @@ namespace hops {
         MatrixType stateCholeskyOfDikinEllipsoid;
         MatrixType proposalCholeskyOfDikinEllipsoid;
 
+        // Workspaces, which keep their sizes between steps.
+        VectorType constraintValues;
+        VectorType stateDifference;
+        VectorType transformedStateDifference;
+
         double stepSize;
         double geometricFactor = 0;
         double covarianceFactor = 0;
@@ -124,9 +138,8 @@ namespace hops {
         for (long i = 0; i < proposal.rows(); ++i) {
             proposal(i) = normalDistribution(randomNumberGenerator);
         }
-        proposal = state + covarianceFactor *
-                           stateCholeskyOfDikinEllipsoid.template triangularView<Eigen::Lower>().solve(proposal);
-
+        stateCholeskyOfDikinEllipsoid.template triangularView<Eigen::Lower>().solveInPlace(proposal);
+        proposal = state + covarianceFactor * proposal;
 
         return proposal;
     }
@@ -134,7 +147,7 @@ namespace hops {
     template<typename InternalMatrixType, typename InternalVectorType>
     VectorType &DikinProposal<InternalMatrixType, InternalVectorType>::acceptProposal() {
         state.swap(proposal);
-        stateCholeskyOfDikinEllipsoid = std::move(proposalCholeskyOfDikinEllipsoid);
+        stateCholeskyOfDikinEllipsoid.swap(proposalCholeskyOfDikinEllipsoid);
         stateLogSqrtDeterminant = proposalLogSqrtDeterminant;
         return state;
     }
@@ -145,11 +158,9 @@ namespace hops {
             throw std::invalid_argument("Starting point outside polytope always gives constant Markov chain.");
         }
         state = newState;
-        auto choleskyResult = dikinEllipsoidCalculator.computeCholeskyFactorOfDikinEllipsoid(state);
-        if (!choleskyResult.first) {
+        if (!dikinEllipsoidCalculator.computeCholeskyFactorOfDikinEllipsoid(state, stateCholeskyOfDikinEllipsoid)) {
             throw std::runtime_error("Could not compute cholesky factorization for newState.");
         }
-        stateCholeskyOfDikinEllipsoid = std::move(choleskyResult.second);
         stateLogSqrtDeterminant = stateCholeskyOfDikinEllipsoid.diagonal().array().log().sum();
     }
 
@@ -160,25 +171,28 @@ namespace hops {
 
     template<typename InternalMatrixType, typename InternalVectorType>
     double DikinProposal<InternalMatrixType, InternalVectorType>::computeLogAcceptanceProbability() {
-        bool isProposalInteriorPoint = ((A * proposal - b).array() < -boundaryCushion).all();
+        constraintValues.noalias() = A * proposal;
+        bool isProposalInteriorPoint = ((constraintValues - b).array() < -boundaryCushion).all();
         if (!isProposalInteriorPoint) {
             return -std::numeric_limits<double>::infinity();
         }
 
-        auto choleskyResult = dikinEllipsoidCalculator.computeCholeskyFactorOfDikinEllipsoid(proposal);
-        if (!choleskyResult.first) {
+        if (!dikinEllipsoidCalculator.computeCholeskyFactorOfDikinEllipsoid(proposal,
+                                                                            proposalCholeskyOfDikinEllipsoid)) {
             return -std::numeric_limits<double>::infinity();
         }
-        proposalCholeskyOfDikinEllipsoid = std::move(choleskyResult.second);
 
         proposalLogSqrtDeterminant = proposalCholeskyOfDikinEllipsoid.diagonal().array().log().sum();
-        InternalVectorType stateDifference = state - proposal;
+        stateDifference = state - proposal;
+
+        transformedStateDifference.noalias() = stateCholeskyOfDikinEllipsoid * stateDifference;
+        double stateNorm = transformedStateDifference.squaredNorm();
+        transformedStateDifference.noalias() = proposalCholeskyOfDikinEllipsoid * stateDifference;
+        double proposalNorm = transformedStateDifference.squaredNorm();
 
         return proposalLogSqrtDeterminant
                - stateLogSqrtDeterminant
-               + geometricFactor * ((stateCholeskyOfDikinEllipsoid * stateDifference).squaredNorm()
-                                    - (proposalCholeskyOfDikinEllipsoid * stateDifference).squaredNorm()
-        );
+               + geometricFactor * (stateNorm - proposalNorm);
     }
 
     template<typename InternalMatrixType, typename InternalVectorType>
@@ -213,11 +227,21 @@ namespace hops {
         return state;
     }
 
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void DikinProposal<InternalMatrixType, InternalVectorType>::copyStateTo(Eigen::Ref<VectorType> destination) const {
+        destination = state;
+    }
+
     template<typename InternalMatrixType, typename InternalVectorType>
     VectorType DikinProposal<InternalMatrixType, InternalVectorType>::getProposal() const {
         return proposal;
     }
 
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void DikinProposal<InternalMatrixType, InternalVectorType>::copyProposalTo(Eigen::Ref<VectorType> destination) const {
+        destination = proposal;
+    }
+
     template<typename InternalMatrixType, typename InternalVectorType>
     std::vector<std::string> DikinProposal<InternalMatrixType, InternalVectorType>::getParameterNames() const {
         return {
@@ -286,6 +310,22 @@ namespace hops {
     std::vector<std::string> DikinProposal<InternalMatrixType, InternalVectorType>::getDimensionNames() const {
         return dimensionNames;
     }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void DikinProposal<InternalMatrixType, InternalVectorType>::serialize(std::ostream &out) const {
+        BinarySerialization::writeAll(out, state, proposal, stateLogSqrtDeterminant, proposalLogSqrtDeterminant,
+                                      stateCholeskyOfDikinEllipsoid, proposalCholeskyOfDikinEllipsoid, stepSize,
+                                      geometricFactor, covarianceFactor, boundaryCushion, normalDistribution,
+                                      dimensionNames);
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void DikinProposal<InternalMatrixType, InternalVectorType>::deserialize(std::istream &in) {
+        BinarySerialization::readAll(in, state, proposal, stateLogSqrtDeterminant, proposalLogSqrtDeterminant,
+                                     stateCholeskyOfDikinEllipsoid, proposalCholeskyOfDikinEllipsoid, stepSize,
+                                     geometricFactor, covarianceFactor, boundaryCushion, normalDistribution,
+                                     dimensionNames);
+    }
 }
 
 #endif //HOPS_DIKINPROPOSAL_HPP
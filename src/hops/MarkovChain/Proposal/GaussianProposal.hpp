@@ -5,6 +5,7 @@
 #include <random>
 
 #include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
+#include "hops/Utility/BinarySerialization.hpp"
 #include "hops/Utility/DefaultDimensionNames.hpp"
 #include "hops/Utility/MatrixType.hpp"
 #include "hops/Utility/StringUtility.hpp"
@@ -38,8 +39,12 @@ namespace hops {
 
         [[nodiscard]] VectorType getState() const override;
 
+        void copyStateTo(Eigen::Ref<VectorType> destination) const override;
+
         [[nodiscard]] VectorType getProposal() const override;
 
+        void copyProposalTo(Eigen::Ref<VectorType> destination) const override;
+
         void setDimensionNames(const std::vector<std::string> &names) override;
 
         [[nodiscard]] std::vector<std::string> getDimensionNames() const override;
@@ -70,6 +75,10 @@ namespace hops {
 
         void resetDistributions() override;
 
+        void serialize(std::ostream &out) const override;
+
+        void deserialize(std::istream &in) override;
+
     private:
         InternalMatrixType A;
         InternalVectorType b;
@@ -80,6 +89,8 @@ namespace hops {
 
         std::vector<std::string> dimensionNames;
 
+        VectorType constraintValues; // workspace for the interior point check
+
         std::normal_distribution<typename InternalMatrixType::Scalar> normal;
     };
 
@@ -148,7 +159,8 @@ namespace hops {
 
     template<typename InternalMatrixType, typename InternalVectorType>
     double GaussianProposal<InternalMatrixType, InternalVectorType>::computeLogAcceptanceProbability() {
-        bool isProposalInteriorPoint = ((b - A * proposal).array() >= 0).all();
+        constraintValues.noalias() = A * proposal;
+        bool isProposalInteriorPoint = ((b - constraintValues).array() >= 0).all();
         if (!isProposalInteriorPoint) {
             return -std::numeric_limits<double>::infinity();
         }
@@ -170,11 +182,21 @@ namespace hops {
         return state;
     }
 
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void GaussianProposal<InternalMatrixType, InternalVectorType>::copyStateTo(Eigen::Ref<VectorType> destination) const {
+        destination = state;
+    }
+
     template<typename InternalMatrixType, typename InternalVectorType>
     VectorType GaussianProposal<InternalMatrixType, InternalVectorType>::getProposal() const {
         return proposal;
     }
 
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void GaussianProposal<InternalMatrixType, InternalVectorType>::copyProposalTo(Eigen::Ref<VectorType> destination) const {
+        destination = proposal;
+    }
+
     template<typename InternalMatrixType, typename InternalVectorType>
     std::vector<std::string> GaussianProposal<InternalMatrixType, InternalVectorType>::getParameterNames() const {
         return {"step_size"};
@@ -240,6 +262,16 @@ namespace hops {
     void GaussianProposal<InternalMatrixType, InternalVectorType>::resetDistributions() {
         normal.reset();
     }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void GaussianProposal<InternalMatrixType, InternalVectorType>::serialize(std::ostream &out) const {
+        BinarySerialization::writeAll(out, state, proposal, stepSize, dimensionNames, normal);
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void GaussianProposal<InternalMatrixType, InternalVectorType>::deserialize(std::istream &in) {
+        BinarySerialization::readAll(in, state, proposal, stepSize, dimensionNames, normal);
+    }
 }
 
 #endif //HOPS_GAUSSIANPROPOSAL_HPP
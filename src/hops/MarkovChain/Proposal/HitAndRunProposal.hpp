@@ -6,6 +6,7 @@
 #include <random>
 
 #include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
+#include "hops/Utility/BinarySerialization.hpp"
 #include "hops/Utility/DefaultDimensionNames.hpp"
 #include "hops/Utility/MatrixType.hpp"
 #include "hops/Utility/StringUtility.hpp"
@@ -35,8 +36,12 @@ namespace hops {
 
         [[nodiscard]] VectorType getState() const override;
 
+        void copyStateTo(Eigen::Ref<VectorType> destination) const override;
+
         [[nodiscard]] VectorType getProposal() const override;
 
+        void copyProposalTo(Eigen::Ref<VectorType> destination) const override;
+
         void setDimensionNames(const std::vector<std::string> &names) override;
 
         [[nodiscard]] std::vector<std::string> getDimensionNames() const override;
@@ -69,6 +74,10 @@ namespace hops {
 
         void resetDistributions() override;
 
+        void serialize(std::ostream &out) const override;
+
+        void deserialize(std::istream &in) override;
+
     private:
         InternalMatrixType A;
         InternalVectorType b;
@@ -76,6 +85,7 @@ namespace hops {
         VectorType proposal;
         InternalVectorType slacks;
         InternalVectorType inverseDistances;
+        InternalVectorType slackChange; // workspace for updating the slacks of accepted proposals
 
         InternalVectorType updateDirection;
         double step = 0;
@@ -142,7 +152,8 @@ namespace hops {
         }
         this->updateDirection.normalize();
 
-        this->inverseDistances = (this->A * this->updateDirection).cwiseQuotient(this->slacks);
+        this->inverseDistances.noalias() = this->A * this->updateDirection;
+        this->inverseDistances = this->inverseDistances.cwiseQuotient(this->slacks);
         this->inverseDistances = this->inverseDistances
                 .array()
                 .unaryExpr([](double value) { return std::isnan(value) ? 0. : value; })
@@ -169,7 +180,8 @@ namespace hops {
     VectorType &
     HitAndRunProposal<InternalMatrixType, InternalVectorType, ChordStepDistribution, Precise>::propose(
             RandomNumberGenerator &rng, const Eigen::VectorXd &activeIndices) {
-        slacks = this->b - this->A * this->state;
+        slacks.noalias() = this->A * this->state;
+        slacks = this->b - slacks;
         updateDirection.setZero();
         assert(activeIndices.sum() > 0);
         for (long i = 0; i < activeIndices.rows(); ++i) {
@@ -177,7 +189,8 @@ namespace hops {
         }
         updateDirection.normalize();
 
-        inverseDistances = (A * updateDirection).cwiseQuotient(slacks);
+        inverseDistances.noalias() = A * updateDirection;
+        inverseDistances = inverseDistances.cwiseQuotient(slacks);
         // Inverse distance are potentially nan due to default values on the boundary of the polytope.
         // Replaces nan because nan should not influence the distances.
         this->inverseDistances = this->inverseDistances
@@ -203,12 +216,14 @@ namespace hops {
         state = proposal;
         proposal = state;
         if constexpr (Precise) {
-            slacks = b - A * state;
+            slacks.noalias() = A * state;
+            slacks = b - slacks;
             if ((slacks.array() < 0).any()) {
                 throw std::runtime_error("Hit-and-Run sampled point outside of polytope.");
             }
         } else {
-            slacks.noalias() -= A * updateDirection * step;
+            slackChange.noalias() = A * updateDirection;
+            slacks -= slackChange * step;
         }
         return state;
     }
@@ -293,12 +308,22 @@ namespace hops {
         return state;
     }
 
+    template<typename InternalMatrixType, typename InternalVectorType, typename ChordStepDistribution, bool Precise>
+    void HitAndRunProposal<InternalMatrixType, InternalVectorType, ChordStepDistribution, Precise>::copyStateTo(Eigen::Ref<VectorType> destination) const {
+        destination = state;
+    }
+
     template<typename InternalMatrixType, typename InternalVectorType, typename ChordStepDistribution, bool Precise>
     VectorType
     HitAndRunProposal<InternalMatrixType, InternalVectorType, ChordStepDistribution, Precise>::getProposal() const {
         return proposal;
     }
 
+    template<typename InternalMatrixType, typename InternalVectorType, typename ChordStepDistribution, bool Precise>
+    void HitAndRunProposal<InternalMatrixType, InternalVectorType, ChordStepDistribution, Precise>::copyProposalTo(Eigen::Ref<VectorType> destination) const {
+        destination = proposal;
+    }
+
     template<typename InternalMatrixType, typename InternalVectorType, typename ChordStepDistribution, bool Precise>
     std::vector<std::string>
     HitAndRunProposal<InternalMatrixType, InternalVectorType, ChordStepDistribution, Precise>::getParameterNames() const {
@@ -382,6 +407,24 @@ namespace hops {
         normalDistribution.reset();
         slacks = this->b - this->A * this->state;
     }
+
+    template<typename InternalMatrixType, typename InternalVectorType, typename ChordStepDistribution, bool Precise>
+    void HitAndRunProposal<InternalMatrixType, InternalVectorType, ChordStepDistribution, Precise>::serialize(
+            std::ostream &out) const {
+        BinarySerialization::writeAll(out, state, proposal, slacks, updateDirection, step, forwardDistance,
+                                      backwardDistance, getStepSize(), normalDistribution, dimensionNames);
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType, typename ChordStepDistribution, bool Precise>
+    void HitAndRunProposal<InternalMatrixType, InternalVectorType, ChordStepDistribution, Precise>::deserialize(
+            std::istream &in) {
+        std::optional<double> stepSize;
+        BinarySerialization::readAll(in, state, proposal, slacks, updateDirection, step, forwardDistance,
+                                     backwardDistance, stepSize, normalDistribution, dimensionNames);
+        if (stepSize) {
+            setStepSize(stepSize.value());
+        }
+    }
 }
 
 #endif //HOPS_HITANDRUNPROPOSAL_HPP
@@ -0,0 +1,20 @@
+#ifndef HOPS_ISCOMPUTELOGLIKELIHOODGRADIENTINTOAVAILABLE_HPP
+#define HOPS_ISCOMPUTELOGLIKELIHOODGRADIENTINTOAVAILABLE_HPP
+
+#include <type_traits>
+
+#include "hops/Utility/VectorType.hpp"
+
+namespace hops {
+    template<typename T, typename = void>
+    struct IsComputeLogLikelihoodGradientIntoAvailable : std::false_type {
+    };
+
+    template<typename T>
+    struct IsComputeLogLikelihoodGradientIntoAvailable<T, std::void_t<decltype(std::declval<T>().computeLogLikelihoodGradientInto(
+            std::declval<const VectorType &>(), std::declval<Eigen::Ref<VectorType>>()))> > :
+            std::true_type {
+    };
+}
+
+#endif //HOPS_ISCOMPUTELOGLIKELIHOODGRADIENTINTOAVAILABLE_HPP
@@ -0,0 +1,407 @@
+#ifndef HOPS_JOHNPROPOSAL_HPP
+#define HOPS_JOHNPROPOSAL_HPP
+
+#include <Eigen/LU>
+#include <cmath>
+#include <optional>
+#include <random>
+
+#include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
+#include "hops/Utility/BinarySerialization.hpp"
+#include "hops/Utility/DefaultDimensionNames.hpp"
+#include "hops/Utility/MatrixType.hpp"
+#include "hops/Utility/StringUtility.hpp"
+#include "hops/Utility/VectorType.hpp"
+
+#include "Proposal.hpp"
+#include "DikinEllipsoidCalculator.hpp"
+
+namespace hops {
+    /**
+     * @brief Gaussian John walk, see https://jmlr.org/papers/v19/18-158.html. The local metric A^T S^-1 W S^-1 A
+     * weights every constraint by its approximate John weight w, which is the fixed point of
+     * w = sigma(W^alpha S^-1 A) + n/2m with alpha = 1 - 1/log2(2m/n). This improves the mixing time from O(mn) for the
+     * Dikin walk to O(n^2.5) up to logarithmic factors, which is independent of the number of constraints.
+     * @details The fixed point iteration is warm-started from the weights of the current state, so that only a few
+     * iterations are required for small steps. The fixed point is solved up to the relative tolerance epsilon.
+     */
+    template<typename InternalMatrixType, typename InternalVectorType>
+    class JohnProposal : public Proposal {
+    public:
+        /**
+         * @brief Constructs Gaussian John proposal mechanism on polytope defined as Ax<b.
+         * @param A
+         * @param b
+         * @param currentState
+         * @param stepSize squared radius of the John ellipsoids, the proposal covariance is stepSize / n^1.5 J^-1.
+         * @param sketchDimension number of gaussian projections used to approximate the leverage scores.
+         * Negative values select O(log m) projections, 0 computes the leverage scores exactly.
+         * If the sketch is not smaller than the dimension of the polytope, the leverage scores are computed exactly.
+         * @param epsilon relative tolerance of the fixed point iteration for the John weights.
+         */
+        JohnProposal(InternalMatrixType A,
+                     InternalVectorType b,
+                     const VectorType &currentState,
+                     double stepSize = 0.1,
+                     long sketchDimension = -1,
+                     double epsilon = 1e-5);
+
+        VectorType &propose(RandomNumberGenerator &randomNumberGenerator) override;
+
+        VectorType &
+        propose(RandomNumberGenerator &randomNumberGenerator, const Eigen::VectorXd &activeIndices) override;
+
+        VectorType &acceptProposal() override;
+
+        void setState(const VectorType &newState) override;
+
+        void setProposal(const VectorType &newProposal) override;
+
+        [[nodiscard]] VectorType getState() const override;
+
+        void copyStateTo(Eigen::Ref<VectorType> destination) const override;
+
+        [[nodiscard]] VectorType getProposal() const override;
+
+        void copyProposalTo(Eigen::Ref<VectorType> destination) const override;
+
+        void setDimensionNames(const std::vector<std::string> &names) override;
+
+        std::vector<std::string> getDimensionNames() const override;
+
+        [[nodiscard]] std::vector<std::string> getParameterNames() const override;
+
+        [[nodiscard]] std::any getParameter(const ProposalParameter &parameter) const override;
+
+        [[nodiscard]] std::string getParameterType(const ProposalParameter &parameter) const override;
+
+        void setParameter(const ProposalParameter &parameter, const std::any &value) override;
+
+        void setStepSize(double stepSize);
+
+        [[nodiscard]] std::string getProposalName() const override;
+
+        [[nodiscard]] std::optional<double> getStepSize() const override;
+
+        [[nodiscard]] static bool hasStepSize();
+
+        [[nodiscard]] std::unique_ptr<Proposal> copyProposal() const override;
+
+        double computeLogAcceptanceProbability() override;
+
+        [[nodiscard]] const MatrixType &getA() const override;
+
+        [[nodiscard]] const VectorType &getB() const override;
+
+        void resetDistributions() override;
+
+        void serialize(std::ostream &out) const override;
+
+        void deserialize(std::istream &in) override;
+
+    private:
+        bool computeCholeskyFactorOfJohnEllipsoid(const VectorType &x, VectorType &weights, MatrixType &choleskyFactor);
+
+        MatrixType A;
+        VectorType b;
+
+        VectorType state;
+        VectorType proposal;
+
+        double stateLogSqrtDeterminant = 0;
+        double proposalLogSqrtDeterminant = 0;
+        MatrixType stateCholeskyOfJohnEllipsoid;
+        MatrixType proposalCholeskyOfJohnEllipsoid;
+        VectorType stateJohnWeights;
+        VectorType proposalJohnWeights;
+
+        double stepSize;
+        double geometricFactor = 0;
+        double covarianceFactor = 0;
+        double boundaryCushion = 0;
+        double epsilon;
+        long maximumNumberOfIterations = 100;
+
+        MatrixType sketch;
+
+        // Workspaces, which keep their sizes between steps.
+        VectorType scaledWeights;
+        VectorType nextWeights;
+        VectorType constraintValues;
+        VectorType stateDifference;
+        VectorType transformedStateDifference;
+
+        std::normal_distribution<double> normalDistribution{0., 1.};
+        DikinEllipsoidCalculator<MatrixType, VectorType> dikinEllipsoidCalculator;
+
+        std::vector<std::string> dimensionNames;
+    };
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void JohnProposal<InternalMatrixType, InternalVectorType>::resetDistributions() {
+        normalDistribution.reset();
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    JohnProposal<InternalMatrixType, InternalVectorType>::JohnProposal(InternalMatrixType A,
+                                                                       InternalVectorType b,
+                                                                       const VectorType &currentState,
+                                                                       double stepSize,
+                                                                       long sketchDimension,
+                                                                       double epsilon) :
+            A(std::move(A)),
+            b(std::move(b)),
+            epsilon(epsilon),
+            dikinEllipsoidCalculator(this->A, this->b) {
+        if (sketchDimension < 0) {
+            sketchDimension = static_cast<long>(std::ceil(8 * std::log(static_cast<double>(this->A.rows()))));
+        }
+        if (sketchDimension > 0 && sketchDimension < this->A.cols()) {
+            // The sketch is drawn once with a fixed seed, so that the metric stays a deterministic function of the
+            // state and the Metropolis-Hastings correction remains exact.
+            RandomNumberGenerator sketchRandomNumberGenerator(0);
+            std::normal_distribution<double> sketchDistribution(0., 1.);
+            sketch = MatrixType(sketchDimension, this->A.cols());
+            for (long i = 0; i < sketch.size(); ++i) {
+                sketch(i) = sketchDistribution(sketchRandomNumberGenerator);
+            }
+        }
+        stateJohnWeights = VectorType::Constant(this->A.rows(), 1.5 * this->A.cols() / this->A.rows());
+
+        JohnProposal::setStepSize(stepSize);
+        JohnProposal::setState(currentState);
+        proposal = state;
+
+        this->dimensionNames = createDefaultDimensionNames(this->state.rows());
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    bool JohnProposal<InternalMatrixType, InternalVectorType>::computeCholeskyFactorOfJohnEllipsoid(
+            const VectorType &x, VectorType &weights, MatrixType &choleskyFactor) {
+        double alpha = 1. - 1. / std::log2(2. * A.rows() / A.cols());
+        double beta = static_cast<double>(A.cols()) / (2. * A.rows());
+
+        for (long i = 0; i < maximumNumberOfIterations; ++i) {
+            scaledWeights = weights.array().pow(alpha);
+            if (!dikinEllipsoidCalculator.computeCholeskyFactorOfWeightedDikinEllipsoid(x,
+                                                                                       scaledWeights,
+                                                                                       choleskyFactor)) {
+                return false;
+            }
+            dikinEllipsoidCalculator.computeLeverageScores(x, scaledWeights, choleskyFactor, sketch, nextWeights);
+            nextWeights.array() += beta;
+            double relativeChange = (nextWeights - weights).cwiseQuotient(weights).cwiseAbs().maxCoeff();
+            weights.swap(nextWeights);
+            if (relativeChange < epsilon) {
+                break;
+            }
+        }
+        return dikinEllipsoidCalculator.computeCholeskyFactorOfWeightedDikinEllipsoid(x, weights, choleskyFactor);
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    VectorType &
+    JohnProposal<InternalMatrixType, InternalVectorType>::propose(RandomNumberGenerator &randomNumberGenerator) {
+        for (long i = 0; i < proposal.rows(); ++i) {
+            proposal(i) = normalDistribution(randomNumberGenerator);
+        }
+        stateCholeskyOfJohnEllipsoid.template triangularView<Eigen::Lower>().transpose().solveInPlace(proposal);
+        proposal = state + covarianceFactor * proposal;
+
+        return proposal;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    VectorType &JohnProposal<InternalMatrixType, InternalVectorType>::acceptProposal() {
+        state.swap(proposal);
+        stateCholeskyOfJohnEllipsoid.swap(proposalCholeskyOfJohnEllipsoid);
+        stateJohnWeights.swap(proposalJohnWeights);
+        stateLogSqrtDeterminant = proposalLogSqrtDeterminant;
+        return state;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void JohnProposal<InternalMatrixType, InternalVectorType>::setState(const VectorType &newState) {
+        if (((b - A * newState).array() < 0).any()) {
+            throw std::invalid_argument("Starting point outside polytope always gives constant Markov chain.");
+        }
+        state = newState;
+        if (!computeCholeskyFactorOfJohnEllipsoid(state, stateJohnWeights, stateCholeskyOfJohnEllipsoid)) {
+            throw std::runtime_error("Could not compute cholesky factorization for newState.");
+        }
+        stateLogSqrtDeterminant = stateCholeskyOfJohnEllipsoid.diagonal().array().log().sum();
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void JohnProposal<InternalMatrixType, InternalVectorType>::setProposal(const VectorType &newProposal) {
+        proposal = newProposal;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    double JohnProposal<InternalMatrixType, InternalVectorType>::computeLogAcceptanceProbability() {
+        constraintValues.noalias() = A * proposal;
+        bool isProposalInteriorPoint = ((constraintValues - b).array() < -boundaryCushion).all();
+        if (!isProposalInteriorPoint) {
+            return -std::numeric_limits<double>::infinity();
+        }
+
+        proposalJohnWeights = stateJohnWeights;
+        if (!computeCholeskyFactorOfJohnEllipsoid(proposal, proposalJohnWeights, proposalCholeskyOfJohnEllipsoid)) {
+            return -std::numeric_limits<double>::infinity();
+        }
+
+        proposalLogSqrtDeterminant = proposalCholeskyOfJohnEllipsoid.diagonal().array().log().sum();
+        stateDifference = state - proposal;
+
+        transformedStateDifference.noalias() = stateCholeskyOfJohnEllipsoid.transpose() * stateDifference;
+        double stateNorm = transformedStateDifference.squaredNorm();
+        transformedStateDifference.noalias() = proposalCholeskyOfJohnEllipsoid.transpose() * stateDifference;
+        double proposalNorm = transformedStateDifference.squaredNorm();
+
+        return proposalLogSqrtDeterminant
+               - stateLogSqrtDeterminant
+               + geometricFactor * (stateNorm - proposalNorm);
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void JohnProposal<InternalMatrixType, InternalVectorType>::setStepSize(double newStepSize) {
+        stepSize = newStepSize;
+        double scale = std::pow(static_cast<double>(A.cols()), 1.5);
+        geometricFactor = scale / (2 * stepSize);
+        covarianceFactor = std::sqrt(stepSize / scale);
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    std::string JohnProposal<InternalMatrixType, InternalVectorType>::getProposalName() const {
+        return "JohnWalk";
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    std::optional<double> JohnProposal<InternalMatrixType, InternalVectorType>::getStepSize() const {
+        return stepSize;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    bool JohnProposal<InternalMatrixType, InternalVectorType>::hasStepSize() {
+        return true;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    std::unique_ptr<Proposal> JohnProposal<InternalMatrixType, InternalVectorType>::copyProposal() const {
+        return std::make_unique<JohnProposal>(*this);
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    VectorType JohnProposal<InternalMatrixType, InternalVectorType>::getState() const {
+        return state;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void JohnProposal<InternalMatrixType, InternalVectorType>::copyStateTo(Eigen::Ref<VectorType> destination) const {
+        destination = state;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    VectorType JohnProposal<InternalMatrixType, InternalVectorType>::getProposal() const {
+        return proposal;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void JohnProposal<InternalMatrixType, InternalVectorType>::copyProposalTo(Eigen::Ref<VectorType> destination) const {
+        destination = proposal;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    std::vector<std::string> JohnProposal<InternalMatrixType, InternalVectorType>::getParameterNames() const {
+        return {
+                ProposalParameterName[static_cast<int>(ProposalParameter::BOUNDARY_CUSHION)],
+                ProposalParameterName[static_cast<int>(ProposalParameter::EPSILON)],
+                ProposalParameterName[static_cast<int>(ProposalParameter::STEP_SIZE)],
+        };
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    std::any
+    JohnProposal<InternalMatrixType, InternalVectorType>::getParameter(const ProposalParameter &parameter) const {
+        if (parameter == ProposalParameter::STEP_SIZE) {
+            return std::any(stepSize);
+        } else if (parameter == ProposalParameter::BOUNDARY_CUSHION) {
+            return std::any(boundaryCushion);
+        } else if (parameter == ProposalParameter::EPSILON) {
+            return std::any(epsilon);
+        }
+        throw std::invalid_argument("Can't get parameter which doesn't exist in " + this->getProposalName());
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    std::string
+    JohnProposal<InternalMatrixType, InternalVectorType>::getParameterType(const ProposalParameter &parameter) const {
+        if (parameter == ProposalParameter::STEP_SIZE || parameter == ProposalParameter::BOUNDARY_CUSHION ||
+            parameter == ProposalParameter::EPSILON) {
+            return "double";
+        } else {
+            throw std::invalid_argument("Can't get parameter which doesn't exist in " + this->getProposalName());
+        }
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void JohnProposal<InternalMatrixType, InternalVectorType>::setParameter(const ProposalParameter &parameter,
+                                                                            const std::any &value) {
+        if (parameter == ProposalParameter::STEP_SIZE) {
+            setStepSize(std::any_cast<double>(value));
+        } else if (parameter == ProposalParameter::BOUNDARY_CUSHION) {
+            boundaryCushion = std::any_cast<double>(value);
+        } else if (parameter == ProposalParameter::EPSILON) {
+            epsilon = std::any_cast<double>(value);
+        } else {
+            throw std::invalid_argument("Can't get parameter which doesn't exist in " + this->getProposalName());
+        }
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    const MatrixType &JohnProposal<InternalMatrixType, InternalVectorType>::getA() const {
+        return A;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    const VectorType &JohnProposal<InternalMatrixType, InternalVectorType>::getB() const {
+        return b;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    VectorType &JohnProposal<InternalMatrixType, InternalVectorType>::propose(RandomNumberGenerator &,
+                                                                              const Eigen::VectorXd &) {
+        throw std::runtime_error("Propose with rng and activeIndices not implemented");
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void
+    JohnProposal<InternalMatrixType, InternalVectorType>::setDimensionNames(const std::vector<std::string> &names) {
+        dimensionNames = names;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    std::vector<std::string> JohnProposal<InternalMatrixType, InternalVectorType>::getDimensionNames() const {
+        return dimensionNames;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void JohnProposal<InternalMatrixType, InternalVectorType>::serialize(std::ostream &out) const {
+        BinarySerialization::writeAll(out, state, proposal, stateLogSqrtDeterminant, proposalLogSqrtDeterminant,
+                                      stateCholeskyOfJohnEllipsoid, proposalCholeskyOfJohnEllipsoid, stateJohnWeights,
+                                      proposalJohnWeights, stepSize, geometricFactor, covarianceFactor,
+                                      boundaryCushion, epsilon, maximumNumberOfIterations, normalDistribution,
+                                      dimensionNames);
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void JohnProposal<InternalMatrixType, InternalVectorType>::deserialize(std::istream &in) {
+        BinarySerialization::readAll(in, state, proposal, stateLogSqrtDeterminant, proposalLogSqrtDeterminant,
+                                     stateCholeskyOfJohnEllipsoid, proposalCholeskyOfJohnEllipsoid, stateJohnWeights,
+                                     proposalJohnWeights, stepSize, geometricFactor, covarianceFactor,
+                                     boundaryCushion, epsilon, maximumNumberOfIterations, normalDistribution,
+                                     dimensionNames);
+    }
+}
+
+#endif //HOPS_JOHNPROPOSAL_HPP
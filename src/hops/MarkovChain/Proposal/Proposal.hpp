@@ -3,8 +3,10 @@
 
 #include <algorithm>
 #include <any>
+#include <istream>
 #include <memory>
 #include <optional>
+#include <ostream>
 #include <stdexcept>
 
 #include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
@@ -70,6 +72,23 @@ namespace hops {
 
         [[nodiscard]] virtual VectorType getProposal() const = 0;
 
+        /**
+         * @Brief Copies the current state into destination without allocating temporary storage.
+         * @Detailed The default implementation copies getState(). Proposals that store their state override it, such
+         * that Markov chains can write states directly into preallocated memory.
+         */
+        virtual void copyStateTo(Eigen::Ref<VectorType> destination) const {
+            destination = getState();
+        }
+
+        /**
+         * @Brief Copies the current proposal into destination without allocating temporary storage.
+         * @Detailed The default implementation copies getProposal().
+         */
+        virtual void copyProposalTo(Eigen::Ref<VectorType> destination) const {
+            destination = getProposal();
+        }
+
         /**
          * @brief set names for each dimension of the state space. Should typically be set from the Model to be sampled.
          */
@@ -157,6 +176,18 @@ namespace hops {
          */
         virtual void resetDistributions() {};
 
+        /**
+         * @brief Writes the complete internal state, such that a proposal constructed with the same arguments
+         * continues bitwise identically after deserialize.
+         */
+        virtual void serialize(std::ostream &) const {
+            throw std::runtime_error(getProposalName() + " does not support serialization.");
+        }
+
+        virtual void deserialize(std::istream &) {
+            throw std::runtime_error(getProposalName() + " does not support serialization.");
+        }
+
         virtual ~Proposal() = default;
     };
 }
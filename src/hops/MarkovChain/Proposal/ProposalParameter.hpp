@@ -14,6 +14,7 @@ namespace hops {
         MODEL_JUMP_PROBABILITY,
         ACTIVATION_PROBABILITY,
         DEACTIVATION_PROBABILITY,
+        COVARIANCE,
     };
 
     __attribute__((unused)) static char const *ProposalParameterName[] = {
@@ -26,7 +27,8 @@ namespace hops {
             "max_reflections",
             "model_jump_probability",
             "activation_probability",
-            "deactivation_probability"
+            "deactivation_probability",
+            "covariance"
     };
 }
 
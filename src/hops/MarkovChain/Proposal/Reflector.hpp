@@ -2,6 +2,8 @@
 #define HOPS_REFLECTOR_HPP
 
 #include <limits>
+#include <tuple>
+#include <utility>
 
 #include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
 #include "hops/Utility/VectorType.hpp"
@@ -15,6 +17,21 @@ namespace hops {
     public:
         static constexpr double tolerance = 1e-15;
 
+        /**
+         * @brief Storage for the intermediate vectors of a reflection. Reusing a workspace for repeated reflections
+         * into the same polytope avoids allocations after the first reflection.
+         */
+        struct Workspace {
+            VectorType currentPoint;
+            VectorType trajectoryDirection;
+            VectorType slacks;
+            VectorType slackChange;
+            VectorType activeConstraints;
+            VectorType inverseDistancesToBorder;
+            VectorType quadraticConstraintDistance;
+            Eigen::Matrix<VectorType::Scalar, 1, Eigen::Dynamic> quadraticConstraintProduct;
+        };
+
         /**
          * @brief For startPoint in polytope (Ax<inequalityLhs) the endPoint is reflected into the polytope. If the endPoint
          * is already in the endpoint it is returned.
@@ -34,6 +51,20 @@ namespace hops {
                             const VectorType &endPoint,
                             long maxNumberOfReflections);
 
+        /**
+         * @brief Same as above, but reflects endPoint in place and keeps intermediate results in workspace.
+         * @return pair of 1) boolean whether reflection was successful 2) number of reflections. If the reflection was
+         * not successful, endPoint is left unchanged.
+         */
+        template<typename InternalMatrixType>
+        static std::pair<bool, long>
+        reflectIntoPolytope(const InternalMatrixType &inequalityConstraintMatrix,
+                            const VectorType &inequalityLhs,
+                            const VectorType &startPoint,
+                            VectorType &endPoint,
+                            long maxNumberOfReflections,
+                            Workspace &workspace);
+
         /**
          * @brief For startPoint in polytope (Ax<inequalityLhs) the endPoint is reflected into the polytope. If the endPoint
          * is already in the endpoint it is returned.
@@ -58,6 +89,23 @@ namespace hops {
                             const VectorType &startPoint,
                             const VectorType &endPoint,
                             long maxNumberOfReflections);
+
+        /**
+         * @brief Same as above, but reflects endPoint in place and keeps intermediate results in workspace.
+         * @return pair of 1) boolean whether reflection was successful 2) number of reflections. If the reflection was
+         * not successful, endPoint is left unchanged.
+         */
+        template<typename InternalMatrixType>
+        static std::pair<bool, long>
+        reflectIntoPolytope(const InternalMatrixType &inequalityConstraintMatrix,
+                            const VectorType &inequalityLhs,
+                            const InternalMatrixType &quadraticConstraintMatrix,
+                            const VectorType &quadraticConstraintOffset,
+                            double quadraticConstraintLhs,
+                            const VectorType &startPoint,
+                            VectorType &endPoint,
+                            long maxNumberOfReflections,
+                            Workspace &workspace);
     };
 
     template<typename InternalMatrixType>
@@ -67,25 +115,52 @@ namespace hops {
                                    const VectorType &startPoint,
                                    const VectorType &endPoint,
                                    long maxNumberOfReflections) {
-        VectorType currentPoint = startPoint;
-        VectorType trajectory = endPoint - startPoint;
+        Workspace workspace;
+        VectorType reflectedPoint = endPoint;
+        auto[successful, numberOfReflections] = reflectIntoPolytope(inequalityConstraintMatrix,
+                                                                     inequalityLhs,
+                                                                     startPoint,
+                                                                     reflectedPoint,
+                                                                     maxNumberOfReflections,
+                                                                     workspace);
+        return std::make_tuple(successful, numberOfReflections, reflectedPoint);
+    }
 
-        VectorType::Scalar trajectoryLength = trajectory.norm();
+    template<typename InternalMatrixType>
+    std::pair<bool, long>
+    Reflector::reflectIntoPolytope(const InternalMatrixType &inequalityConstraintMatrix,
+                                   const VectorType &inequalityLhs,
+                                   const VectorType &startPoint,
+                                   VectorType &endPoint,
+                                   long maxNumberOfReflections,
+                                   Workspace &workspace) {
+        VectorType &currentPoint = workspace.currentPoint;
+        VectorType &trajectoryDirection = workspace.trajectoryDirection;
+        VectorType &slacks = workspace.slacks;
+        VectorType &activeConstraints = workspace.activeConstraints;
+        VectorType &inverseDistancesToBorder = workspace.inverseDistancesToBorder;
+        VectorType &slackChange = workspace.slackChange;
+
+        currentPoint = startPoint;
+        trajectoryDirection = endPoint - startPoint;
+
+        VectorType::Scalar trajectoryLength = trajectoryDirection.norm();
         VectorType::Scalar OriginalTrajectoryLength = trajectoryLength;
-        VectorType trajectoryDirection = trajectory / trajectoryLength;
+        trajectoryDirection /= trajectoryLength;
 
         // Used to implement kahan summation.
         double distanceTravelled = 0.;
         double distanceTravelledError = 0.;
 
-        VectorType slacks = inequalityLhs - inequalityConstraintMatrix * startPoint;
+        slacks.noalias() = inequalityConstraintMatrix * startPoint;
+        slacks = inequalityLhs - slacks;
 
-        Eigen::VectorXd activeConstraints = Eigen::VectorXd::Ones(slacks.rows());
+        activeConstraints.setOnes(slacks.rows());
 
         long numberOfReflections = 0;
         do {
-            Eigen::VectorXd inverseDistancesToBorder = activeConstraints.cwiseProduct(
-                    ((inequalityConstraintMatrix * trajectoryDirection).cwiseQuotient(slacks)));
+            inverseDistancesToBorder.noalias() = inequalityConstraintMatrix * trajectoryDirection;
+            inverseDistancesToBorder = activeConstraints.cwiseProduct(inverseDistancesToBorder.cwiseQuotient(slacks));
 
             double distanceToBorder = 1. / inverseDistancesToBorder.array().unaryExpr(
                     [](double v) { return std::isfinite(v) ? v : -1; }).maxCoeff();
@@ -106,7 +181,8 @@ namespace hops {
 
                 trajectoryLength = OriginalTrajectoryLength - distanceTravelled;
                 currentPoint += trajectoryDirection * distanceToBorder;
-                slacks.noalias() -= inequalityConstraintMatrix * trajectoryDirection * distanceToBorder;
+                slackChange.noalias() = inequalityConstraintMatrix * trajectoryDirection;
+                slacks -= slackChange * distanceToBorder;
                 for (int i = 0; i < inequalityConstraintMatrix.rows(); ++i) {
                     if (slacks[i] <= tolerance) {
                         activeConstraints[i] = 0;
@@ -121,9 +197,10 @@ namespace hops {
         } while (trajectoryLength > 0 && numberOfReflections < maxNumberOfReflections);
 
         if (numberOfReflections < maxNumberOfReflections) {
-            return std::make_tuple(true, numberOfReflections, currentPoint);
+            endPoint = currentPoint;
+            return std::make_pair(true, numberOfReflections);
         }
-        return std::make_tuple(false, numberOfReflections, endPoint);
+        return std::make_pair(false, numberOfReflections);
     }
 
     template<typename InternalMatrixType>
@@ -136,45 +213,76 @@ namespace hops {
                                    const VectorType &startPoint,
                                    const VectorType &endPoint,
                                    long maxNumberOfReflections) {
-        VectorType currentPoint = startPoint;
-        VectorType trajectory = endPoint - startPoint;
+        Workspace workspace;
+        VectorType reflectedPoint = endPoint;
+        auto[successful, numberOfReflections] = reflectIntoPolytope(inequalityConstraintMatrix,
+                                                                     inequalityLhs,
+                                                                     quadraticConstraintMatrix,
+                                                                     quadraticConstraintOffset,
+                                                                     quadraticConstraintLhs,
+                                                                     startPoint,
+                                                                     reflectedPoint,
+                                                                     maxNumberOfReflections,
+                                                                     workspace);
+        return std::make_tuple(successful, numberOfReflections, reflectedPoint);
+    }
 
-        VectorType::Scalar trajectoryLength = trajectory.norm();
+    template<typename InternalMatrixType>
+    std::pair<bool, long>
+    Reflector::reflectIntoPolytope(const InternalMatrixType &inequalityConstraintMatrix,
+                                   const VectorType &inequalityLhs,
+                                   const InternalMatrixType &quadraticConstraintMatrix,
+                                   const VectorType &quadraticConstraintOffset,
+                                   double quadraticConstraintLhs,
+                                   const VectorType &startPoint,
+                                   VectorType &endPoint,
+                                   long maxNumberOfReflections,
+                                   Workspace &workspace) {
+        VectorType &currentPoint = workspace.currentPoint;
+        VectorType &trajectoryDirection = workspace.trajectoryDirection;
+        VectorType &slacks = workspace.slacks;
+        VectorType &activeConstraints = workspace.activeConstraints;
+        VectorType &inverseDistancesToBorder = workspace.inverseDistancesToBorder;
+        VectorType &slackChange = workspace.slackChange;
+        VectorType &quadraticConstraintDistance = workspace.quadraticConstraintDistance;
+        auto &quadraticConstraintProduct = workspace.quadraticConstraintProduct;
+
+        currentPoint = startPoint;
+        trajectoryDirection = endPoint - startPoint;
+
+        VectorType::Scalar trajectoryLength = trajectoryDirection.norm();
         VectorType::Scalar OriginalTrajectoryLength = trajectoryLength;
-        VectorType trajectoryDirection = trajectory / trajectoryLength;
+        trajectoryDirection /= trajectoryLength;
 
         // Used to implement kahan summation.
         double distanceTravelled = 0.;
         double distanceTravelledError = 0.;
 
-        VectorType slacks = inequalityLhs - inequalityConstraintMatrix * startPoint;
+        slacks.noalias() = inequalityConstraintMatrix * startPoint;
+        slacks = inequalityLhs - slacks;
 
-        hops::VectorType activeConstraints = Eigen::VectorXd::Ones(slacks.rows());
-        InternalMatrixType squaredQuadraticConstraintMatrix =
-                quadraticConstraintMatrix.transpose() * quadraticConstraintMatrix;
+        activeConstraints.setOnes(slacks.rows());
 
         long numberOfReflections = 0;
         do {
-            Eigen::VectorXd inverseDistancesToBorder = activeConstraints.cwiseProduct(
-                    ((inequalityConstraintMatrix * trajectoryDirection).cwiseQuotient(slacks)));
+            inverseDistancesToBorder.noalias() = inequalityConstraintMatrix * trajectoryDirection;
+            inverseDistancesToBorder = activeConstraints.cwiseProduct(inverseDistancesToBorder.cwiseQuotient(slacks));
 
             double distanceToLinearConstraints = 1. / inverseDistancesToBorder.array().unaryExpr(
                     [](double v) { return std::isfinite(v) ? v : -1; }).maxCoeff();
 
             // set up p-q-formula for ellispoid distance
-            double quadraticNorm = trajectoryDirection.transpose() * quadraticConstraintMatrix * trajectoryDirection;
-            VectorType directionTranspose = trajectoryDirection.transpose();
+            quadraticConstraintProduct.noalias() = trajectoryDirection.transpose() * quadraticConstraintMatrix;
+            double quadraticNorm = quadraticConstraintProduct * trajectoryDirection;
 
             double scaling = 2 / quadraticNorm;
-            double _p = (trajectoryDirection.transpose() *
-                         quadraticConstraintMatrix *
-                         (currentPoint - quadraticConstraintOffset));
+            quadraticConstraintDistance = currentPoint - quadraticConstraintOffset;
+            double _p = quadraticConstraintProduct * quadraticConstraintDistance;
             double p = scaling * _p;
 
-            double q = ((currentPoint - quadraticConstraintOffset).transpose() *
-                        quadraticConstraintMatrix *
-                        (currentPoint - quadraticConstraintOffset) - quadraticConstraintLhs)
-                       / quadraticNorm;
+            quadraticConstraintProduct.noalias() = quadraticConstraintDistance.transpose() * quadraticConstraintMatrix;
+            double q = (static_cast<double>(quadraticConstraintProduct * quadraticConstraintDistance) -
+                        quadraticConstraintLhs) / quadraticNorm;
 
             double forwardDistanceToQuadraticConstraints = -p / 2 + std::sqrt(std::pow(p / 2, 2) - q);
             // backwards distance not required
@@ -199,7 +307,8 @@ namespace hops {
 
                 trajectoryLength = OriginalTrajectoryLength - distanceTravelled;
                 currentPoint += trajectoryDirection * distanceToBorder;
-                slacks.noalias() -= inequalityConstraintMatrix * trajectoryDirection * distanceToBorder;
+                slackChange.noalias() = inequalityConstraintMatrix * trajectoryDirection;
+                slacks -= slackChange * distanceToBorder;
                 for (int i = 0; i < inequalityConstraintMatrix.rows(); ++i) {
                     if (distanceToLinearConstraints < distanceToQuadraticConstraints) {
                         // reflect on linear constraints
@@ -220,9 +329,10 @@ namespace hops {
         } while (trajectoryLength > 0 && numberOfReflections < maxNumberOfReflections);
 
         if (numberOfReflections < maxNumberOfReflections) {
-            return std::make_tuple(true, numberOfReflections, currentPoint);
+            endPoint = currentPoint;
+            return std::make_pair(true, numberOfReflections);
         }
-        return std::make_tuple(false, numberOfReflections, endPoint);
+        return std::make_pair(false, numberOfReflections);
     }
 }
 
@@ -6,6 +6,7 @@
 
 #include "hops/Model/Gaussian.hpp"
 #include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
+#include "hops/Utility/BinarySerialization.hpp"
 #include "hops/Utility/DefaultDimensionNames.hpp"
 #include "hops/Utility/MatrixType.hpp"
 #include "hops/Utility/StringUtility.hpp"
@@ -42,8 +43,12 @@ namespace hops {
 
         [[nodiscard]] VectorType getState() const override;
 
+        void copyStateTo(Eigen::Ref<VectorType> destination) const override;
+
         [[nodiscard]] VectorType getProposal() const override;
 
+        void copyProposalTo(Eigen::Ref<VectorType> destination) const override;
+
         [[nodiscard]] double getStateNegativeLogLikelihood() override;
 
         [[nodiscard]] double getProposalNegativeLogLikelihood() override;
@@ -80,6 +85,10 @@ namespace hops {
 
         void resetDistributions() override;
 
+        void serialize(std::ostream &out) const override;
+
+        void deserialize(std::istream &in) override;
+
     private:
         InternalMatrixType A;
         InternalVectorType b;
@@ -129,9 +138,11 @@ namespace hops {
     VectorType &TruncatedGaussianProposal<InternalMatrixType, InternalVectorType>::propose(RandomNumberGenerator &rng) {
         // A * (L * (wS) + mu) < b
         // A * L * ws < b - A * mu
-        whiteState = cholesky.template triangularView<Eigen::Lower>().solve(state - mean);
+        whiteState = state - mean;
+        cholesky.template triangularView<Eigen::Lower>().solveInPlace(whiteState);
         for (long i = state.rows() - 1; i >= 0; --i) {
-            slacks = whitenedB - whitenedA * whiteState;
+            slacks.noalias() = whitenedA * whiteState;
+            slacks = whitenedB - slacks;
             inverseDistances = whitenedA.col(i).cwiseQuotient(slacks);
             forwardDistance = 1. / inverseDistances.maxCoeff();
             backwardDistance = 1. / inverseDistances.minCoeff();
@@ -154,7 +165,8 @@ namespace hops {
             whiteState(i) = step;
         }
 
-        proposal = cholesky * whiteState + mean;
+        proposal.noalias() = cholesky * whiteState;
+        proposal += mean;
         return proposal;
     }
 
@@ -216,12 +228,22 @@ namespace hops {
         return state;
     }
 
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void TruncatedGaussianProposal<InternalMatrixType, InternalVectorType>::copyStateTo(Eigen::Ref<VectorType> destination) const {
+        destination = state;
+    }
+
     template<typename InternalMatrixType, typename InternalVectorType>
     VectorType
     TruncatedGaussianProposal<InternalMatrixType, InternalVectorType>::getProposal() const {
         return proposal;
     }
 
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void TruncatedGaussianProposal<InternalMatrixType, InternalVectorType>::copyProposalTo(Eigen::Ref<VectorType> destination) const {
+        destination = proposal;
+    }
+
     template<typename InternalMatrixType, typename InternalVectorType>
     std::vector<std::string>
     TruncatedGaussianProposal<InternalMatrixType, InternalVectorType>::getParameterNames() const {
@@ -303,6 +325,16 @@ namespace hops {
         chordStepDistribution.reset();
         backUpChordStepDistribution.reset();
     }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void TruncatedGaussianProposal<InternalMatrixType, InternalVectorType>::serialize(std::ostream &out) const {
+        BinarySerialization::writeAll(out, state, proposal, forwardDistance, backwardDistance, dimensionNames);
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void TruncatedGaussianProposal<InternalMatrixType, InternalVectorType>::deserialize(std::istream &in) {
+        BinarySerialization::readAll(in, state, proposal, forwardDistance, backwardDistance, dimensionNames);
+    }
 }
 
 #endif //HOPS_TRUNCATEDGAUSSIANPROPOSAL_HPP
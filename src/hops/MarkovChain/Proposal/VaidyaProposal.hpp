@@ -0,0 +1,375 @@
+#ifndef HOPS_VAIDYAPROPOSAL_HPP
+#define HOPS_VAIDYAPROPOSAL_HPP
+
+#include <Eigen/LU>
+#include <cmath>
+#include <optional>
+#include <random>
+
+#include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
+#include "hops/Utility/BinarySerialization.hpp"
+#include "hops/Utility/DefaultDimensionNames.hpp"
+#include "hops/Utility/MatrixType.hpp"
+#include "hops/Utility/StringUtility.hpp"
+#include "hops/Utility/VectorType.hpp"
+
+#include "Proposal.hpp"
+#include "DikinEllipsoidCalculator.hpp"
+
+namespace hops {
+    /**
+     * @brief Gaussian Vaidya walk, see https://jmlr.org/papers/v19/18-158.html. The local metric
+     * A^T S^-1 (diag(sigma) + n/m I) S^-1 A weights every constraint by its leverage score sigma, which improves the
+     * mixing time from O(mn) for the Dikin walk to O(m^0.5 n^1.5).
+     */
+    template<typename InternalMatrixType, typename InternalVectorType>
+    class VaidyaProposal : public Proposal {
+    public:
+        /**
+         * @brief Constructs Gaussian Vaidya proposal mechanism on polytope defined as Ax<b.
+         * @param A
+         * @param b
+         * @param currentState
+         * @param stepSize squared radius of the Vaidya ellipsoids, the proposal covariance is stepSize / sqrt(mn) V^-1.
+         * @param sketchDimension number of gaussian projections used to approximate the leverage scores.
+         * Negative values select O(log m) projections, 0 computes the leverage scores exactly.
+         * If the sketch is not smaller than the dimension of the polytope, the leverage scores are computed exactly.
+         */
+        VaidyaProposal(InternalMatrixType A,
+                       InternalVectorType b,
+                       const VectorType &currentState,
+                       double stepSize = 0.1,
+                       long sketchDimension = -1);
+
+        VectorType &propose(RandomNumberGenerator &randomNumberGenerator) override;
+
+        VectorType &
+        propose(RandomNumberGenerator &randomNumberGenerator, const Eigen::VectorXd &activeIndices) override;
+
+        VectorType &acceptProposal() override;
+
+        void setState(const VectorType &newState) override;
+
+        void setProposal(const VectorType &newProposal) override;
+
+        [[nodiscard]] VectorType getState() const override;
+
+        void copyStateTo(Eigen::Ref<VectorType> destination) const override;
+
+        [[nodiscard]] VectorType getProposal() const override;
+
+        void copyProposalTo(Eigen::Ref<VectorType> destination) const override;
+
+        void setDimensionNames(const std::vector<std::string> &names) override;
+
+        std::vector<std::string> getDimensionNames() const override;
+
+        [[nodiscard]] std::vector<std::string> getParameterNames() const override;
+
+        [[nodiscard]] std::any getParameter(const ProposalParameter &parameter) const override;
+
+        [[nodiscard]] std::string getParameterType(const ProposalParameter &parameter) const override;
+
+        void setParameter(const ProposalParameter &parameter, const std::any &value) override;
+
+        void setStepSize(double stepSize);
+
+        [[nodiscard]] std::string getProposalName() const override;
+
+        [[nodiscard]] std::optional<double> getStepSize() const override;
+
+        [[nodiscard]] static bool hasStepSize();
+
+        [[nodiscard]] std::unique_ptr<Proposal> copyProposal() const override;
+
+        double computeLogAcceptanceProbability() override;
+
+        [[nodiscard]] const MatrixType &getA() const override;
+
+        [[nodiscard]] const VectorType &getB() const override;
+
+        void resetDistributions() override;
+
+        void serialize(std::ostream &out) const override;
+
+        void deserialize(std::istream &in) override;
+
+    private:
+        bool computeCholeskyFactorOfVaidyaEllipsoid(const VectorType &x, MatrixType &choleskyFactor);
+
+        MatrixType A;
+        VectorType b;
+
+        VectorType state;
+        VectorType proposal;
+
+        double stateLogSqrtDeterminant = 0;
+        double proposalLogSqrtDeterminant = 0;
+        MatrixType stateCholeskyOfVaidyaEllipsoid;
+        MatrixType proposalCholeskyOfVaidyaEllipsoid;
+
+        double stepSize;
+        double geometricFactor = 0;
+        double covarianceFactor = 0;
+        double boundaryCushion = 0;
+
+        MatrixType sketch;
+        VectorType unitWeights;
+
+        // Workspaces, which keep their sizes between steps.
+        VectorType vaidyaWeights;
+        VectorType constraintValues;
+        VectorType stateDifference;
+        VectorType transformedStateDifference;
+
+        std::normal_distribution<double> normalDistribution{0., 1.};
+        DikinEllipsoidCalculator<MatrixType, VectorType> dikinEllipsoidCalculator;
+
+        std::vector<std::string> dimensionNames;
+    };
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void VaidyaProposal<InternalMatrixType, InternalVectorType>::resetDistributions() {
+        normalDistribution.reset();
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    VaidyaProposal<InternalMatrixType, InternalVectorType>::VaidyaProposal(InternalMatrixType A,
+                                                                           InternalVectorType b,
+                                                                           const VectorType &currentState,
+                                                                           double stepSize,
+                                                                           long sketchDimension) :
+            A(std::move(A)),
+            b(std::move(b)),
+            dikinEllipsoidCalculator(this->A, this->b) {
+        if (sketchDimension < 0) {
+            sketchDimension = static_cast<long>(std::ceil(8 * std::log(static_cast<double>(this->A.rows()))));
+        }
+        if (sketchDimension > 0 && sketchDimension < this->A.cols()) {
+            // The sketch is drawn once with a fixed seed, so that the metric stays a deterministic function of the
+            // state and the Metropolis-Hastings correction remains exact.
+            RandomNumberGenerator sketchRandomNumberGenerator(0);
+            std::normal_distribution<double> sketchDistribution(0., 1.);
+            sketch = MatrixType(sketchDimension, this->A.cols());
+            for (long i = 0; i < sketch.size(); ++i) {
+                sketch(i) = sketchDistribution(sketchRandomNumberGenerator);
+            }
+        }
+        unitWeights = VectorType::Ones(this->A.rows());
+
+        VaidyaProposal::setStepSize(stepSize);
+        VaidyaProposal::setState(currentState);
+        proposal = state;
+
+        this->dimensionNames = createDefaultDimensionNames(this->state.rows());
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    bool VaidyaProposal<InternalMatrixType, InternalVectorType>::computeCholeskyFactorOfVaidyaEllipsoid(
+            const VectorType &x, MatrixType &choleskyFactor) {
+        // The cholesky factor of the Dikin ellipsoid is only needed for the leverage scores, so it is written into
+        // choleskyFactor and overwritten by the factor of the Vaidya ellipsoid afterwards.
+        if (!dikinEllipsoidCalculator.computeCholeskyFactorOfDikinEllipsoid(x, choleskyFactor)) {
+            return false;
+        }
+        dikinEllipsoidCalculator.computeLeverageScores(x, unitWeights, choleskyFactor, sketch, vaidyaWeights);
+        vaidyaWeights.array() += static_cast<double>(A.cols()) / A.rows();
+        return dikinEllipsoidCalculator.computeCholeskyFactorOfWeightedDikinEllipsoid(x, vaidyaWeights, choleskyFactor);
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    VectorType &
+    VaidyaProposal<InternalMatrixType, InternalVectorType>::propose(RandomNumberGenerator &randomNumberGenerator) {
+        for (long i = 0; i < proposal.rows(); ++i) {
+            proposal(i) = normalDistribution(randomNumberGenerator);
+        }
+        stateCholeskyOfVaidyaEllipsoid.template triangularView<Eigen::Lower>().transpose().solveInPlace(proposal);
+        proposal = state + covarianceFactor * proposal;
+
+        return proposal;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    VectorType &VaidyaProposal<InternalMatrixType, InternalVectorType>::acceptProposal() {
+        state.swap(proposal);
+        stateCholeskyOfVaidyaEllipsoid.swap(proposalCholeskyOfVaidyaEllipsoid);
+        stateLogSqrtDeterminant = proposalLogSqrtDeterminant;
+        return state;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void VaidyaProposal<InternalMatrixType, InternalVectorType>::setState(const VectorType &newState) {
+        if (((b - A * newState).array() < 0).any()) {
+            throw std::invalid_argument("Starting point outside polytope always gives constant Markov chain.");
+        }
+        state = newState;
+        if (!computeCholeskyFactorOfVaidyaEllipsoid(state, stateCholeskyOfVaidyaEllipsoid)) {
+            throw std::runtime_error("Could not compute cholesky factorization for newState.");
+        }
+        stateLogSqrtDeterminant = stateCholeskyOfVaidyaEllipsoid.diagonal().array().log().sum();
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void VaidyaProposal<InternalMatrixType, InternalVectorType>::setProposal(const VectorType &newProposal) {
+        proposal = newProposal;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    double VaidyaProposal<InternalMatrixType, InternalVectorType>::computeLogAcceptanceProbability() {
+        constraintValues.noalias() = A * proposal;
+        bool isProposalInteriorPoint = ((constraintValues - b).array() < -boundaryCushion).all();
+        if (!isProposalInteriorPoint) {
+            return -std::numeric_limits<double>::infinity();
+        }
+
+        if (!computeCholeskyFactorOfVaidyaEllipsoid(proposal, proposalCholeskyOfVaidyaEllipsoid)) {
+            return -std::numeric_limits<double>::infinity();
+        }
+
+        proposalLogSqrtDeterminant = proposalCholeskyOfVaidyaEllipsoid.diagonal().array().log().sum();
+        stateDifference = state - proposal;
+
+        transformedStateDifference.noalias() = stateCholeskyOfVaidyaEllipsoid.transpose() * stateDifference;
+        double stateNorm = transformedStateDifference.squaredNorm();
+        transformedStateDifference.noalias() = proposalCholeskyOfVaidyaEllipsoid.transpose() * stateDifference;
+        double proposalNorm = transformedStateDifference.squaredNorm();
+
+        return proposalLogSqrtDeterminant
+               - stateLogSqrtDeterminant
+               + geometricFactor * (stateNorm - proposalNorm);
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void VaidyaProposal<InternalMatrixType, InternalVectorType>::setStepSize(double newStepSize) {
+        stepSize = newStepSize;
+        double scale = std::sqrt(static_cast<double>(A.rows() * A.cols()));
+        geometricFactor = scale / (2 * stepSize);
+        covarianceFactor = std::sqrt(stepSize / scale);
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    std::string VaidyaProposal<InternalMatrixType, InternalVectorType>::getProposalName() const {
+        return "VaidyaWalk";
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    std::optional<double> VaidyaProposal<InternalMatrixType, InternalVectorType>::getStepSize() const {
+        return stepSize;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    bool VaidyaProposal<InternalMatrixType, InternalVectorType>::hasStepSize() {
+        return true;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    std::unique_ptr<Proposal> VaidyaProposal<InternalMatrixType, InternalVectorType>::copyProposal() const {
+        return std::make_unique<VaidyaProposal>(*this);
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    VectorType VaidyaProposal<InternalMatrixType, InternalVectorType>::getState() const {
+        return state;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void VaidyaProposal<InternalMatrixType, InternalVectorType>::copyStateTo(Eigen::Ref<VectorType> destination) const {
+        destination = state;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    VectorType VaidyaProposal<InternalMatrixType, InternalVectorType>::getProposal() const {
+        return proposal;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void VaidyaProposal<InternalMatrixType, InternalVectorType>::copyProposalTo(Eigen::Ref<VectorType> destination) const {
+        destination = proposal;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    std::vector<std::string> VaidyaProposal<InternalMatrixType, InternalVectorType>::getParameterNames() const {
+        return {
+                ProposalParameterName[static_cast<int>(ProposalParameter::BOUNDARY_CUSHION)],
+                ProposalParameterName[static_cast<int>(ProposalParameter::STEP_SIZE)],
+        };
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    std::any
+    VaidyaProposal<InternalMatrixType, InternalVectorType>::getParameter(const ProposalParameter &parameter) const {
+        if (parameter == ProposalParameter::STEP_SIZE) {
+            return std::any(stepSize);
+        } else if (parameter == ProposalParameter::BOUNDARY_CUSHION) {
+            return std::any(boundaryCushion);
+        }
+        throw std::invalid_argument("Can't get parameter which doesn't exist in " + this->getProposalName());
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    std::string
+    VaidyaProposal<InternalMatrixType, InternalVectorType>::getParameterType(const ProposalParameter &parameter) const {
+        if (parameter == ProposalParameter::STEP_SIZE || parameter == ProposalParameter::BOUNDARY_CUSHION) {
+            return "double";
+        } else {
+            throw std::invalid_argument("Can't get parameter which doesn't exist in " + this->getProposalName());
+        }
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void VaidyaProposal<InternalMatrixType, InternalVectorType>::setParameter(const ProposalParameter &parameter,
+                                                                              const std::any &value) {
+        if (parameter == ProposalParameter::STEP_SIZE) {
+            setStepSize(std::any_cast<double>(value));
+        } else if (parameter == ProposalParameter::BOUNDARY_CUSHION) {
+            boundaryCushion = std::any_cast<double>(value);
+        } else {
+            throw std::invalid_argument("Can't get parameter which doesn't exist in " + this->getProposalName());
+        }
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    const MatrixType &VaidyaProposal<InternalMatrixType, InternalVectorType>::getA() const {
+        return A;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    const VectorType &VaidyaProposal<InternalMatrixType, InternalVectorType>::getB() const {
+        return b;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    VectorType &VaidyaProposal<InternalMatrixType, InternalVectorType>::propose(RandomNumberGenerator &,
+                                                                                const Eigen::VectorXd &) {
+        throw std::runtime_error("Propose with rng and activeIndices not implemented");
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void
+    VaidyaProposal<InternalMatrixType, InternalVectorType>::setDimensionNames(const std::vector<std::string> &names) {
+        dimensionNames = names;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    std::vector<std::string> VaidyaProposal<InternalMatrixType, InternalVectorType>::getDimensionNames() const {
+        return dimensionNames;
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void VaidyaProposal<InternalMatrixType, InternalVectorType>::serialize(std::ostream &out) const {
+        BinarySerialization::writeAll(out, state, proposal, stateLogSqrtDeterminant, proposalLogSqrtDeterminant,
+                                      stateCholeskyOfVaidyaEllipsoid, proposalCholeskyOfVaidyaEllipsoid, stepSize,
+                                      geometricFactor, covarianceFactor, boundaryCushion, normalDistribution,
+                                      dimensionNames);
+    }
+
+    template<typename InternalMatrixType, typename InternalVectorType>
+    void VaidyaProposal<InternalMatrixType, InternalVectorType>::deserialize(std::istream &in) {
+        BinarySerialization::readAll(in, state, proposal, stateLogSqrtDeterminant, proposalLogSqrtDeterminant,
+                                     stateCholeskyOfVaidyaEllipsoid, proposalCholeskyOfVaidyaEllipsoid, stepSize,
+                                     geometricFactor, covarianceFactor, boundaryCushion, normalDistribution,
+                                     dimensionNames);
+    }
+}
+
+#endif //HOPS_VAIDYAPROPOSAL_HPP
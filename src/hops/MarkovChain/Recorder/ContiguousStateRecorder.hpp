@@ -0,0 +1,69 @@
+#ifndef HOPS_CONTIGUOUSSTATERECORDER_HPP
+#define HOPS_CONTIGUOUSSTATERECORDER_HPP
+
+#include <memory>
+#include <vector>
+
+#include "hops/FileWriter/FileWriter.hpp"
+#include "hops/MarkovChain/Recorder/IsClearRecordsAvailable.hpp"
+#include "hops/MarkovChain/Recorder/IsStoreRecordAvailable.hpp"
+#include "hops/MarkovChain/Recorder/IsWriteRecordsToFileAvailable.hpp"
+#include "hops/MarkovChain/Recorder/StateArena.hpp"
+#include "hops/Utility/MatrixType.hpp"
+
+namespace hops {
+    /**
+     * @brief Records states like the StateRecorder, but copies them into a StateArena instead of allocating a vector
+     * per state. The records are exposed as Eigen::Map views on the arena.
+     */
+    template<typename MarkovChainImpl>
+    class ContiguousStateRecorder : public MarkovChainImpl {
+    public:
+        explicit ContiguousStateRecorder(const MarkovChainImpl &markovChainImpl, long chunkSize = 1024) :
+                MarkovChainImpl(markovChainImpl) {
+            records = std::make_shared<StateArena>(MarkovChainImpl::getState().rows(), chunkSize);
+        }
+
+        void writeRecordsToFile(const FileWriter *const fileWriter) const {
+            // Writes one state per row, like the StateRecorder
+            fileWriter->write("states", MatrixType(records->toMatrix().transpose()));
+            if constexpr(IsWriteRecordsToFileAvailable<MarkovChainImpl>::value) {
+                MarkovChainImpl::writeRecordsToFile(fileWriter);
+            }
+        }
+
+        [[nodiscard]] const StateArena &getStateRecords() const {
+            return *records;
+        }
+
+        /**
+         * @return view on all states as columns, which requires reserving the number of states before recording.
+         */
+        [[nodiscard]] StateArena::ChunkView getStateRecordsAsMatrix() const {
+            return records->getStates();
+        }
+
+        void reserveStateRecords(long numberOfSamples) {
+            records->reserve(numberOfSamples);
+        }
+
+        void storeRecord() {
+            MarkovChainImpl::copyStateTo(records->append());
+            if constexpr(IsStoreRecordAvailable<MarkovChainImpl>::value) {
+                MarkovChainImpl::storeRecord();
+            }
+        }
+
+        void clearRecords() {
+            records->clear();
+            if constexpr(IsClearRecordsAvailable<MarkovChainImpl>::value) {
+                MarkovChainImpl::clearRecords();
+            }
+        }
+
+    private:
+        std::shared_ptr<StateArena> records;
+    };
+}
+
+#endif //HOPS_CONTIGUOUSSTATERECORDER_HPP
@@ -0,0 +1,150 @@
+#ifndef HOPS_PROJECTIONRECORDER_HPP
+#define HOPS_PROJECTIONRECORDER_HPP
+
+#include <Eigen/Sparse>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "hops/FileWriter/FileWriter.hpp"
+#include "hops/MarkovChain/Recorder/IsClearRecordsAvailable.hpp"
+#include "hops/MarkovChain/Recorder/IsStoreRecordAvailable.hpp"
+#include "hops/MarkovChain/Recorder/IsWriteRecordsToFileAvailable.hpp"
+#include "hops/Transformation/LinearTransformation.hpp"
+#include "hops/Utility/MatrixType.hpp"
+#include "hops/Utility/VectorType.hpp"
+
+namespace hops {
+    /**
+     * @brief Records only the projections P x of the states instead of the states x, e.g. a few fluxes of interest.
+     * @details If the chain samples in a rounded space, pass the unrounding transformation x = T y + s to the recorder
+     * instead of wrapping the proposal in a StateTransformation. The recorder then records (P T) y + P s, so the
+     * unrounded states are never computed and recording costs scale with the number of projections.
+     * @tparam ProjectionMatrixType Eigen::MatrixXd or a sparse matrix type like Eigen::SparseMatrix<double>.
+     */
+    template<typename MarkovChainImpl, typename ProjectionMatrixType = MatrixType>
+    class ProjectionRecorder : public MarkovChainImpl {
+    public:
+        /**
+         * @param projection P with one row per recorded quantity.
+         * @param indices optional subset of the state dimensions, which P is applied to. P requires one column per
+         * index then.
+         */
+        ProjectionRecorder(const MarkovChainImpl &markovChainImpl,
+                           const ProjectionMatrixType &projection,
+                           const std::vector<long> &indices = {}) :
+                MarkovChainImpl(markovChainImpl) {
+            long dimension = MarkovChainImpl::getState().rows();
+            setProjection(projection, indices, MatrixType::Identity(dimension, dimension),
+                          VectorType::Zero(dimension));
+        }
+
+        /**
+         * @param transformation unrounding transformation from the space of the chain to the space of P.
+         */
+        ProjectionRecorder(const MarkovChainImpl &markovChainImpl,
+                           const ProjectionMatrixType &projection,
+                           const LinearTransformation &transformation,
+                           const std::vector<long> &indices = {}) :
+                MarkovChainImpl(markovChainImpl) {
+            setProjection(projection, indices, transformation.getMatrix(), transformation.getShift());
+        }
+
+        /**
+         * @brief Records the state dimensions in indices only, i.e. P selects rows of the state.
+         */
+        static ProjectionMatrixType createSelection(long dimension, const std::vector<long> &indices) {
+            std::vector<Eigen::Triplet<double>> triplets;
+            for (size_t i = 0; i < indices.size(); ++i) {
+                if (indices[i] < 0 || indices[i] >= dimension) {
+                    throw std::out_of_range("Index " + std::to_string(indices[i]) + " is out of range.");
+                }
+                triplets.emplace_back(i, indices[i], 1.);
+            }
+            Eigen::SparseMatrix<double> selection(static_cast<long>(indices.size()), dimension);
+            selection.setFromTriplets(triplets.begin(), triplets.end());
+            return ProjectionMatrixType(selection);
+        }
+
+        void writeRecordsToFile(const FileWriter *const fileWriter) const {
+            fileWriter->write("projections", *records);
+            if constexpr(IsWriteRecordsToFileAvailable<MarkovChainImpl>::value) {
+                MarkovChainImpl::writeRecordsToFile(fileWriter);
+            }
+        }
+
+        [[nodiscard]] const std::vector<VectorType> &getProjectionRecords() const {
+            return *records;
+        }
+
+        /**
+         * @return the projection applied to the state of the chain, i.e. including the unrounding transformation.
+         */
+        [[nodiscard]] const ProjectionMatrixType &getEffectiveProjection() const {
+            return *effectiveProjection;
+        }
+
+        void reserveProjectionRecords(long numberOfSamples) {
+            records->reserve(numberOfSamples);
+        }
+
+        void storeRecord() {
+            MarkovChainImpl::copyStateTo(*stateWorkspace);
+            records->emplace_back(*effectiveProjection * *stateWorkspace + *effectiveShift);
+            if constexpr(IsStoreRecordAvailable<MarkovChainImpl>::value) {
+                MarkovChainImpl::storeRecord();
+            }
+        }
+
+        void clearRecords() {
+            records->clear();
+            if constexpr(IsClearRecordsAvailable<MarkovChainImpl>::value) {
+                MarkovChainImpl::clearRecords();
+            }
+        }
+
+    private:
+        void setProjection(const ProjectionMatrixType &projection,
+                           const std::vector<long> &indices,
+                           const MatrixType &transformationMatrix,
+                           const VectorType &shift) {
+            if (transformationMatrix.cols() != MarkovChainImpl::getState().rows()) {
+                throw std::invalid_argument("Transformation does not match the dimension of the Markov chain.");
+            }
+            long dimension = transformationMatrix.rows();
+            MatrixType matrix = transformationMatrix;
+            VectorType offset = shift;
+            if (!indices.empty()) {
+                auto selection = ProjectionRecorder<MarkovChainImpl, Eigen::SparseMatrix<double>>::createSelection(
+                        dimension, indices);
+                matrix = selection * transformationMatrix;
+                offset = selection * shift;
+            }
+            if (projection.cols() != matrix.rows()) {
+                throw std::invalid_argument("Projection requires " + std::to_string(matrix.rows()) + " columns.");
+            }
+
+            // Skips the multiplication with the identity if the chain samples in the space of P.
+            if (indices.empty() && matrix.isIdentity(0)) {
+                effectiveProjection = std::make_shared<ProjectionMatrixType>(projection);
+            } else if constexpr (std::is_base_of_v<Eigen::SparseMatrixBase<ProjectionMatrixType>,
+                                                   ProjectionMatrixType>) {
+                effectiveProjection = std::make_shared<ProjectionMatrixType>(MatrixType(projection * matrix)
+                                                                                     .sparseView());
+            } else {
+                effectiveProjection = std::make_shared<ProjectionMatrixType>(projection * matrix);
+            }
+            effectiveShift = std::make_shared<VectorType>(projection * offset);
+            stateWorkspace = std::make_shared<VectorType>(MarkovChainImpl::getState().rows());
+            records = std::make_shared<std::vector<VectorType>>();
+        }
+
+        std::shared_ptr<ProjectionMatrixType> effectiveProjection;
+        std::shared_ptr<VectorType> effectiveShift;
+        std::shared_ptr<VectorType> stateWorkspace;
+        std::shared_ptr<std::vector<VectorType>> records;
+    };
+}
+
+#endif //HOPS_PROJECTIONRECORDER_HPP
@@ -0,0 +1,191 @@
+#ifndef HOPS_STATEARENA_HPP
+#define HOPS_STATEARENA_HPP
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "hops/Utility/MatrixType.hpp"
+#include "hops/Utility/VectorType.hpp"
+
+namespace hops {
+    /**
+     * @brief Stores states of equal dimension as the columns of few large column-major chunks.
+     * @details Appending a state copies it into the next free column, so it neither allocates nor scatters states
+     * across the heap. A new chunk is only allocated once all chunks are full. Reserving the number of states up
+     * front, when it is known, keeps all states in a single chunk, which can then be viewed as one matrix. Views stay
+     * valid while states are appended, because chunks are never reallocated.
+     */
+    class StateArena {
+    public:
+        using StateView = Eigen::Map<const VectorType>;
+        using ChunkView = Eigen::Map<const MatrixType>;
+
+        /**
+         * @param dimension of the states. If zero, it is taken from the first appended state.
+         * @param chunkSize number of states per chunk, which is allocated when no capacity is left.
+         */
+        explicit StateArena(long dimension = 0, long chunkSize = 1024) : dimension(dimension), chunkSize(chunkSize) {
+            if (dimension < 0 || chunkSize <= 0) {
+                throw std::invalid_argument("StateArena requires a non-negative dimension and a positive chunk size.");
+            }
+        }
+
+        /**
+         * @brief Allocates capacity for numberOfStates states in total, as a single chunk if the arena is empty.
+         */
+        void reserve(long numberOfStates) {
+            if (dimension == 0) {
+                throw std::invalid_argument("Reserving states requires the dimension of the states.");
+            }
+            long capacity = getCapacity();
+            if (numberOfStates > capacity) {
+                chunks.emplace_back(dimension, numberOfStates - capacity);
+                chunkSizes.emplace_back(0);
+            }
+        }
+
+        /**
+         * @return writable view on the next free column, e.g. for copyStateTo. The state counts as stored immediately.
+         */
+        Eigen::Map<VectorType> append() {
+            if (dimension == 0) {
+                throw std::invalid_argument("Appending uninitialized states requires the dimension of the states.");
+            }
+            while (currentChunk < static_cast<long>(chunks.size()) &&
+                   chunkSizes[currentChunk] == chunks[currentChunk].cols()) {
+                ++currentChunk;
+            }
+            if (currentChunk == static_cast<long>(chunks.size())) {
+                chunks.emplace_back(dimension, chunkSize);
+                chunkSizes.emplace_back(0);
+            }
+            ++numberOfStates;
+            return Eigen::Map<VectorType>(chunks[currentChunk].col(chunkSizes[currentChunk]++).data(), dimension);
+        }
+
+        void append(const VectorType &state) {
+            if (dimension == 0) {
+                dimension = state.rows();
+            }
+            if (state.rows() != dimension) {
+                throw std::invalid_argument("State has dimension " + std::to_string(state.rows()) + ", but " +
+                                            std::to_string(dimension) + " was expected.");
+            }
+            append() = state;
+        }
+
+        /**
+         * @brief Removes all states, but keeps the allocated chunks for reuse.
+         */
+        void clear() {
+            std::fill(chunkSizes.begin(), chunkSizes.end(), 0);
+            currentChunk = 0;
+            numberOfStates = 0;
+        }
+
+        [[nodiscard]] long size() const {
+            return numberOfStates;
+        }
+
+        [[nodiscard]] bool empty() const {
+            return numberOfStates == 0;
+        }
+
+        [[nodiscard]] long getDimension() const {
+            return dimension;
+        }
+
+        [[nodiscard]] long getCapacity() const {
+            long capacity = 0;
+            for (const auto &chunk: chunks) {
+                capacity += chunk.cols();
+            }
+            return capacity;
+        }
+
+        /**
+         * @return view on the i-th state without copying.
+         */
+        [[nodiscard]] StateView operator[](long index) const {
+            if (index < 0 || index >= numberOfStates) {
+                throw std::out_of_range("State " + std::to_string(index) + " is out of range.");
+            }
+            for (size_t chunk = 0; chunk < chunks.size(); ++chunk) {
+                if (index < chunkSizes[chunk]) {
+                    return StateView(chunks[chunk].col(index).data(), dimension);
+                }
+                index -= chunkSizes[chunk];
+            }
+            throw std::out_of_range("State is out of range.");
+        }
+
+        /**
+         * @return views on the filled columns of all non-empty chunks, which hold the states in order.
+         */
+        [[nodiscard]] std::vector<ChunkView> getChunks() const {
+            std::vector<ChunkView> views;
+            for (size_t chunk = 0; chunk < chunks.size(); ++chunk) {
+                if (chunkSizes[chunk] > 0) {
+                    views.emplace_back(chunks[chunk].data(), dimension, chunkSizes[chunk]);
+                }
+            }
+            return views;
+        }
+
+        /**
+         * @return view on all states as columns of a single matrix.
+         * @throws std::runtime_error if the states are spread over several chunks, see reserve.
+         */
+        [[nodiscard]] ChunkView getStates() const {
+            std::vector<ChunkView> views = getChunks();
+            if (views.size() > 1) {
+                throw std::runtime_error("States are spread over " + std::to_string(views.size()) +
+                                         " chunks, use getChunks or toMatrix instead.");
+            }
+            if (views.empty()) {
+                return ChunkView(nullptr, dimension, 0);
+            }
+            return views.front();
+        }
+
+        /**
+         * @return copy of all states as columns of a single matrix.
+         */
+        [[nodiscard]] MatrixType toMatrix() const {
+            MatrixType states(dimension, numberOfStates);
+            long column = 0;
+            for (const auto &chunk: getChunks()) {
+                states.middleCols(column, chunk.cols()) = chunk;
+                column += chunk.cols();
+            }
+            return states;
+        }
+
+        /**
+         * @return copy of all states as vectors, as stored by the StateRecorder.
+         */
+        [[nodiscard]] std::vector<VectorType> toVectors() const {
+            std::vector<VectorType> states;
+            states.reserve(numberOfStates);
+            for (const auto &chunk: getChunks()) {
+                for (long i = 0; i < chunk.cols(); ++i) {
+                    states.emplace_back(chunk.col(i));
+                }
+            }
+            return states;
+        }
+
+    private:
+        long dimension;
+        long chunkSize;
+        std::vector<MatrixType> chunks;
+        std::vector<long> chunkSizes;
+        long currentChunk = 0;
+        long numberOfStates = 0;
+    };
+}
+
+#endif //HOPS_STATEARENA_HPP
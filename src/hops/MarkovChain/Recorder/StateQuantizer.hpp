@@ -0,0 +1,114 @@
+#ifndef HOPS_STATEQUANTIZER_HPP
+#define HOPS_STATEQUANTIZER_HPP
+
+#include <algorithm>
+#include <Eigen/Core>
+#include <Eigen/Sparse>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "hops/Utility/VectorType.hpp"
+
+namespace hops {
+    /**
+     * @brief Maps states linearly from per-dimension bounds [lower, upper] to 16 bit integers.
+     * @details The quantization error of every dimension is at most (upper - lower) / 131070. States outside of the
+     * bounds are clamped to the bounds.
+     */
+    class StateQuantizer {
+    public:
+        using QuantizedVectorType = Eigen::Matrix<std::uint16_t, Eigen::Dynamic, 1>;
+
+        static constexpr double MAXIMUM_LEVEL = std::numeric_limits<std::uint16_t>::max();
+
+        StateQuantizer() = default;
+
+        StateQuantizer(VectorType lowerBounds, VectorType upperBounds) :
+                lowerBounds(std::move(lowerBounds)),
+                upperBounds(std::move(upperBounds)) {
+            if (this->lowerBounds.rows() != this->upperBounds.rows()) {
+                throw std::invalid_argument("Lower and upper bounds have different dimensions.");
+            }
+            if (!this->lowerBounds.allFinite() || !this->upperBounds.allFinite() ||
+                (this->upperBounds.array() < this->lowerBounds.array()).any()) {
+                throw std::invalid_argument("Quantization requires finite bounds with lower <= upper.");
+            }
+        }
+
+        /**
+         * @brief Uses the bounds of the polytope Ax <= b, which are given by rows of A with a single non-zero.
+         * @throws std::invalid_argument if the polytope is not bounded this way in every dimension, pass the bounds
+         * explicitly then, e.g. from the bounding box of the polytope.
+         */
+        template<typename MatrixType>
+        static StateQuantizer fromPolytope(const MatrixType &A, const VectorType &b) {
+            Eigen::SparseMatrix<double, Eigen::RowMajor> rows;
+            if constexpr(std::is_base_of_v<Eigen::SparseMatrixBase<MatrixType>, MatrixType>) {
+                rows = A;
+            } else {
+                rows = A.sparseView();
+            }
+            VectorType lowerBounds = VectorType::Constant(A.cols(), -std::numeric_limits<double>::infinity());
+            VectorType upperBounds = VectorType::Constant(A.cols(), std::numeric_limits<double>::infinity());
+            for (long row = 0; row < rows.outerSize(); ++row) {
+                Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator it(rows, row);
+                if (!it || rows.row(row).nonZeros() != 1) {
+                    continue;
+                }
+                double bound = b(row) / it.value();
+                if (it.value() > 0) {
+                    upperBounds(it.col()) = std::min(upperBounds(it.col()), bound);
+                } else {
+                    lowerBounds(it.col()) = std::max(lowerBounds(it.col()), bound);
+                }
+            }
+            for (long i = 0; i < A.cols(); ++i) {
+                if (!std::isfinite(lowerBounds(i)) || !std::isfinite(upperBounds(i))) {
+                    throw std::invalid_argument("Polytope has no bounds in dimension " + std::to_string(i) +
+                                                ", which are required for quantization.");
+                }
+            }
+            return StateQuantizer(lowerBounds, upperBounds);
+        }
+
+        [[nodiscard]] QuantizedVectorType quantize(const VectorType &state) const {
+            if (state.rows() != lowerBounds.rows()) {
+                throw std::invalid_argument("State does not match the dimension of the quantization bounds.");
+            }
+            QuantizedVectorType quantizedState(state.rows());
+            for (long i = 0; i < state.rows(); ++i) {
+                double width = upperBounds(i) - lowerBounds(i);
+                double level = width > 0 ? std::round((state(i) - lowerBounds(i)) / width * MAXIMUM_LEVEL) : 0;
+                quantizedState(i) = static_cast<std::uint16_t>(std::clamp(level, 0., MAXIMUM_LEVEL));
+            }
+            return quantizedState;
+        }
+
+        [[nodiscard]] VectorType dequantize(const QuantizedVectorType &quantizedState) const {
+            return lowerBounds.array() +
+                   quantizedState.cast<double>().array() * (upperBounds - lowerBounds).array() / MAXIMUM_LEVEL;
+        }
+
+        [[nodiscard]] long getDimension() const {
+            return lowerBounds.rows();
+        }
+
+        [[nodiscard]] const VectorType &getLowerBounds() const {
+            return lowerBounds;
+        }
+
+        [[nodiscard]] const VectorType &getUpperBounds() const {
+            return upperBounds;
+        }
+
+    private:
+        VectorType lowerBounds;
+        VectorType upperBounds;
+    };
+}
+
+#endif //HOPS_STATEQUANTIZER_HPP
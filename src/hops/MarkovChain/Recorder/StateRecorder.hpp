@@ -2,12 +2,15 @@
 #define HOPS_STATERECORDER_HPP
 
 #include <memory>
+#include <stdexcept>
 #include <vector>
 
 #include "hops/FileWriter/FileWriter.hpp"
 #include "hops/MarkovChain/Recorder/IsClearRecordsAvailable.hpp"
 #include "hops/MarkovChain/Recorder/IsStoreRecordAvailable.hpp"
 #include "hops/MarkovChain/Recorder/IsWriteRecordsToFileAvailable.hpp"
+#include "hops/MarkovChain/Recorder/StateQuantizer.hpp"
+#include "hops/MarkovChain/Recorder/StoragePrecision.hpp"
 #include "hops/Utility/VectorType.hpp"
 
 namespace hops {
@@ -16,25 +19,107 @@ namespace hops {
     public:
         explicit StateRecorder(const MarkovChainImpl &markovChainImpl) : MarkovChainImpl(markovChainImpl) {
             records = std::make_shared<std::vector<VectorType>>();
+            floatRecords = std::make_shared<std::vector<Eigen::VectorXf>>();
+            quantizedRecords = std::make_shared<std::vector<StateQuantizer::QuantizedVectorType>>();
         }
 
+        /**
+         * @param storagePrecision precision of the stored states. Only the records of this precision are filled.
+         * @param stateQuantizer bounds for StoragePrecision::QUANTIZED_16, e.g. StateQuantizer::fromPolytope(A, b).
+         */
+        StateRecorder(const MarkovChainImpl &markovChainImpl,
+                      StoragePrecision storagePrecision,
+                      StateQuantizer stateQuantizer = StateQuantizer()) : StateRecorder(markovChainImpl) {
+            this->storagePrecision = storagePrecision;
+            this->stateQuantizer = std::move(stateQuantizer);
+            if (storagePrecision == StoragePrecision::QUANTIZED_16 &&
+                this->stateQuantizer.getDimension() != MarkovChainImpl::getState().rows()) {
+                throw std::invalid_argument("Quantized storage requires bounds for every dimension of the state.");
+            }
+        }
+
+        /**
+         * @details Quantized states are written together with their bounds as "states_lower_bounds" and
+         * "states_upper_bounds", so they can be dequantized.
+         */
         void writeRecordsToFile(const FileWriter *const fileWriter) const {
-            fileWriter->write("states", *records);
+            switch (storagePrecision) {
+                case StoragePrecision::DOUBLE:
+                    fileWriter->write("states", *records);
+                    break;
+                case StoragePrecision::FLOAT:
+                    fileWriter->write("states", *floatRecords);
+                    break;
+                case StoragePrecision::QUANTIZED_16:
+                    fileWriter->write("states", *quantizedRecords);
+                    if (!hasWrittenQuantizationBounds) {
+                        fileWriter->write("states_lower_bounds", stateQuantizer.getLowerBounds());
+                        fileWriter->write("states_upper_bounds", stateQuantizer.getUpperBounds());
+                        hasWrittenQuantizationBounds = true;
+                    }
+                    break;
+            }
             if constexpr(IsWriteRecordsToFileAvailable<MarkovChainImpl>::value) {
                 MarkovChainImpl::writeRecordsToFile(fileWriter);
             }
         }
 
+        /**
+         * @return states stored with StoragePrecision::DOUBLE.
+         */
         [[nodiscard]] const std::vector<VectorType>& getStateRecords() const {
             return *records;
         }
 
+        /**
+         * @return states stored with StoragePrecision::FLOAT.
+         */
+        [[nodiscard]] const std::vector<Eigen::VectorXf> &getFloatStateRecords() const {
+            return *floatRecords;
+        }
+
+        /**
+         * @return states stored with StoragePrecision::QUANTIZED_16, use getStateQuantizer().dequantize to restore
+         * them.
+         */
+        [[nodiscard]] const std::vector<StateQuantizer::QuantizedVectorType> &getQuantizedStateRecords() const {
+            return *quantizedRecords;
+        }
+
+        [[nodiscard]] StoragePrecision getStoragePrecision() const {
+            return storagePrecision;
+        }
+
+        [[nodiscard]] const StateQuantizer &getStateQuantizer() const {
+            return stateQuantizer;
+        }
+
         void reserveStateRecords(long numberOfSamples) {
-            records->reserve(numberOfSamples);
+            switch (storagePrecision) {
+                case StoragePrecision::DOUBLE:
+                    records->reserve(numberOfSamples);
+                    break;
+                case StoragePrecision::FLOAT:
+                    floatRecords->reserve(numberOfSamples);
+                    break;
+                case StoragePrecision::QUANTIZED_16:
+                    quantizedRecords->reserve(numberOfSamples);
+                    break;
+            }
         }
 
         void storeRecord() {
-            records->emplace_back(MarkovChainImpl::getState());
+            switch (storagePrecision) {
+                case StoragePrecision::DOUBLE:
+                    records->emplace_back(MarkovChainImpl::getState());
+                    break;
+                case StoragePrecision::FLOAT:
+                    floatRecords->emplace_back(MarkovChainImpl::getState().template cast<float>());
+                    break;
+                case StoragePrecision::QUANTIZED_16:
+                    quantizedRecords->emplace_back(stateQuantizer.quantize(MarkovChainImpl::getState()));
+                    break;
+            }
             if constexpr(IsStoreRecordAvailable<MarkovChainImpl>::value) {
                 MarkovChainImpl::storeRecord();
             }
@@ -42,6 +127,8 @@ namespace hops {
 
         void clearRecords() {
             records->clear();
+            floatRecords->clear();
+            quantizedRecords->clear();
             if constexpr(IsClearRecordsAvailable<MarkovChainImpl>::value) {
                 MarkovChainImpl::clearRecords();
             }
@@ -49,6 +136,11 @@ namespace hops {
 
     private:
         std::shared_ptr<std::vector<VectorType>> records;
+        std::shared_ptr<std::vector<Eigen::VectorXf>> floatRecords;
+        std::shared_ptr<std::vector<StateQuantizer::QuantizedVectorType>> quantizedRecords;
+        StoragePrecision storagePrecision = StoragePrecision::DOUBLE;
+        StateQuantizer stateQuantizer;
+        mutable bool hasWrittenQuantizationBounds = false;
     };
 
 }
@@ -0,0 +1,22 @@
+#ifndef HOPS_STORAGEPRECISION_HPP
+#define HOPS_STORAGEPRECISION_HPP
+
+namespace hops {
+    /**
+     * @brief Precision, in which recorders store and write states. The Markov chain itself always uses doubles.
+     */
+    enum class StoragePrecision {
+        DOUBLE,
+        /**
+         * @brief 32 bit floats, which halve memory and disk usage.
+         */
+        FLOAT,
+        /**
+         * @brief 16 bit integers relative to per-dimension bounds, see StateQuantizer, which quarter memory and disk
+         * usage.
+         */
+        QUANTIZED_16,
+    };
+}
+
+#endif //HOPS_STORAGEPRECISION_HPP
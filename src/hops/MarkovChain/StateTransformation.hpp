@@ -26,26 +26,38 @@ namespace hops {
             return transformation.apply(proposalImpl.getState());
         }
 
+        void copyStateTo(Eigen::Ref<VectorType> destination) const override {
+            if (untransformedStorage.rows() == 0) {
+                untransformedStorage = proposalImpl.getState();
+            } else {
+                proposalImpl.copyStateTo(untransformedStorage);
+            }
+            transformation.applyTo(untransformedStorage, destination);
+        }
+
         [[nodiscard]] VectorType getProposal() const override {
             return transformation.apply(proposalImpl.getProposal());
         }
 
+        void copyProposalTo(Eigen::Ref<VectorType> destination) const override {
+            if (untransformedStorage.rows() == 0) {
+                untransformedStorage = proposalImpl.getProposal();
+            } else {
+                proposalImpl.copyProposalTo(untransformedStorage);
+            }
+            transformation.applyTo(untransformedStorage, destination);
+        }
+
         VectorType &propose(RandomNumberGenerator &rng) override {
-            stateStorage = proposalImpl.propose(rng);
-            stateStorage = transformation.apply(stateStorage);
-            return stateStorage;
+            return transformIntoStateStorage(proposalImpl.propose(rng));
         }
 
         VectorType &propose(RandomNumberGenerator &rng, const Eigen::VectorXd &activeSubspaces) override {
-            stateStorage = proposalImpl.propose(rng, activeSubspaces);
-            stateStorage = transformation.apply(stateStorage);
-            return stateStorage;
+            return transformIntoStateStorage(proposalImpl.propose(rng, activeSubspaces));
         }
 
         VectorType &acceptProposal() override {
-            stateStorage = proposalImpl.acceptProposal();
-            stateStorage = transformation.apply(stateStorage);
-            return stateStorage;
+            return transformIntoStateStorage(proposalImpl.acceptProposal());
         }
 
         void setState(const VectorType &state) override {
@@ -124,10 +136,28 @@ namespace hops {
             return proposalImpl.resetDistributions();
         }
 
+        void serialize(std::ostream &out) const override {
+            proposalImpl.serialize(out);
+        }
+
+        void deserialize(std::istream &in) override {
+            proposalImpl.deserialize(in);
+        }
+
     private:
+        VectorType &transformIntoStateStorage(const VectorType &untransformed) {
+            if (stateStorage.rows() == 0) {
+                stateStorage = transformation.apply(untransformed);
+            } else {
+                transformation.applyTo(untransformed, stateStorage);
+            }
+            return stateStorage;
+        }
+
         ProposalImpl proposalImpl;
         TransformationImpl transformation;
         VectorType stateStorage; // used for cases where non-const lvalues could otherwise not bind.
+        mutable VectorType untransformedStorage; // workspace for copyStateTo and copyProposalTo
     };
 }
 
@@ -31,8 +31,23 @@ hops::Gaussian::computeNegativeLogLikelihood(const hops::VectorType &x) {
         throw std::runtime_error("Dimension mismatch between input x (dim=" +
                                  std::to_string(x.size()) + ") and Gaussian (dim=" +
                                  std::to_string(mean.size()) + ").");
+    // Evaluated into members, such that repeated evaluations do not allocate.
+    difference = x - mean;
+    weightedDifference.noalias() = difference.transpose() * inverseCovariance;
     return -logNormalizationConstant +
-           0.5 * static_cast<typename MatrixType::Scalar>((x - mean).transpose() * inverseCovariance * (x - mean));
+           0.5 * static_cast<typename MatrixType::Scalar>(weightedDifference * difference);
+}
+
+void hops::Gaussian::computeNegativeLogLikelihoods(const Eigen::Ref<const hops::MatrixType> &states,
+                                                   Eigen::Ref<hops::VectorType> negativeLogLikelihoods) {
+    if (states.rows() != mean.size())
+        throw std::runtime_error("Dimension mismatch between input states (dim=" +
+                                 std::to_string(states.rows()) + ") and Gaussian (dim=" +
+                                 std::to_string(mean.size()) + ").");
+    differences = states.colwise() - mean;
+    weightedDifferences.noalias() = inverseCovariance * differences;
+    negativeLogLikelihoods = 0.5 * differences.cwiseProduct(weightedDifferences).colwise().sum().transpose();
+    negativeLogLikelihoods.array() -= logNormalizationConstant;
 }
 
 std::optional<hops::VectorType> hops::Gaussian::computeLogLikelihoodGradient(const hops::VectorType &x) {
@@ -43,6 +58,16 @@ std::optional<hops::VectorType> hops::Gaussian::computeLogLikelihoodGradient(con
     return -inverseCovariance * (x - mean);
 }
 
+bool hops::Gaussian::computeLogLikelihoodGradientInto(const hops::VectorType &x, Eigen::Ref<hops::VectorType> gradient) {
+    if (x.size() != mean.size())
+        throw std::runtime_error("Dimension mismatch between input x (dim=" +
+                                 std::to_string(x.size()) + ") and Gaussian (dim=" +
+                                 std::to_string(mean.size()) + ").");
+    difference = x - mean;
+    gradient.noalias() = -inverseCovariance * difference;
+    return true;
+}
+
 std::optional<hops::MatrixType> hops::Gaussian::computeExpectedFisherInformation(const hops::VectorType &) {
     return inverseCovariance;
 }
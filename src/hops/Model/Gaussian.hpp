@@ -23,8 +23,16 @@ namespace hops {
          */
         [[nodiscard]] MatrixType::Scalar computeNegativeLogLikelihood(const VectorType &x) override;
 
+        /**
+         * @brief Evaluates the quadratic forms of all columns with a single matrix-matrix product.
+         */
+        void computeNegativeLogLikelihoods(const Eigen::Ref<const MatrixType> &states,
+                                           Eigen::Ref<VectorType> negativeLogLikelihoods) override;
+
         [[nodiscard]] std::optional<VectorType> computeLogLikelihoodGradient(const VectorType &x) override;
 
+        bool computeLogLikelihoodGradientInto(const VectorType &x, Eigen::Ref<VectorType> gradient) override;
+
         [[nodiscard]] std::optional<MatrixType> computeExpectedFisherInformation(const VectorType &) override;
 
         bool hasConstantExpectedFisherInformation() override;
@@ -45,6 +53,10 @@ namespace hops {
         MatrixType covarianceLowerCholesky;
         MatrixType inverseCovariance;
         typename MatrixType::Scalar logNormalizationConstant;
+        VectorType difference;
+        Eigen::Matrix<typename MatrixType::Scalar, 1, Eigen::Dynamic> weightedDifference;
+        MatrixType differences;
+        MatrixType weightedDifferences;
     };
 }
 
@@ -0,0 +1,85 @@
+#ifndef HOPS_GAUSSIANPROCESSSURROGATE_HPP
+#define HOPS_GAUSSIANPROCESSSURROGATE_HPP
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "hops/Model/Model.hpp"
+#include "hops/Optimization/GaussianProcess.hpp"
+#include "hops/Optimization/Kernel/SquaredExponentialKernel.hpp"
+
+namespace hops {
+    /**
+     * @brief Cheap approximation of an expensive model by the posterior mean of a Gaussian process, which is fitted
+     * online to evaluations of the expensive model.
+     * @details The prior mean of the Gaussian process is the first observed negative log-likelihood. Once
+     * maxNumberOfObservations observations are stored, further observations are ignored and the surrogate stays
+     * fixed. Without observations the surrogate is constant.
+     */
+    class GaussianProcessSurrogate : public Model {
+    public:
+        using KernelType = SquaredExponentialKernel<MatrixType, VectorType>;
+
+        /**
+         * @param sigma prior standard deviation of the negative log-likelihood around the prior mean.
+         * @param length length scale of the squared exponential kernel in the units of the parameters.
+         * @param maxNumberOfObservations
+         * @param observationNoise variance added to the diagonal of the observed covariance for numerical stability.
+         */
+        explicit GaussianProcessSurrogate(double sigma = 1,
+                                          double length = 1,
+                                          long maxNumberOfObservations = 100,
+                                          double observationNoise = 1e-6) :
+                kernel(sigma, length),
+                maxNumberOfObservations(maxNumberOfObservations),
+                observationNoise(observationNoise) {}
+
+        [[nodiscard]] MatrixType::Scalar computeNegativeLogLikelihood(const VectorType &x) override {
+            if (!gaussianProcess) {
+                return 0;
+            }
+            gaussianProcess->computePosterior(x.transpose());
+            return gaussianProcess->getPosteriorMean()(0);
+        }
+
+        void addObservation(const VectorType &x, double negativeLogLikelihood) {
+            if (isFull()) {
+                return;
+            }
+            if (!gaussianProcess) {
+                gaussianProcess.emplace(kernel, negativeLogLikelihood);
+            }
+            gaussianProcess->addObservations(x.transpose(),
+                                             VectorType::Constant(1, negativeLogLikelihood),
+                                             VectorType::Constant(1, observationNoise));
+            numberOfObservations++;
+        }
+
+        [[nodiscard]] long getNumberOfObservations() const {
+            return numberOfObservations;
+        }
+
+        [[nodiscard]] bool isFull() const {
+            return numberOfObservations >= maxNumberOfObservations;
+        }
+
+        [[nodiscard]] std::vector<std::string> getDimensionNames() const override {
+            return {};
+        }
+
+        [[nodiscard]] std::unique_ptr<Model> copyModel() const override {
+            return std::make_unique<GaussianProcessSurrogate>(*this);
+        }
+
+    private:
+        KernelType kernel;
+        long maxNumberOfObservations;
+        double observationNoise;
+        long numberOfObservations = 0;
+        std::optional<GaussianProcess<MatrixType, VectorType, KernelType>> gaussianProcess;
+    };
+}
+
+#endif //HOPS_GAUSSIANPROCESSSURROGATE_HPP
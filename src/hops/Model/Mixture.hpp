@@ -51,6 +51,28 @@ namespace hops {
             return *minNegLogLikeIt - std::log(likelihoodMinusMax);
         }
 
+        /**
+         * @brief Evaluates every component for all columns at once and combines them with the logsumexp trick.
+         * @param states one evaluation point per column
+         * @param negativeLogLikelihoods
+         */
+        void computeNegativeLogLikelihoods(const Eigen::Ref<const MatrixType> &states,
+                                           Eigen::Ref<VectorType> negativeLogLikelihoods) override {
+            componentNegativeLogLikelihoods.resize(states.cols(), static_cast<long>(components.size()));
+            for (size_t i = 0; i < components.size(); ++i) {
+                components[i]->computeNegativeLogLikelihoods(states, componentNegativeLogLikelihoods.col(i));
+            }
+
+            for (long j = 0; j < states.cols(); ++j) {
+                double minNegLogLike = componentNegativeLogLikelihoods.row(j).minCoeff();
+                double likelihoodMinusMax = 0;
+                for (size_t i = 0; i < components.size(); ++i) {
+                    likelihoodMinusMax += weights[i] * std::exp(minNegLogLike - componentNegativeLogLikelihoods(j, i));
+                }
+                negativeLogLikelihoods(j) = minNegLogLike - std::log(likelihoodMinusMax);
+            }
+        }
+
         /**
          * @brief Implementation by using the logsumexp trick and the chain rule.
          * @param x
@@ -119,12 +141,18 @@ namespace hops {
         }
 
         [[nodiscard]] std::unique_ptr<Model> copyModel() const override {
-            return std::make_unique<Mixture>(components, weights);
+            // Components are copied as well, because models may keep workspaces and copies can run in parallel.
+            std::vector<std::shared_ptr<Model>> copiedComponents;
+            for (const auto &component: components) {
+                copiedComponents.emplace_back(component->copyModel());
+            }
+            return std::make_unique<Mixture>(copiedComponents, weights);
         }
 
     private:
         std::vector<std::shared_ptr<Model>> components;
         std::vector<double> weights;
+        MatrixType componentNegativeLogLikelihoods;
     };
 }
 
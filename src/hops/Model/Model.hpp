@@ -21,10 +21,41 @@ namespace hops {
          */
         [[nodiscard]] virtual typename MatrixType::Scalar computeNegativeLogLikelihood(const VectorType &x) = 0;
 
+        /**
+         * @brief Evaluates the negative log likelihoods for every column of states.
+         * @details The default implementation evaluates the columns one at a time. Models can override it to evaluate
+         * all columns at once, e.g. with matrix-matrix products instead of one matrix-vector product per column.
+         * @param states one input per column
+         * @param negativeLogLikelihoods has to have one entry per column of states.
+         */
+        virtual void computeNegativeLogLikelihoods(const Eigen::Ref<const MatrixType> &states,
+                                                   Eigen::Ref<VectorType> negativeLogLikelihoods) {
+            VectorType x(states.rows());
+            for (long i = 0; i < states.cols(); ++i) {
+                x = states.col(i);
+                negativeLogLikelihoods(i) = computeNegativeLogLikelihood(x);
+            }
+        }
+
         [[nodiscard]] virtual std::optional<VectorType> computeLogLikelihoodGradient(const VectorType &) {
             return std::nullopt;
         };
 
+        /**
+         * @brief Writes the log likelihood gradient at x into gradient, which has to have the dimension of x.
+         * @details The default implementation copies computeLogLikelihoodGradient(x). Models can override it to avoid
+         * allocating the returned vector in every call.
+         * @return false if the model provides no gradient, in which case gradient is left unchanged.
+         */
+        virtual bool computeLogLikelihoodGradientInto(const VectorType &x, Eigen::Ref<VectorType> gradient) {
+            std::optional<VectorType> result = computeLogLikelihoodGradient(x);
+            if (result) {
+                gradient = result.value();
+                return true;
+            }
+            return false;
+        }
+
         [[nodiscard]] virtual std::optional<MatrixType> computeExpectedFisherInformation(const VectorType &) {
             return std::nullopt;
         }
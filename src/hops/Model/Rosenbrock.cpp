@@ -24,6 +24,23 @@ hops::Rosenbrock::computeNegativeLogLikelihood(const VectorType &x) {
     return result;
 }
 
+void hops::Rosenbrock::computeNegativeLogLikelihoods(const Eigen::Ref<const MatrixType> &states,
+                                                     Eigen::Ref<VectorType> negativeLogLikelihoods) {
+    if (states.rows() != numberOfDimensions)
+        throw std::runtime_error("Dimension mismatch between input states (dim=" +
+                                 std::to_string(states.rows()) + ") and Rosenbrock (dim=" +
+                                 std::to_string(numberOfDimensions) + ").");
+
+    negativeLogLikelihoods.setZero();
+    for (long i = 0; i < shiftParameter.rows(); ++i) {
+        auto first = states.row(2 * i).array();
+        auto second = states.row(2 * i + 1).array();
+        negativeLogLikelihoods.array() += scaleParameter *
+                                          (100 * (first.square() - second).square() +
+                                           (first - shiftParameter(i)).square()).transpose();
+    }
+}
+
 hops::MatrixType hops::Rosenbrock::computeHessian(const VectorType &x) {
     if (x.size() != numberOfDimensions)
         throw std::runtime_error("Dimension mismatch between input x (dim=" +
@@ -30,6 +30,12 @@ namespace hops {
 
         [[nodiscard]] typename MatrixType::Scalar computeNegativeLogLikelihood(const VectorType &x) override;
 
+        /**
+         * @brief Evaluates all columns at once with coefficient-wise operations on the rows of states.
+         */
+        void computeNegativeLogLikelihoods(const Eigen::Ref<const MatrixType> &states,
+                                           Eigen::Ref<VectorType> negativeLogLikelihoods) override;
+
         [[nodiscard]] MatrixType computeHessian(const VectorType &x);
 
         [[nodiscard]] std::optional<VectorType> computeLogLikelihoodGradient(const VectorType &x) override;
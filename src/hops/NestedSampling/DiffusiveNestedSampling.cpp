@@ -1,2 +1,288 @@
 #include "DiffusiveNestedSampling.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+
+namespace {
+    /**
+     * @brief Heavy tailed step size distribution from DNest4, which allows for both small and large moves.
+     */
+    double drawHeavyTailedStep(hops::RandomNumberGenerator &rng) {
+        std::normal_distribution<double> normal;
+        return std::pow(10., 1.5 - 3. * std::abs(normal(rng))) * normal(rng);
+    }
+
+    double wrap(double value) {
+        return value - std::floor(value);
+    }
+}
+
+hops::DiffusiveNestedSampling::DiffusiveNestedSampling(std::vector<std::unique_ptr<Proposal>> particles,
+                                                       std::vector<std::unique_ptr<Model>> models,
+                                                       DiffusiveNestedSamplingOptions options) :
+        particles(std::move(particles)),
+        models(std::move(models)),
+        options(options) {
+    if (this->particles.empty()) {
+        throw std::invalid_argument("DiffusiveNestedSampling requires at least one particle.");
+    }
+    if (this->models.size() != 1 && this->models.size() != this->particles.size()) {
+        throw std::invalid_argument("DiffusiveNestedSampling requires either one model or one model per particle.");
+    }
+    if (this->options.compression <= 1) {
+        throw std::invalid_argument("Compression has to be larger than 1.");
+    }
+    while (this->models.size() < this->particles.size()) {
+        this->models.emplace_back(this->models.front()->copyModel());
+    }
+
+    size_t numberOfParticles = this->particles.size();
+    for (size_t i = 0; i < numberOfParticles; ++i) {
+        double tiebreaker = (static_cast<double>(i) + 0.5) / static_cast<double>(numberOfParticles);
+        likelihoods.emplace_back(-this->models[i]->computeNegativeLogLikelihood(this->particles[i]->getState()),
+                                 tiebreaker);
+    }
+    levelAssignments = std::vector<size_t>(numberOfParticles, 0);
+    above = std::vector<std::vector<LogLikelihoodValue>>(numberOfParticles);
+    level_copies = std::vector<std::vector<Level>>(numberOfParticles);
+    levels.emplace_back(LogLikelihoodValue());
+
+    threadPool = std::make_unique<ThreadPool>(static_cast<long>(this->options.num_threads));
+}
+
+std::vector<std::string> hops::DiffusiveNestedSampling::getDimensionNames() {
+    std::vector<std::string> names = particles.front()->getDimensionNames();
+    names.emplace_back("level_assignment");
+    names.emplace_back("log_likelihood");
+    names.emplace_back("tiebreaker");
+    names.emplace_back("particle_id");
+    return names;
+}
+
+hops::VectorType hops::DiffusiveNestedSampling::saveRandomParticle(RandomNumberGenerator &rng) {
+    std::uniform_int_distribution<size_t> particleDistribution(0, particles.size() - 1);
+    return saveParticle(particleDistribution(rng));
+}
+
+hops::VectorType hops::DiffusiveNestedSampling::saveParticle(size_t particleIndex) {
+    VectorType state = particles[particleIndex]->getState();
+    VectorType particle(state.rows() + 4);
+    particle << state,
+            static_cast<double>(levelAssignments[particleIndex]),
+            likelihoods[particleIndex].getValue(),
+            likelihoods[particleIndex].getTiebreaker(),
+            static_cast<double>(particleIndex);
+    return particle;
+}
+
+std::vector<hops::Level> hops::DiffusiveNestedSampling::getLevels() {
+    return levels;
+}
+
+void hops::DiffusiveNestedSampling::updateParticles(RandomNumberGenerator &rng) {
+    size_t numberOfParticles = particles.size();
+    if (particleRandomNumberGenerators.empty()) {
+        RandomNumberGenerator::result_type seed = rng();
+        for (size_t i = 0; i < numberOfParticles; ++i) {
+            particleRandomNumberGenerators.emplace_back(seed, i);
+        }
+    }
+
+    for (size_t i = 0; i < numberOfParticles; ++i) {
+        level_copies[i].clear();
+        for (const auto &level: levels) {
+            level_copies[i].emplace_back(level.getLikelihood());
+        }
+        above[i].clear();
+    }
+
+    threadPool->parallelFor(static_cast<long>(numberOfParticles), [&](long i) {
+        for (unsigned int step = 0; step < options.thread_steps; ++step) {
+            updateParticle(i, particleRandomNumberGenerators[i]);
+        }
+    });
+    count_mcmc_steps += static_cast<unsigned long long>(numberOfParticles) * options.thread_steps;
+
+    // Merging in particle order keeps the results independent of the scheduling of the threads.
+    for (size_t i = 0; i < numberOfParticles; ++i) {
+        for (size_t j = 0; j < levels.size(); ++j) {
+            levels[j].incrementAccepts(level_copies[i][j].getAccepts());
+            levels[j].incrementTries(level_copies[i][j].getTries());
+            levels[j].incrementExceeds(level_copies[i][j].getExceeds());
+            levels[j].incrementVisits(level_copies[i][j].getVisits());
+        }
+        all_above.insert(all_above.end(), above[i].begin(), above[i].end());
+    }
+
+    if (!hasFinishedLevelConstruction() && all_above.size() >= options.new_level_interval) {
+        createLevel();
+        recalculateLogX();
+        killLaggingParticles(rng);
+    } else {
+        recalculateLogX();
+    }
+
+    if (hasFinishedLevelConstruction()) {
+        all_above.clear();
+        renormalizeVisits();
+    }
+}
+
+void hops::DiffusiveNestedSampling::updateParticle(size_t particleIndex, RandomNumberGenerator &rng) {
+    std::uniform_real_distribution<double> uniform;
+    Proposal &particle = *particles[particleIndex];
+    const Level &level = levels[levelAssignments[particleIndex]];
+    Level &levelCopy = level_copies[particleIndex][levelAssignments[particleIndex]];
+
+    const VectorType &proposal = particle.propose(rng);
+    double logAcceptanceProbability = std::min(0., particle.computeLogAcceptanceProbability());
+    if (std::log(uniform(rng)) <= logAcceptanceProbability) {
+        LogLikelihoodValue proposalLikelihood(-models[particleIndex]->computeNegativeLogLikelihood(proposal),
+                                              wrap(likelihoods[particleIndex].getTiebreaker() +
+                                                   drawHeavyTailedStep(rng)));
+        if (level.getLikelihood() < proposalLikelihood) {
+            particle.acceptProposal();
+            likelihoods[particleIndex] = proposalLikelihood;
+            levelCopy.incrementAccepts(1);
+        }
+    }
+    levelCopy.incrementTries(1);
+
+    updateLevelAssigment(particleIndex, rng);
+
+    for (size_t j = levelAssignments[particleIndex]; j + 1 < levels.size(); ++j) {
+        level_copies[particleIndex][j].incrementVisits(1);
+        if (levels[j + 1].getLikelihood() < likelihoods[particleIndex]) {
+            level_copies[particleIndex][j].incrementExceeds(1);
+        } else {
+            break;
+        }
+    }
+
+    if (!hasFinishedLevelConstruction() && levels.back().getLikelihood() < likelihoods[particleIndex]) {
+        above[particleIndex].emplace_back(likelihoods[particleIndex]);
+    }
+}
+
+void hops::DiffusiveNestedSampling::updateLevelAssigment(size_t particleIndex, RandomNumberGenerator &rng) {
+    std::uniform_real_distribution<double> uniform;
+    std::normal_distribution<double> normal;
+    long numberOfLevels = static_cast<long>(levels.size());
+    long current = static_cast<long>(levelAssignments[particleIndex]);
+
+    long proposed = current + static_cast<long>(std::round(std::pow(10., 2 * uniform(rng)) * normal(rng)));
+    if (proposed == current) {
+        proposed = uniform(rng) < 0.5 ? proposed - 1 : proposed + 1;
+    }
+    proposed = ((proposed % numberOfLevels) + numberOfLevels) % numberOfLevels;
+
+    double logA = levels[current].getLogX() - levels[proposed].getLogX();
+    logA += log_push(proposed) - log_push(current);
+    if (hasFinishedLevelConstruction()) {
+        logA += options.beta * std::log(static_cast<double>(levels[current].getTries() + 1) /
+                                        static_cast<double>(levels[proposed].getTries() + 1));
+    }
+
+    if (std::log(uniform(rng)) <= std::min(0., logA) &&
+        levels[proposed].getLikelihood() < likelihoods[particleIndex]) {
+        levelAssignments[particleIndex] = static_cast<size_t>(proposed);
+    }
+}
+
+void hops::DiffusiveNestedSampling::recalculateLogX() {
+    double regularisation = options.new_level_interval;
+    levels[0].setLogX(0);
+    for (size_t i = 1; i < levels.size(); ++i) {
+        levels[i].setLogX(levels[i - 1].getLogX() +
+                          std::log((levels[i - 1].getExceeds() + regularisation / options.compression) /
+                                   (levels[i - 1].getVisits() + regularisation)));
+    }
+}
+
+void hops::DiffusiveNestedSampling::renormalizeVisits() {
+    unsigned long long regularisation = options.new_level_interval;
+    for (auto &level: levels) {
+        if (level.getTries() >= regularisation) {
+            level.setAccepts(static_cast<unsigned long long>(
+                                     static_cast<double>(level.getAccepts() + 1) /
+                                     static_cast<double>(level.getTries() + 1) * regularisation));
+            level.setTries(regularisation);
+        }
+        if (level.getVisits() >= regularisation) {
+            level.setExceeds(static_cast<unsigned long long>(
+                                     static_cast<double>(level.getExceeds() + 1) /
+                                     static_cast<double>(level.getVisits() + 1) * regularisation));
+            level.setVisits(regularisation);
+        }
+    }
+}
+
+void hops::DiffusiveNestedSampling::killLaggingParticles(RandomNumberGenerator &rng) {
+    double maxLogPush = -std::numeric_limits<double>::infinity();
+    for (size_t levelAssignment: levelAssignments) {
+        maxLogPush = std::max(maxLogPush, log_push(levelAssignment));
+    }
+
+    std::vector<size_t> goodParticles;
+    std::vector<size_t> badParticles;
+    for (size_t i = 0; i < particles.size(); ++i) {
+        if (log_push(levelAssignments[i]) < maxLogPush - 5.) {
+            badParticles.emplace_back(i);
+        } else {
+            goodParticles.emplace_back(i);
+        }
+    }
+
+    std::uniform_int_distribution<size_t> goodParticleDistribution(0, goodParticles.size() - 1);
+    for (size_t bad: badParticles) {
+        size_t good = goodParticles[goodParticleDistribution(rng)];
+        particles[bad] = particles[good]->copyProposal();
+        models[bad] = models[good]->copyModel();
+        likelihoods[bad] = likelihoods[good];
+        levelAssignments[bad] = levelAssignments[good];
+    }
+}
+
+bool hops::DiffusiveNestedSampling::hasFinishedLevelConstruction() const {
+    if (options.adaptive) {
+        return isLevelSpacingSmallEnough();
+    }
+    return levels.size() >= options.max_num_levels;
+}
+
+bool hops::DiffusiveNestedSampling::isLevelSpacingSmallEnough() const {
+    if (levels.size() < 10) {
+        return false;
+    }
+    size_t numberOfLevelsToCheck = 20;
+    if (levels.size() > 80) {
+        numberOfLevelsToCheck = static_cast<size_t>(std::sqrt(20.) * std::sqrt(0.25 * levels.size()));
+    }
+    for (size_t k = levels.size() - 1; k >= 1 && levels.size() - 1 - k < numberOfLevelsToCheck; --k) {
+        if (levels[k].getLikelihood().getValue() - levels[k - 1].getLikelihood().getValue() >= 0.8) {
+            return false;
+        }
+    }
+    return true;
+}
+
+double hops::DiffusiveNestedSampling::log_push(unsigned int which_level) const {
+    if (hasFinishedLevelConstruction()) {
+        return 0;
+    }
+    return (static_cast<double>(which_level) - static_cast<double>(levels.size() - 1)) / options.lambda;
+}
+
+unsigned long long hops::DiffusiveNestedSampling::getNumberOfMcmcSteps() const {
+    return count_mcmc_steps;
+}
+
+void hops::DiffusiveNestedSampling::createLevel() {
+    std::sort(all_above.begin(), all_above.end());
+    auto index = static_cast<size_t>((1. - 1. / options.compression) * static_cast<double>(all_above.size()));
+    levels.emplace_back(all_above[index]);
+    all_above.erase(all_above.begin(), all_above.begin() + static_cast<long>(index) + 1);
+}
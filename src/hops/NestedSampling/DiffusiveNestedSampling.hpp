@@ -1,11 +1,13 @@
 #ifndef HOPS_DIFFUSIVENESTEDSAMPLING_HPP
 #define HOPS_DIFFUSIVENESTEDSAMPLING_HPP
 
-#include <thread>
+#include <memory>
 #include <vector>
 
 #include "hops/MarkovChain/Proposal/Proposal.hpp"
 #include "hops/Model/Model.hpp"
+#include "hops/Parallel/ThreadPool.hpp"
+#include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
 
 #include "LogLikelihoodValue.hpp"
 #include "Level.hpp"
@@ -14,22 +16,29 @@ namespace hops {
 
 
     struct DiffusiveNestedSamplingOptions {
-        double compression;
+        double compression = 2.718281828459045;
         // Numerical options
-        unsigned int new_level_interval;
+        unsigned int new_level_interval = 10000;
 //        unsigned int save_interval; this is output thinning
-        unsigned int thread_steps;
-        unsigned int max_num_levels;
-        double lambda;
-        double beta;
+        unsigned int thread_steps = 100;
+        unsigned int max_num_levels = 100;
+        double lambda = 10;
+        double beta = 100;
 //        unsigned int max_num_saves;
 
 
-        bool adaptive;
+        bool adaptive = false;
+        // Total number of threads used for updating the particles, 0 selects the number of hardware threads.
+        unsigned int num_threads = 1;
     };
 
     /**
      * @brief Algorithm from https://arxiv.org/pdf/1606.03757.pdf
+     * @details Particles are proposals for the uniform distribution on the polytope, which keep their internal state
+     * (e.g. slacks) between steps. Every particle uses its own model copy and random number stream. During
+     * updateParticles the levels are read-only and every particle records its level statistics and likelihoods above
+     * the top level in its own buffers, which are merged afterwards in particle order. Level construction is thus
+     * lock-free and the results do not depend on the number of threads.
      */
     class DiffusiveNestedSampling {
     public:
@@ -44,11 +53,14 @@ namespace hops {
             // params +level assignment, log likelihood, tiebreaker, ID.
         };
 
-
+        /**
+         * @param particles proposals for the uniform distribution on the polytope, e.g. HitAndRunProposal.
+         * @param models either one model per particle or a single model, which is copied for every particle.
+         * @param options
+         */
         DiffusiveNestedSampling(std::vector<std::unique_ptr<Proposal>> particles,
                                 std::vector<std::unique_ptr<Model>> models,
-                                DiffusiveNestedSamplingOptions options) {
-        }
+                                DiffusiveNestedSamplingOptions options);
 
         std::vector<std::string> getDimensionNames(); // param names + level assigment + log like + tiebreaker + ID
 
@@ -58,77 +70,50 @@ namespace hops {
 
         std::vector<Level> getLevels();
 
+        /**
+         * @brief Performs thread_steps steps for every particle in parallel, merges the level statistics and creates a
+         * new level if enough likelihoods above the top level have been collected.
+         */
         void updateParticles(RandomNumberGenerator &rng);
 
-        void updateParticle(size_t particleIndex, RandomNumberGenerator &rngs);
+        void updateParticle(size_t particleIndex, RandomNumberGenerator &rng);
 
-        void updateLevelAssigment(size_t particleIndex);
+        void updateLevelAssigment(size_t particleIndex, RandomNumberGenerator &rng);
 
         void recalculateLogX();
 
         void renormalizeVisits();
 
-        void updateLevelAssigment(int which);
-
-        void killLaggingParticles();
+        void killLaggingParticles(RandomNumberGenerator &rng);
 
-        bool hasFinishedLevelConstruction();
+        bool hasFinishedLevelConstruction() const;
 
-        bool isLevelSpacingSmallEnough();
+        bool isLevelSpacingSmallEnough() const;
 
         double log_push(unsigned int which_level) const; // weighting function
 
-
-//        void Level::recalculate_log_X(vector<Level>& levels, double compression,
-//                                      unsigned int regularisation)
-//        {
-//            assert(levels.size() > 0);
-//
-//            levels[0].log_X = 0.0;
-//            for(size_t i=1; i<levels.size(); ++i)
-//                levels[i].log_X = levels[i-1].log_X + log((double)(levels[i-1].exceeds + (1./compression)*regularisation)/(double)(levels[i-1].visits + regularisation));
-//        }
-//
-//        void Level::renormalise_visits(vector<Level>& levels,
-//                                       unsigned int regularisation)
-//        {
-//            for(auto& level: levels)
-//            {
-//                if(level.tries >= regularisation)
-//                {
-//                    level.accepts = ((double)(level.accepts+1)/(double)(level.tries+1))*regularisation;
-//                    level.tries = regularisation;
-//                }
-//                if(level.visits >= regularisation)
-//                {
-//                    level.exceeds = ((double)(level.exceeds+1)/(double)(level.visits+1))*regularisation;
-//                    level.visits = regularisation;
-//                }
-//            }
-//        }
-//
+        [[nodiscard]] unsigned long long getNumberOfMcmcSteps() const;
 
     private:
+        void createLevel();
+
         std::vector<std::unique_ptr<Proposal>> particles;
         std::vector<std::unique_ptr<Model>> models;
         DiffusiveNestedSamplingOptions options;
 
-        double count_saves;
-        double count_mcmc_steps_since_save;
-        double count_mcmc_steps;
-
+        std::vector<LogLikelihoodValue> likelihoods;
+        std::vector<size_t> levelAssignments;
+        std::vector<RandomNumberGenerator> particleRandomNumberGenerators;
 
-        // used for adaptive part
-        double difficulty;
-        double work_ratio;
+        unsigned long long count_mcmc_steps = 0;
 
         std::vector<LogLikelihoodValue> all_above; // new_level_storage
         std::vector<std::vector<LogLikelihoodValue>> above; // storage for likelihoods above threshold
 
         std::vector<Level> levels;
-        std::vector<std::vector<Level>> level_copies;
-
+        std::vector<std::vector<Level>> level_copies; // per particle increments of the level statistics
 
+        std::unique_ptr<ThreadPool> threadPool;
     };
 }
 
@@ -0,0 +1,169 @@
+#include "StaticNestedSampling.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <utility>
+
+#include "hops/MarkovChain/Proposal/HitAndRunProposal.hpp"
+
+namespace {
+    double logAddExp(double a, double b) {
+        if (a == -std::numeric_limits<double>::infinity()) {
+            return b;
+        }
+        if (b == -std::numeric_limits<double>::infinity()) {
+            return a;
+        }
+        double max = std::max(a, b);
+        return max + std::log(std::exp(a - max) + std::exp(b - max));
+    }
+
+    long partitionBegin(long numberOfItems, long numberOfPartitions, long partition) {
+        return numberOfItems * partition / numberOfPartitions;
+    }
+}
+
+hops::StaticNestedSampling::StaticNestedSampling(const MatrixType &A,
+                                                 const VectorType &b,
+                                                 const VectorType &startingPoint,
+                                                 const Model &model,
+                                                 StaticNestedSamplingOptions options) :
+        options(options),
+        startingPoint(startingPoint) {
+    if (options.numberOfLivePoints <= 0) {
+        throw std::invalid_argument("Number of live points has to be positive.");
+    }
+    if (options.numberOfReplacementsPerIteration <= 0 ||
+        options.numberOfReplacementsPerIteration >= options.numberOfLivePoints) {
+        throw std::invalid_argument(
+                "Number of replacements per iteration has to be positive and smaller than the number of live points.");
+    }
+    if (options.numberOfSteps <= 0) {
+        throw std::invalid_argument("Number of steps has to be positive.");
+    }
+    if (((b - A * startingPoint).array() < 0).any()) {
+        throw std::runtime_error("Starting point outside polytope is always constant.");
+    }
+
+    for (long i = 0; i < options.numberOfReplacementsPerIteration; ++i) {
+        proposals.emplace_back(std::make_unique<HitAndRunProposal<MatrixType, VectorType>>(A, b, startingPoint));
+        models.emplace_back(model.copyModel());
+    }
+    threadPool = std::make_unique<ThreadPool>(options.numberOfThreads);
+}
+
+hops::StaticNestedSamplingResult hops::StaticNestedSampling::run(RandomNumberGenerator &randomNumberGenerator) {
+    long numberOfLivePoints = options.numberOfLivePoints;
+    long numberOfReplacements = options.numberOfReplacementsPerIteration;
+
+    std::vector<VectorType> livePoints(numberOfLivePoints);
+    std::vector<LogLikelihoodValue> liveLikelihoods(numberOfLivePoints);
+
+    RandomNumberGenerator::result_type seed = randomNumberGenerator();
+    threadPool->parallelFor(numberOfReplacements, [&](long worker) {
+        RandomNumberGenerator workerRandomNumberGenerator(seed, worker);
+        VectorType start = startingPoint;
+        LogLikelihoodValue startLikelihood(-models[worker]->computeNegativeLogLikelihood(start));
+        for (long i = partitionBegin(numberOfLivePoints, numberOfReplacements, worker);
+             i < partitionBegin(numberOfLivePoints, numberOfReplacements, worker + 1); ++i) {
+            liveLikelihoods[i] = drawConstrained(worker, start, startLikelihood, LogLikelihoodValue(),
+                                                 workerRandomNumberGenerator, livePoints[i]);
+            start = livePoints[i];
+            startLikelihood = liveLikelihoods[i];
+        }
+    });
+
+    StaticNestedSamplingResult result;
+    double logX = 0;
+    double logEvidence = -std::numeric_limits<double>::infinity();
+    std::vector<long> order(numberOfLivePoints);
+
+    while (result.numberOfIterations < options.maxNumberOfIterations) {
+        double maxLogLikelihood = std::max_element(liveLikelihoods.begin(), liveLikelihoods.end())->getValue();
+        if (maxLogLikelihood + logX < logEvidence + options.logEvidenceTolerance) {
+            break;
+        }
+
+        std::iota(order.begin(), order.end(), 0);
+        auto compare = [&](long i, long j) { return liveLikelihoods[i] < liveLikelihoods[j]; };
+        std::nth_element(order.begin(), order.begin() + numberOfReplacements - 1, order.end(), compare);
+        std::sort(order.begin(), order.begin() + numberOfReplacements, compare);
+
+        for (long j = 0; j < numberOfReplacements; ++j) {
+            long dead = order[j];
+            double nextLogX = logX - 1. / static_cast<double>(numberOfLivePoints - j);
+            double logWeight = liveLikelihoods[dead].getValue() + logX + std::log1p(-std::exp(nextLogX - logX));
+            logEvidence = logAddExp(logEvidence, logWeight);
+            result.samples.emplace_back(livePoints[dead]);
+            result.logLikelihoods.emplace_back(liveLikelihoods[dead].getValue());
+            result.logWeights.emplace_back(logWeight);
+            logX = nextLogX;
+        }
+
+        // All surviving live points lie above the threshold, so they are valid starting points for the replacements.
+        LogLikelihoodValue threshold = liveLikelihoods[order[numberOfReplacements - 1]];
+        seed = randomNumberGenerator();
+        threadPool->parallelFor(numberOfReplacements, [&](long worker) {
+            RandomNumberGenerator workerRandomNumberGenerator(seed, worker);
+            std::uniform_int_distribution<long> survivorDistribution(numberOfReplacements, numberOfLivePoints - 1);
+            long survivor = order[survivorDistribution(workerRandomNumberGenerator)];
+            liveLikelihoods[order[worker]] = drawConstrained(worker, livePoints[survivor], liveLikelihoods[survivor],
+                                                             threshold, workerRandomNumberGenerator,
+                                                             livePoints[order[worker]]);
+        });
+        result.numberOfIterations++;
+    }
+
+    for (long i = 0; i < numberOfLivePoints; ++i) {
+        double logWeight = liveLikelihoods[i].getValue() + logX - std::log(numberOfLivePoints);
+        logEvidence = logAddExp(logEvidence, logWeight);
+        result.samples.emplace_back(livePoints[i]);
+        result.logLikelihoods.emplace_back(liveLikelihoods[i].getValue());
+        result.logWeights.emplace_back(logWeight);
+    }
+
+    result.logEvidence = logEvidence;
+    result.information = -logEvidence;
+    for (size_t i = 0; i < result.logWeights.size(); ++i) {
+        result.logWeights[i] -= logEvidence;
+        result.information += std::exp(result.logWeights[i]) * result.logLikelihoods[i];
+    }
+    result.logEvidenceError = std::sqrt(std::max(result.information, 0.) / static_cast<double>(numberOfLivePoints));
+    return result;
+}
+
+const hops::StaticNestedSamplingOptions &hops::StaticNestedSampling::getOptions() const {
+    return options;
+}
+
+hops::LogLikelihoodValue hops::StaticNestedSampling::drawConstrained(long worker,
+                                                                     const VectorType &start,
+                                                                     const LogLikelihoodValue &startLikelihood,
+                                                                     const LogLikelihoodValue &threshold,
+                                                                     RandomNumberGenerator &randomNumberGenerator,
+                                                                     VectorType &sample) {
+    std::uniform_real_distribution<double> uniform;
+    Proposal &proposal = *proposals[worker];
+    Model &model = *models[worker];
+    proposal.setState(start);
+    LogLikelihoodValue likelihood = startLikelihood;
+
+    for (long step = 0; step < options.numberOfSteps; ++step) {
+        const VectorType &proposedState = proposal.propose(randomNumberGenerator);
+        if (std::log(uniform(randomNumberGenerator)) > std::min(0., proposal.computeLogAcceptanceProbability())) {
+            continue;
+        }
+        LogLikelihoodValue proposedLikelihood(-model.computeNegativeLogLikelihood(proposedState),
+                                              uniform(randomNumberGenerator));
+        if (threshold < proposedLikelihood) {
+            proposal.acceptProposal();
+            likelihood = proposedLikelihood;
+        }
+    }
+
+    sample = proposal.getState();
+    return likelihood;
+}
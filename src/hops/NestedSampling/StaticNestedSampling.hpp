@@ -0,0 +1,112 @@
+#ifndef HOPS_STATICNESTEDSAMPLING_HPP
+#define HOPS_STATICNESTEDSAMPLING_HPP
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "hops/MarkovChain/Proposal/Proposal.hpp"
+#include "hops/Model/Model.hpp"
+#include "hops/Parallel/ThreadPool.hpp"
+#include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
+#include "hops/Utility/MatrixType.hpp"
+#include "hops/Utility/VectorType.hpp"
+
+#include "LogLikelihoodValue.hpp"
+
+namespace hops {
+    struct StaticNestedSamplingOptions {
+        long numberOfLivePoints = 500;
+        /**
+         * @brief Number of live points, which are removed and replaced in parallel in every iteration.
+         */
+        long numberOfReplacementsPerIteration = 1;
+        /**
+         * @brief Number of hit-and-run steps for every replacement and for every initial live point.
+         */
+        long numberOfSteps = 20;
+        /**
+         * @brief Stops once the remaining evidence, estimated by the largest likelihood of the live points, is
+         * smaller than exp(logEvidenceTolerance) times the evidence.
+         */
+        double logEvidenceTolerance = std::log(0.01);
+        long maxNumberOfIterations = 1000000;
+        /**
+         * @brief Total number of threads including the calling thread, 0 selects the number of hardware threads.
+         */
+        long numberOfThreads = 1;
+    };
+
+    struct StaticNestedSamplingResult {
+        /**
+         * @brief Dead points followed by the final live points.
+         */
+        std::vector<VectorType> samples;
+        std::vector<double> logLikelihoods;
+        /**
+         * @brief Normalized log posterior weights of the samples.
+         */
+        std::vector<double> logWeights;
+        /**
+         * @brief Log of the likelihood integrated over the uniform distribution on the polytope.
+         */
+        double logEvidence = 0;
+        /**
+         * @brief Standard deviation of the logEvidence estimate sqrt(information / numberOfLivePoints).
+         */
+        double logEvidenceError = 0;
+        /**
+         * @brief Kullback-Leibler divergence from the uniform distribution to the posterior.
+         */
+        double information = 0;
+        long numberOfIterations = 0;
+    };
+
+    /**
+     * @brief Classic nested sampling (Skilling 2006, DOI: 10.1214/06-BA127) for the uniform prior on the polytope Ax<=b.
+     * @details Replacement points are drawn from the constrained prior by short hit-and-run chains, which only accept
+     * proposals with a likelihood above the current threshold. Every iteration removes the
+     * numberOfReplacementsPerIteration worst live points at once and replaces them in parallel, each starting from a
+     * randomly chosen surviving live point. Removing k points at once shrinks the prior mass as k consecutive
+     * iterations with N, N-1, ..., N-k+1 live points. Every replacement uses its own random number stream, the result
+     * thus only depends on the seed and not on the number of threads.
+     */
+    class StaticNestedSampling {
+    public:
+        /**
+         * @param A
+         * @param b
+         * @param startingPoint interior point of the polytope, which starts the chains for the initial live points.
+         * @param model
+         * @param options
+         */
+        StaticNestedSampling(const MatrixType &A,
+                             const VectorType &b,
+                             const VectorType &startingPoint,
+                             const Model &model,
+                             StaticNestedSamplingOptions options = StaticNestedSamplingOptions());
+
+        StaticNestedSamplingResult run(RandomNumberGenerator &randomNumberGenerator);
+
+        [[nodiscard]] const StaticNestedSamplingOptions &getOptions() const;
+
+    private:
+        /**
+         * @brief Runs numberOfSteps hit-and-run steps from start, only accepting likelihoods above threshold.
+         */
+        LogLikelihoodValue drawConstrained(long worker,
+                                           const VectorType &start,
+                                           const LogLikelihoodValue &startLikelihood,
+                                           const LogLikelihoodValue &threshold,
+                                           RandomNumberGenerator &randomNumberGenerator,
+                                           VectorType &sample);
+
+        StaticNestedSamplingOptions options;
+        VectorType startingPoint;
+        std::vector<std::unique_ptr<Proposal>> proposals;
+        std::vector<std::unique_ptr<Model>> models;
+        std::unique_ptr<ThreadPool> threadPool;
+    };
+}
+
+#endif //HOPS_STATICNESTEDSAMPLING_HPP
@@ -76,6 +76,7 @@ namespace hops {
             gp.observationInputCovariance = observationInputCovariance;
             gp.inputCovariance = inputCovariance;
 
+            gp.observedWeights = observedWeights;
             gp.posteriorMean = posteriorMean;
             gp.posteriorCovariance = posteriorCovariance;
             gp.sqrtPosteriorCovariance = sqrtPosteriorCovariance;
@@ -115,13 +116,14 @@ namespace hops {
                     assert(sqrtObservedCovariance.isLowerTriangular() 
                             && "error computing the cholesky factorization of the observed covariance, check code.");
 
-                    posteriorMean = sqrtObservedCovariance.template triangularView<Eigen::Lower>().solve(observedValues - priorMean(observedInputs));
-                    posteriorMean = sqrtObservedCovariance.template triangularView<Eigen::Lower>().transpose().solve(posteriorMean);
-
-                    posteriorCovariance = sqrtObservedCovariance.template triangularView<Eigen::Lower>().solve(observationInputCovariance);
-                    posteriorCovariance = sqrtObservedCovariance.template triangularView<Eigen::Lower>().transpose().solve(posteriorCovariance);
+                    observedWeights = sqrtObservedCovariance.template triangularView<Eigen::Lower>().solve(observedValues - priorMean(observedInputs));
+                    observedWeights = sqrtObservedCovariance.template triangularView<Eigen::Lower>().transpose().solve(observedWeights);
                 }
 
+                // the solves depend on the inputs as well, so they have to be repeated for new inputs
+                posteriorCovariance = sqrtObservedCovariance.template triangularView<Eigen::Lower>().solve(observationInputCovariance);
+                posteriorCovariance = sqrtObservedCovariance.template triangularView<Eigen::Lower>().transpose().solve(posteriorCovariance);
+
 //#ifndef NDEBUG
 //            MatrixType invObservedCovariance = observedCovariance.inverse();
 //            MatrixType control = invObservedCovariance * (observedValues - priorMean(observedInputs));
@@ -129,7 +131,7 @@ namespace hops {
 //            assert((control.size() == 0 || control.cwiseAbs().maxCoeff() < 1.e-5) && "computing the inverse for control might have failed.");
 //#endif 
 
-                posteriorMean = inputPriorMean + observationInputCovariance.transpose() * posteriorMean;
+                posteriorMean = inputPriorMean + observationInputCovariance.transpose() * observedWeights;
 
 //#ifndef NDEBUG
 //            control = invObservedCovariance * observationInputCovariance;
@@ -284,14 +286,14 @@ namespace hops {
         //    updateObservations({x}, {y}, {error});
         //}
 
-        void addObservations(const MatrixType& x, VectorType& y, VectorType& error) {
-            assert(x.size() == y.size());
+        void addObservations(const MatrixType& x, const VectorType& y, const VectorType& error) {
+            assert(x.rows() == y.size());
             assert(y.size() == error.size());
 
             isNewObservations = true;
 
             auto n = observedValues.size();
-            auto m = x.size();
+            auto m = x.rows();
 
             //VectorType newObservedValues = VectorType(n + m);
             //newObservedValues << observedValues, y;
@@ -331,7 +333,7 @@ namespace hops {
         }
 
         void addObservations(const MatrixType& x, const VectorType& y) {
-            addObservations(x, y, VectorType::Zeros(y.rows()));
+            addObservations(x, y, VectorType::Zero(y.rows()));
         }
 
         //void addObservation(const VectorType& x, double y, double error = 0) {
@@ -385,6 +387,7 @@ namespace hops {
         MatrixType observationInputCovariance;
         MatrixType inputCovariance;
 
+        VectorType observedWeights;
         VectorType posteriorMean;
         MatrixType posteriorCovariance;
         MatrixType sqrtPosteriorCovariance;
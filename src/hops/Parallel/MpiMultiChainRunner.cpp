@@ -0,0 +1,249 @@
+#include "MpiMultiChainRunner.hpp"
+
+#ifdef HOPS_MPI_SUPPORTED
+
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace {
+    void writeMarkovChains(const hops::MultiChainResult &result,
+                           const hops::FileWriter &writer,
+                           long firstMarkovChainIndex) {
+        for (size_t chain = 0; chain < result.states.size(); ++chain) {
+            std::string chainIndex = std::to_string(firstMarkovChainIndex + chain);
+            writer.write("states_chain_" + chainIndex, result.states[chain]);
+            writer.write("acceptance_rates_chain_" + chainIndex, result.acceptanceRates[chain]);
+        }
+    }
+}
+
+hops::MpiMultiChainRunner::MpiMultiChainRunner(long numberOfMarkovChains,
+                                               const MarkovChainFactory &createMarkovChain,
+                                               RandomNumberGenerator::state_type seed,
+                                               long numberOfThreads,
+                                               bool pinThreads) :
+        numberOfMarkovChains(numberOfMarkovChains) {
+    MpiInitializerFinalizer::initializeAndQueueFinalizeAtExit();
+    MPI_Comm_dup(MPI_COMM_WORLD, &communicator);
+    MPI_Comm_rank(communicator, &rank);
+    MPI_Comm_size(communicator, &numberOfRanks);
+
+    if (numberOfMarkovChains < numberOfRanks) {
+        MPI_Comm_free(&communicator);
+        throw std::invalid_argument("MpiMultiChainRunner requires at least one Markov chain per rank.");
+    }
+
+    // Contiguous blocks, whose sizes differ by at most one
+    firstMarkovChainIndex = rank * numberOfMarkovChains / numberOfRanks;
+    long endMarkovChainIndex = (rank + 1) * numberOfMarkovChains / numberOfRanks;
+    std::vector<std::unique_ptr<MarkovChain>> markovChains;
+    for (long chain = firstMarkovChainIndex; chain < endMarkovChainIndex; ++chain) {
+        markovChains.emplace_back(createMarkovChain(chain));
+    }
+    localRunner = std::make_unique<MultiChainRunner>(std::move(markovChains),
+                                                     seed,
+                                                     numberOfThreads,
+                                                     pinThreads,
+                                                     firstMarkovChainIndex);
+}
+
+hops::MpiMultiChainRunner::~MpiMultiChainRunner() {
+    int isMpiFinalized;
+    MPI_Finalized(&isMpiFinalized);
+    if (!isMpiFinalized) {
+        MPI_Comm_free(&communicator);
+    }
+}
+
+hops::MultiChainResult hops::MpiMultiChainRunner::draw(long numberOfSamples, long thinning) {
+    return localRunner->draw(numberOfSamples, thinning);
+}
+
+hops::MultiChainDiagnostics hops::MpiMultiChainRunner::computeDiagnostics(const MultiChainResult &localResult) const {
+    long dimension = localRunner->getMarkovChain(0).getState().rows();
+    long recordSize = 2 + 2 * dimension;
+
+    // Every chain contributes its number of samples, acceptances, mean and sum of squared deviations.
+    std::vector<double> localRecords;
+    localRecords.reserve(localResult.states.size() * recordSize);
+    for (size_t chain = 0; chain < localResult.states.size(); ++chain) {
+        const std::vector<VectorType> &states = localResult.states[chain];
+        VectorType mean = VectorType::Zero(dimension);
+        for (const auto &state: states) {
+            mean += state;
+        }
+        if (!states.empty()) {
+            mean /= static_cast<double>(states.size());
+        }
+        VectorType squaredDeviations = VectorType::Zero(dimension);
+        for (const auto &state: states) {
+            squaredDeviations += (state - mean).array().square().matrix();
+        }
+        double numberOfAcceptances = 0;
+        for (double acceptanceRate: localResult.acceptanceRates[chain]) {
+            numberOfAcceptances += acceptanceRate;
+        }
+        localRecords.push_back(static_cast<double>(states.size()));
+        localRecords.push_back(numberOfAcceptances);
+        localRecords.insert(localRecords.end(), mean.data(), mean.data() + dimension);
+        localRecords.insert(localRecords.end(), squaredDeviations.data(), squaredDeviations.data() + dimension);
+    }
+
+    int localSize = static_cast<int>(localRecords.size());
+    std::vector<int> sizes(numberOfRanks);
+    MPI_Allgather(&localSize, 1, MPI_INT, sizes.data(), 1, MPI_INT, communicator);
+    std::vector<int> offsets(numberOfRanks, 0);
+    for (int i = 1; i < numberOfRanks; ++i) {
+        offsets[i] = offsets[i - 1] + sizes[i - 1];
+    }
+    std::vector<double> records(offsets.back() + sizes.back());
+    MPI_Allgatherv(localRecords.data(), localSize, MPI_DOUBLE,
+                   records.data(), sizes.data(), offsets.data(), MPI_DOUBLE, communicator);
+
+    // Merges the chains in the order of their global indices, so that all ranks compute the same result.
+    MultiChainDiagnostics diagnostics;
+    diagnostics.numberOfMarkovChains = static_cast<long>(records.size()) / recordSize;
+    diagnostics.mean = VectorType::Zero(dimension);
+    VectorType squaredDeviations = VectorType::Zero(dimension);
+    VectorType withinChainVariance = VectorType::Zero(dimension);
+    double numberOfAcceptances = 0;
+    for (long chain = 0; chain < diagnostics.numberOfMarkovChains; ++chain) {
+        const double *record = records.data() + chain * recordSize;
+        auto numberOfChainSamples = static_cast<long>(record[0]);
+        Eigen::Map<const VectorType> chainMean(record + 2, dimension);
+        Eigen::Map<const VectorType> chainSquaredDeviations(record + 2 + dimension, dimension);
+        numberOfAcceptances += record[1];
+        if (numberOfChainSamples == 0) {
+            continue;
+        }
+        long mergedNumberOfSamples = diagnostics.numberOfSamples + numberOfChainSamples;
+        VectorType delta = chainMean - diagnostics.mean;
+        diagnostics.mean += delta * static_cast<double>(numberOfChainSamples) / mergedNumberOfSamples;
+        squaredDeviations += chainSquaredDeviations +
+                             (delta.array().square() * (static_cast<double>(diagnostics.numberOfSamples) *
+                                                        numberOfChainSamples / mergedNumberOfSamples)).matrix();
+        diagnostics.numberOfSamples = mergedNumberOfSamples;
+        if (numberOfChainSamples > 1) {
+            withinChainVariance += chainSquaredDeviations / (numberOfChainSamples - 1);
+        }
+    }
+
+    long numberOfSamplesPerChain = diagnostics.numberOfSamples / diagnostics.numberOfMarkovChains;
+    diagnostics.acceptanceRate = diagnostics.numberOfSamples > 0 ?
+                                 numberOfAcceptances / diagnostics.numberOfSamples : 0;
+    diagnostics.variance = diagnostics.numberOfSamples > 1 ?
+                           VectorType(squaredDeviations / (diagnostics.numberOfSamples - 1)) :
+                           VectorType(VectorType::Zero(dimension));
+
+    diagnostics.potentialScaleReduction = VectorType::Constant(dimension, std::numeric_limits<double>::quiet_NaN());
+    if (diagnostics.numberOfMarkovChains > 1 && numberOfSamplesPerChain > 1) {
+        withinChainVariance /= diagnostics.numberOfMarkovChains;
+        VectorType betweenChainVariance = VectorType::Zero(dimension);
+        for (long chain = 0; chain < diagnostics.numberOfMarkovChains; ++chain) {
+            Eigen::Map<const VectorType> chainMean(records.data() + chain * recordSize + 2, dimension);
+            betweenChainVariance += (chainMean - diagnostics.mean).array().square().matrix();
+        }
+        betweenChainVariance *= static_cast<double>(numberOfSamplesPerChain) / (diagnostics.numberOfMarkovChains - 1);
+        VectorType pooledVariance = withinChainVariance * (numberOfSamplesPerChain - 1) / numberOfSamplesPerChain +
+                                    betweenChainVariance / numberOfSamplesPerChain;
+        diagnostics.potentialScaleReduction = (pooledVariance.array() / withinChainVariance.array()).sqrt().matrix();
+    }
+    return diagnostics;
+}
+
+hops::MultiChainResult hops::MpiMultiChainRunner::gather(const MultiChainResult &localResult, int root) const {
+    long dimension = localRunner->getMarkovChain(0).getState().rows();
+    long numberOfSamples = localResult.states.empty() ? 0 : static_cast<long>(localResult.states[0].size());
+
+    // Every state is sent together with its acceptance rate.
+    std::vector<double> localRecords;
+    localRecords.reserve(localResult.states.size() * numberOfSamples * (dimension + 1));
+    for (size_t chain = 0; chain < localResult.states.size(); ++chain) {
+        if (static_cast<long>(localResult.states[chain].size()) != numberOfSamples) {
+            throw std::invalid_argument("All chains of a result have to have the same number of samples.");
+        }
+        for (long i = 0; i < numberOfSamples; ++i) {
+            const VectorType &state = localResult.states[chain][i];
+            localRecords.insert(localRecords.end(), state.data(), state.data() + dimension);
+            localRecords.push_back(localResult.acceptanceRates[chain][i]);
+        }
+    }
+
+    int localHeader[] = {static_cast<int>(localResult.states.size()), static_cast<int>(numberOfSamples)};
+    std::vector<int> headers(rank == root ? 2 * numberOfRanks : 0);
+    MPI_Gather(localHeader, 2, MPI_INT, headers.data(), 2, MPI_INT, root, communicator);
+
+    std::vector<int> sizes;
+    std::vector<int> offsets;
+    std::vector<double> records;
+    if (rank == root) {
+        sizes.resize(numberOfRanks);
+        offsets.resize(numberOfRanks, 0);
+        for (int i = 0; i < numberOfRanks; ++i) {
+            sizes[i] = headers[2 * i] * headers[2 * i + 1] * static_cast<int>(dimension + 1);
+            if (i > 0) {
+                offsets[i] = offsets[i - 1] + sizes[i - 1];
+            }
+        }
+        records.resize(offsets.back() + sizes.back());
+    }
+    MPI_Gatherv(localRecords.data(), static_cast<int>(localRecords.size()), MPI_DOUBLE,
+                records.data(), sizes.data(), offsets.data(), MPI_DOUBLE, root, communicator);
+
+    MultiChainResult result;
+    if (rank != root) {
+        return result;
+    }
+    const double *record = records.data();
+    for (int i = 0; i < numberOfRanks; ++i) {
+        for (int chain = 0; chain < headers[2 * i]; ++chain) {
+            std::vector<VectorType> &states = result.states.emplace_back(headers[2 * i + 1]);
+            std::vector<double> &acceptanceRates = result.acceptanceRates.emplace_back(headers[2 * i + 1]);
+            for (int j = 0; j < headers[2 * i + 1]; ++j) {
+                states[j] = Eigen::Map<const VectorType>(record, dimension);
+                acceptanceRates[j] = record[dimension];
+                record += dimension + 1;
+            }
+        }
+    }
+    return result;
+}
+
+void hops::MpiMultiChainRunner::write(const MultiChainResult &localResult, const FileWriter &writer) const {
+    writeMarkovChains(localResult, writer, firstMarkovChainIndex);
+}
+
+void hops::MpiMultiChainRunner::gatherAndWrite(const MultiChainResult &localResult,
+                                               const FileWriter *writer,
+                                               int root) const {
+    MultiChainResult result = gather(localResult, root);
+    if (rank == root) {
+        if (!writer) {
+            throw std::invalid_argument("The root rank requires a file writer.");
+        }
+        writeMarkovChains(result, *writer, 0);
+    }
+}
+
+int hops::MpiMultiChainRunner::getRank() const {
+    return rank;
+}
+
+int hops::MpiMultiChainRunner::getNumberOfRanks() const {
+    return numberOfRanks;
+}
+
+long hops::MpiMultiChainRunner::getNumberOfMarkovChains() const {
+    return numberOfMarkovChains;
+}
+
+long hops::MpiMultiChainRunner::getFirstMarkovChainIndex() const {
+    return firstMarkovChainIndex;
+}
+
+hops::MultiChainRunner &hops::MpiMultiChainRunner::getLocalRunner() {
+    return *localRunner;
+}
+
+#endif //HOPS_MPI_SUPPORTED
@@ -0,0 +1,159 @@
+#ifndef HOPS_MPIMULTICHAINRUNNER_HPP
+#define HOPS_MPIMULTICHAINRUNNER_HPP
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
+#include "hops/FileWriter/FileWriter.hpp"
+#include "hops/MarkovChain/MarkovChain.hpp"
+#include "hops/Parallel/MultiChainRunner.hpp"
+#include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
+#include "hops/Utility/VectorType.hpp"
+
+#ifdef HOPS_MPI_SUPPORTED
+
+#include "hops/Parallel/MpiInitializerFinalizer.hpp"
+
+namespace hops {
+    /**
+     * @brief Diagnostics of all chains on all ranks.
+     */
+    struct MultiChainDiagnostics {
+        long numberOfMarkovChains = 0;
+        /**
+         * @brief Total number of states of all chains.
+         */
+        long numberOfSamples = 0;
+        double acceptanceRate = 0;
+        VectorType mean;
+        VectorType variance;
+        /**
+         * @brief Potential scale reduction factor (Gelman-Rubin) of every dimension. NaN for less than two chains.
+         */
+        VectorType potentialScaleReduction;
+    };
+
+    /**
+     * @brief Runs independent Markov chains distributed over the ranks of MPI_COMM_WORLD.
+     * @details The chains are created from their global index and distributed in contiguous blocks over the ranks.
+     * Every rank runs its block on a local MultiChainRunner, whose random number generators use the global chain
+     * index as stream. The samples of a chain therefore only depend on the seed and its global index, such that
+     * gathering the samples of a distributed run yields exactly the samples of a MultiChainRunner with the same
+     * chains on a single node.
+     *
+     * draw and write are local to the rank, computeDiagnostics, gather and gatherAndWrite are collective and have to
+     * be called by all ranks in the same order.
+     */
+    class MpiMultiChainRunner {
+    public:
+        using MarkovChainFactory = std::function<std::unique_ptr<MarkovChain>(long chain)>;
+
+        /**
+         * @param numberOfMarkovChains total number of chains on all ranks, at least the number of ranks.
+         * @param createMarkovChain creates the chain with the given global index. Only called for the chains of this
+         * rank.
+         * @param seed master seed, which is shared by the random number streams of all chains.
+         * @param numberOfThreads number of threads per rank. Non-positive values select the number of hardware
+         * threads.
+         * @param pinThreads pins every thread to a single core.
+         */
+        MpiMultiChainRunner(long numberOfMarkovChains,
+                            const MarkovChainFactory &createMarkovChain,
+                            RandomNumberGenerator::state_type seed,
+                            long numberOfThreads = 0,
+                            bool pinThreads = false);
+
+        MpiMultiChainRunner(const MpiMultiChainRunner &) = delete;
+
+        MpiMultiChainRunner &operator=(const MpiMultiChainRunner &) = delete;
+
+        ~MpiMultiChainRunner();
+
+        /**
+         * @brief Draws numberOfSamples states from every chain of this rank.
+         * @return the states of the chains of this rank in the order of their global indices.
+         */
+        MultiChainResult draw(long numberOfSamples, long thinning = 1);
+
+        /**
+         * @brief Reduces the diagnostics of the local results of all ranks. Collective.
+         * @details The result is identical on all ranks.
+         */
+        [[nodiscard]] MultiChainDiagnostics computeDiagnostics(const MultiChainResult &localResult) const;
+
+        /**
+         * @brief Gathers the local results of all ranks on the root rank. Collective.
+         * @return the states of all chains in the order of their global indices on the root rank and an empty result
+         * on all other ranks.
+         */
+        [[nodiscard]] MultiChainResult gather(const MultiChainResult &localResult, int root = 0) const;
+
+        /**
+         * @brief Writes the local result of this rank, e.g. to a file per rank.
+         * @details Every chain is written to "states_chain_<i>" and "acceptance_rates_chain_<i>", where i is the
+         * global index of the chain. The descriptions of different ranks do therefore not collide.
+         */
+        void write(const MultiChainResult &localResult, const FileWriter &writer) const;
+
+        /**
+         * @brief Gathers the local results of all ranks and writes them on the root rank. Collective.
+         * @param writer is only used on the root rank and may be null on all other ranks.
+         */
+        void gatherAndWrite(const MultiChainResult &localResult, const FileWriter *writer, int root = 0) const;
+
+        [[nodiscard]] int getRank() const;
+
+        [[nodiscard]] int getNumberOfRanks() const;
+
+        /**
+         * @return number of chains on all ranks.
+         */
+        [[nodiscard]] long getNumberOfMarkovChains() const;
+
+        /**
+         * @return global index of the first chain of this rank.
+         */
+        [[nodiscard]] long getFirstMarkovChainIndex() const;
+
+        /**
+         * @return runner of the chains of this rank.
+         */
+        [[nodiscard]] MultiChainRunner &getLocalRunner();
+
+    private:
+        MPI_Comm communicator;
+        int rank;
+        int numberOfRanks;
+        long numberOfMarkovChains;
+        long firstMarkovChainIndex;
+        std::unique_ptr<MultiChainRunner> localRunner;
+    };
+}
+
+#else
+
+namespace hops {
+    struct MultiChainDiagnostics {
+    };
+
+    /**
+     * @brief Runs independent Markov chains distributed over the ranks of MPI_COMM_WORLD. Requires MPI.
+     */
+    class MpiMultiChainRunner {
+    public:
+        using MarkovChainFactory = std::function<std::unique_ptr<MarkovChain>(long chain)>;
+
+        MpiMultiChainRunner(long,
+                            const MarkovChainFactory &,
+                            RandomNumberGenerator::state_type,
+                            long = 0,
+                            bool = false) {
+            throw std::runtime_error("MPI not supported on current platform");
+        }
+    };
+}
+
+#endif //HOPS_MPI_SUPPORTED
+
+#endif //HOPS_MPIMULTICHAINRUNNER_HPP
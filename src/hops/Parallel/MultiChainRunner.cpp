@@ -0,0 +1,87 @@
+#include "MultiChainRunner.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include "hops/MarkovChain/Checkpoint.hpp"
+
+hops::MultiChainRunner::MultiChainRunner(std::vector<std::unique_ptr<MarkovChain>> markovChains,
+                                         RandomNumberGenerator::state_type seed,
+                                         long numberOfThreads,
+                                         bool pinThreads,
+                                         long firstStream) :
+        markovChains(std::move(markovChains)) {
+    if (this->markovChains.empty()) {
+        throw std::invalid_argument("MultiChainRunner requires at least one Markov chain.");
+    }
+    for (size_t i = 0; i < this->markovChains.size(); ++i) {
+        if (!this->markovChains[i]) {
+            throw std::invalid_argument("Markov chain " + std::to_string(i) + " is null.");
+        }
+        RandomNumberGenerator randomNumberGenerator(seed);
+        randomNumberGenerator.setStream(firstStream + i);
+        randomNumberGenerators.emplace_back(randomNumberGenerator);
+    }
+    threadPool = std::make_unique<ThreadPool>(numberOfThreads, pinThreads);
+}
+
+hops::MultiChainResult hops::MultiChainRunner::draw(long numberOfSamples, long thinning) {
+    if (numberOfSamples < 0) {
+        throw std::invalid_argument("Number of samples has to be non-negative.");
+    }
+    if (thinning <= 0) {
+        throw std::invalid_argument("Thinning has to be positive.");
+    }
+    MultiChainResult result;
+    result.states.resize(markovChains.size(), std::vector<VectorType>(numberOfSamples));
+    result.acceptanceRates.resize(markovChains.size(), std::vector<double>(numberOfSamples));
+
+    forEachMarkovChain([&](MarkovChain &markovChain, RandomNumberGenerator &randomNumberGenerator, long chain) {
+        for (long i = 0; i < numberOfSamples; ++i) {
+            std::tie(result.acceptanceRates[chain][i], result.states[chain][i]) = markovChain.draw(
+                    randomNumberGenerator, thinning);
+        }
+    });
+
+    return result;
+}
+
+void hops::MultiChainRunner::forEachMarkovChain(
+        const std::function<void(MarkovChain &, RandomNumberGenerator &, long)> &task) {
+    threadPool->parallelFor(getNumberOfMarkovChains(), [&](long chain) {
+        task(*markovChains[chain], randomNumberGenerators[chain], chain);
+    });
+}
+
+long hops::MultiChainRunner::getNumberOfMarkovChains() const {
+    return static_cast<long>(markovChains.size());
+}
+
+long hops::MultiChainRunner::getNumberOfThreads() const {
+    return threadPool->getNumberOfThreads();
+}
+
+hops::MarkovChain &hops::MultiChainRunner::getMarkovChain(long index) {
+    return *markovChains.at(index);
+}
+
+const hops::RandomNumberGenerator &hops::MultiChainRunner::getRandomNumberGenerator(long index) const {
+    return randomNumberGenerators.at(index);
+}
+
+void hops::MultiChainRunner::writeCheckpoint(const std::string &fileName) const {
+    std::vector<const MarkovChain *> chains;
+    for (const auto &markovChain: markovChains) {
+        chains.emplace_back(markovChain.get());
+    }
+    Checkpoint::writeFile(fileName, chains, randomNumberGenerators);
+}
+
+void hops::MultiChainRunner::readCheckpoint(const std::string &fileName) {
+    std::vector<MarkovChain *> chains;
+    for (const auto &markovChain: markovChains) {
+        chains.emplace_back(markovChain.get());
+    }
+    Checkpoint::readFile(fileName, chains, randomNumberGenerators);
+}
@@ -0,0 +1,90 @@
+#ifndef HOPS_MULTICHAINRUNNER_HPP
+#define HOPS_MULTICHAINRUNNER_HPP
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "hops/MarkovChain/MarkovChain.hpp"
+#include "hops/Parallel/ThreadPool.hpp"
+#include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
+#include "hops/Utility/VectorType.hpp"
+
+namespace hops {
+    struct MultiChainResult {
+        /**
+         * @brief states[i][j] is the j-th state of the i-th chain.
+         */
+        std::vector<std::vector<VectorType>> states;
+        /**
+         * @brief acceptanceRates[i][j] is the acceptance rate of the i-th chain throughout the thinning of the j-th
+         * state.
+         */
+        std::vector<std::vector<double>> acceptanceRates;
+    };
+
+    /**
+     * @brief Runs independent Markov chains in parallel on a persistent ThreadPool.
+     * @details Every chain owns a random number generator, which is seeded with the master seed and uses the index of
+     * the chain as its stream. Chains are only ever advanced by their own generator, so the output is bitwise
+     * identical for any number of threads. Chains are distributed by work stealing, so chains of different speed
+     * keep all threads busy. Consecutive calls to draw continue the chains and their random number streams.
+     */
+    class MultiChainRunner {
+    public:
+        /**
+         * @param markovChains e.g. from the MarkovChainFactory.
+         * @param seed master seed, which is shared by the random number streams of all chains.
+         * @param numberOfThreads total number of threads including the calling thread. Non-positive values select the
+         * number of hardware threads.
+         * @param pinThreads pins every thread to a single core to keep chains and their data in the same cache.
+         * @param firstStream random number stream of the first chain, e.g. its global index in a distributed run.
+         */
+        MultiChainRunner(std::vector<std::unique_ptr<MarkovChain>> markovChains,
+                         RandomNumberGenerator::state_type seed,
+                         long numberOfThreads = 0,
+                         bool pinThreads = false,
+                         long firstStream = 0);
+
+        /**
+         * @brief Draws numberOfSamples states from every chain.
+         * @param numberOfSamples
+         * @param thinning number of Markov chain steps per returned state.
+         */
+        MultiChainResult draw(long numberOfSamples, long thinning = 1);
+
+        /**
+         * @brief Calls task(markovChain, randomNumberGenerator, index) for every chain in parallel.
+         * @details Tasks must only touch the chain and random number generator they are given.
+         */
+        void forEachMarkovChain(
+                const std::function<void(MarkovChain &, RandomNumberGenerator &, long)> &task);
+
+        [[nodiscard]] long getNumberOfMarkovChains() const;
+
+        [[nodiscard]] long getNumberOfThreads() const;
+
+        [[nodiscard]] MarkovChain &getMarkovChain(long index);
+
+        [[nodiscard]] const RandomNumberGenerator &getRandomNumberGenerator(long index) const;
+
+        /**
+         * @brief Writes all chains and their random number generators to a Checkpoint file.
+         */
+        void writeCheckpoint(const std::string &fileName) const;
+
+        /**
+         * @brief Continues all chains and their random number streams from a checkpoint written by writeCheckpoint.
+         * @details The chains have to be constructed with the same arguments as the chains of the checkpoint.
+         */
+        void readCheckpoint(const std::string &fileName);
+
+    private:
+        std::vector<std::unique_ptr<MarkovChain>> markovChains;
+        std::vector<RandomNumberGenerator> randomNumberGenerators;
+        std::unique_ptr<ThreadPool> threadPool;
+    };
+}
+
+#endif //HOPS_MULTICHAINRUNNER_HPP
@@ -0,0 +1,170 @@
+#include "PooledWarmUp.hpp"
+
+#include <Eigen/Cholesky>
+#include <algorithm>
+#include <any>
+#include <cmath>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+
+hops::PooledWarmUp::PooledWarmUp(MultiChainRunner &runner,
+                                 double targetAcceptanceRate,
+                                 long windowLength,
+                                 bool shareCovariance) :
+        runner(runner),
+        targetAcceptanceRate(targetAcceptanceRate),
+        windowLength(windowLength),
+        shareCovariance(shareCovariance) {
+    if (targetAcceptanceRate <= 0 || targetAcceptanceRate >= 1) {
+        throw std::invalid_argument("Target acceptance rate has to be in (0, 1).");
+    }
+    if (windowLength <= 0) {
+        throw std::invalid_argument("Window length has to be positive.");
+    }
+
+    std::optional<double> initialStepSize;
+    for (long chain = 0; chain < runner.getNumberOfMarkovChains(); ++chain) {
+        MarkovChain &markovChain = runner.getMarkovChain(chain);
+        try {
+            double stepSize = std::any_cast<double>(markovChain.getParameter(ProposalParameter::STEP_SIZE));
+            hasStepSize.push_back(true);
+            if (!initialStepSize) {
+                initialStepSize = stepSize;
+            }
+        } catch (const std::exception &) {
+            hasStepSize.push_back(false);
+        }
+        try {
+            markovChain.getParameter(ProposalParameter::COVARIANCE);
+            hasCovariance.push_back(shareCovariance);
+        } catch (const std::exception &) {
+            hasCovariance.push_back(false);
+        }
+    }
+    chainStatistics.resize(runner.getNumberOfMarkovChains());
+
+    long dimension = runner.getMarkovChain(0).getState().rows();
+    mean = VectorType::Zero(dimension);
+    scatter = MatrixType::Zero(dimension, dimension);
+    logStepSize = std::log(initialStepSize.value_or(1.));
+
+    auto initialSnapshot = std::make_unique<WarmUpSnapshot>();
+    initialSnapshot->mean = mean;
+    initialSnapshot->stepSize = std::exp(logStepSize);
+    publish(std::move(initialSnapshot));
+}
+
+void hops::PooledWarmUp::warmUp(long numberOfSteps) {
+    if (isFrozen()) {
+        throw std::runtime_error("Warm-up was already frozen.");
+    }
+    if (numberOfSteps < 0) {
+        throw std::invalid_argument("Number of steps has to be non-negative.");
+    }
+
+    while (numberOfSteps > 0) {
+        long stepsOfWindow = std::min(windowLength, numberOfSteps);
+        numberOfSteps -= stepsOfWindow;
+        const WarmUpSnapshot &snapshot = getSnapshot();
+
+        runner.forEachMarkovChain([&](MarkovChain &markovChain,
+                                      RandomNumberGenerator &randomNumberGenerator,
+                                      long chain) {
+            applySnapshot(markovChain, chain, snapshot);
+
+            // Welford's algorithm
+            ChainStatistics &statistics = chainStatistics[chain];
+            statistics.numberOfSamples = 0;
+            statistics.mean = VectorType::Zero(mean.rows());
+            statistics.scatter = MatrixType::Zero(mean.rows(), mean.rows());
+            statistics.numberOfAcceptances = 0;
+            VectorType delta(mean.rows());
+            for (long i = 0; i < stepsOfWindow; ++i) {
+                auto[acceptanceRate, state] = markovChain.draw(randomNumberGenerator, 1);
+                statistics.numberOfAcceptances += acceptanceRate;
+                statistics.numberOfSamples += 1;
+                delta = state - statistics.mean;
+                statistics.mean += delta / statistics.numberOfSamples;
+                statistics.scatter.noalias() += delta * (state - statistics.mean).transpose();
+            }
+        });
+
+        // Merges the chains in a fixed order (Chan et al.), so that the result does not depend on the threads.
+        double numberOfAcceptances = 0;
+        double numberOfStepSizeAcceptances = 0;
+        long numberOfStepSizeChains = 0;
+        for (long chain = 0; chain < runner.getNumberOfMarkovChains(); ++chain) {
+            const ChainStatistics &statistics = chainStatistics[chain];
+            long mergedNumberOfSamples = numberOfSamples + statistics.numberOfSamples;
+            VectorType delta = statistics.mean - mean;
+            mean += delta * static_cast<double>(statistics.numberOfSamples) / mergedNumberOfSamples;
+            scatter += statistics.scatter + delta * delta.transpose() *
+                                            (static_cast<double>(numberOfSamples) * statistics.numberOfSamples /
+                                             mergedNumberOfSamples);
+            numberOfSamples = mergedNumberOfSamples;
+
+            numberOfAcceptances += statistics.numberOfAcceptances;
+            if (hasStepSize[chain]) {
+                numberOfStepSizeAcceptances += statistics.numberOfAcceptances;
+                numberOfStepSizeChains += 1;
+            }
+        }
+
+        if (numberOfStepSizeChains > 0) {
+            double stepSizeAcceptanceRate = numberOfStepSizeAcceptances / (numberOfStepSizeChains * stepsOfWindow);
+            logStepSize += (stepSizeAcceptanceRate - targetAcceptanceRate) / std::pow(snapshot.version + 1, 0.6);
+        }
+
+        auto nextSnapshot = std::make_unique<WarmUpSnapshot>();
+        nextSnapshot->version = snapshot.version + 1;
+        nextSnapshot->numberOfSamples = numberOfSamples;
+        nextSnapshot->mean = mean;
+        nextSnapshot->covariance = snapshot.covariance;
+        if (numberOfSamples > mean.rows()) {
+            MatrixType covariance = scatter / static_cast<double>(numberOfSamples - 1);
+            Eigen::LLT<MatrixType> solver(covariance);
+            if (solver.info() == Eigen::Success) {
+                nextSnapshot->covariance = std::move(covariance);
+            }
+        }
+        nextSnapshot->stepSize = std::exp(logStepSize);
+        nextSnapshot->acceptanceRate = numberOfAcceptances / (runner.getNumberOfMarkovChains() * stepsOfWindow);
+        publish(std::move(nextSnapshot));
+    }
+}
+
+const hops::WarmUpSnapshot &hops::PooledWarmUp::freeze() {
+    if (isFrozen()) {
+        return getSnapshot();
+    }
+    auto finalSnapshot = std::make_unique<WarmUpSnapshot>(getSnapshot());
+    finalSnapshot->isFrozen = true;
+    for (long chain = 0; chain < runner.getNumberOfMarkovChains(); ++chain) {
+        applySnapshot(runner.getMarkovChain(chain), chain, *finalSnapshot);
+    }
+    publish(std::move(finalSnapshot));
+    return getSnapshot();
+}
+
+bool hops::PooledWarmUp::isFrozen() const {
+    return getSnapshot().isFrozen;
+}
+
+const hops::WarmUpSnapshot &hops::PooledWarmUp::getSnapshot() const {
+    return *latestSnapshot.load(std::memory_order_acquire);
+}
+
+void hops::PooledWarmUp::publish(std::unique_ptr<WarmUpSnapshot> snapshot) {
+    snapshots.emplace_back(std::move(snapshot));
+    latestSnapshot.store(snapshots.back().get(), std::memory_order_release);
+}
+
+void hops::PooledWarmUp::applySnapshot(MarkovChain &markovChain, long chain, const WarmUpSnapshot &snapshot) const {
+    if (hasStepSize[chain]) {
+        markovChain.setParameter(ProposalParameter::STEP_SIZE, snapshot.stepSize);
+    }
+    if (hasCovariance[chain] && snapshot.covariance.size() > 0) {
+        markovChain.setParameter(ProposalParameter::COVARIANCE, snapshot.covariance);
+    }
+}
@@ -0,0 +1,127 @@
+#ifndef HOPS_POOLEDWARMUP_HPP
+#define HOPS_POOLEDWARMUP_HPP
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "hops/Parallel/MultiChainRunner.hpp"
+#include "hops/Utility/MatrixType.hpp"
+#include "hops/Utility/VectorType.hpp"
+
+namespace hops {
+    /**
+     * @brief Immutable result of one adaptation window of the PooledWarmUp.
+     */
+    struct WarmUpSnapshot {
+        /**
+         * @brief Number of the adaptation window, which produced the snapshot. The initial snapshot has version 0.
+         */
+        long version = 0;
+        /**
+         * @brief Number of states of all chains, which were pooled into the mean and covariance.
+         */
+        long numberOfSamples = 0;
+        VectorType mean;
+        /**
+         * @brief Pooled covariance. It is empty until the pooled covariance is positive definite for the first time.
+         */
+        MatrixType covariance;
+        /**
+         * @brief Step size shared by all chains, which have a step size.
+         */
+        double stepSize = 1;
+        /**
+         * @brief Acceptance rate of all chains during the last adaptation window.
+         */
+        double acceptanceRate = 0;
+        bool isFrozen = false;
+    };
+
+    /**
+     * @brief Adapts the chains of a MultiChainRunner from the pooled statistics of all chains during warm-up.
+     * @details The warm-up runs in adaptation windows. During a window, every chain samples independently with the
+     * current snapshot. At the end of a window, the running means and covariances of all chains are merged, the shared
+     * step size is adapted to the pooled acceptance rate with a Robbins-Monro update of its logarithm and a new
+     * snapshot is published. Every chain applies the step size, if it has one, and the covariance, if it supports
+     * ProposalParameter::COVARIANCE, e.g. the AdaptiveMetropolisProposal.
+     *
+     * Chains only synchronize at the end of a window, so the result does not depend on the number of threads.
+     * Snapshots are never modified after publication and are published through an atomic pointer, such that other
+     * threads can monitor the warm-up without locks. Published snapshots live as long as the PooledWarmUp.
+     *
+     * The covariance is pooled in the coordinates of MarkovChain::getState. It should therefore not be shared with
+     * chains, which propose in transformed coordinates, e.g. rounded chains.
+     */
+    class PooledWarmUp {
+    public:
+        /**
+         * @param runner provides the chains, random number generators and threads.
+         * @param targetAcceptanceRate of the step size adaptation.
+         * @param windowLength number of steps of every chain per adaptation window.
+         * @param shareCovariance whether to apply the pooled covariance to chains, which support it.
+         */
+        explicit PooledWarmUp(MultiChainRunner &runner,
+                              double targetAcceptanceRate = 0.234,
+                              long windowLength = 50,
+                              bool shareCovariance = true);
+
+        PooledWarmUp(const PooledWarmUp &) = delete;
+
+        PooledWarmUp &operator=(const PooledWarmUp &) = delete;
+
+        /**
+         * @brief Advances every chain by numberOfSteps warm-up steps.
+         * @details Can be called repeatedly to continue the warm-up until freeze is called.
+         */
+        void warmUp(long numberOfSteps);
+
+        /**
+         * @brief Ends the warm-up. The chains keep the step size and covariance of the latest snapshot.
+         * @return the final snapshot
+         */
+        const WarmUpSnapshot &freeze();
+
+        [[nodiscard]] bool isFrozen() const;
+
+        /**
+         * @brief Returns the latest published snapshot. Can be called from any thread without locking.
+         */
+        [[nodiscard]] const WarmUpSnapshot &getSnapshot() const;
+
+    private:
+        /**
+         * @brief Running statistics of the states of a single chain during the current window.
+         */
+        struct ChainStatistics {
+            long numberOfSamples = 0;
+            VectorType mean;
+            MatrixType scatter;
+            double numberOfAcceptances = 0;
+        };
+
+        void publish(std::unique_ptr<WarmUpSnapshot> snapshot);
+
+        void applySnapshot(MarkovChain &markovChain, long chain, const WarmUpSnapshot &snapshot) const;
+
+        MultiChainRunner &runner;
+        double targetAcceptanceRate;
+        long windowLength;
+        bool shareCovariance;
+
+        std::vector<char> hasStepSize;
+        std::vector<char> hasCovariance;
+        std::vector<ChainStatistics> chainStatistics;
+
+        // Pooled statistics of all windows so far
+        long numberOfSamples = 0;
+        VectorType mean;
+        MatrixType scatter;
+        double logStepSize = 0;
+
+        std::vector<std::unique_ptr<const WarmUpSnapshot>> snapshots;
+        std::atomic<const WarmUpSnapshot *> latestSnapshot{nullptr};
+    };
+}
+
+#endif //HOPS_POOLEDWARMUP_HPP
@@ -0,0 +1,175 @@
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+    void pinCurrentThread(long core) {
+#ifdef __linux__
+        long numberOfCores = std::max(1l, static_cast<long>(std::thread::hardware_concurrency()));
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(static_cast<int>(core % numberOfCores), &cpuSet);
+        // Pinning is only a performance hint, failures are thus ignored.
+        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet);
+#else
+        (void) core;
+#endif
+    }
+}
+
+hops::ThreadPool::ThreadPool(long numberOfThreads, bool pinThreads) : pinThreads(pinThreads) {
+    if (numberOfThreads <= 0) {
+        numberOfThreads = std::max(1l, static_cast<long>(std::thread::hardware_concurrency()));
+    }
+    taskRanges = std::vector<TaskRange>(numberOfThreads);
+    workers.reserve(numberOfThreads - 1);
+    for (long i = 1; i < numberOfThreads; ++i) {
+        workers.emplace_back(&ThreadPool::work, this, i);
+    }
+}
+
+hops::ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        isStopped = true;
+    }
+    workAvailable.notify_all();
+    for (auto &worker: workers) {
+        worker.join();
+    }
+}
+
+void hops::ThreadPool::parallelFor(long numberOfTasks, const std::function<void(long)> &newTask) {
+    if (numberOfTasks <= 0) {
+        return;
+    }
+    if (static_cast<std::uint64_t>(numberOfTasks) > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::invalid_argument("ThreadPool supports at most 2^32-1 tasks per parallelFor.");
+    }
+    std::lock_guard<std::mutex> submitLock(submitMutex);
+    long numberOfThreads = getNumberOfThreads();
+    for (long i = 0; i < numberOfThreads; ++i) {
+        taskRanges[i].range.store(pack(numberOfTasks * i / numberOfThreads, numberOfTasks * (i + 1) / numberOfThreads));
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        task = &newTask;
+        numberOfBusyWorkers = static_cast<long>(workers.size());
+        exception = nullptr;
+        ++generation;
+    }
+    workAvailable.notify_all();
+
+    runTasks(0);
+
+    std::exception_ptr taskException;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        workFinished.wait(lock, [this]() { return numberOfBusyWorkers == 0; });
+        task = nullptr;
+        taskException = exception;
+        exception = nullptr;
+    }
+    if (taskException) {
+        std::rethrow_exception(taskException);
+    }
+}
+
+long hops::ThreadPool::getNumberOfThreads() const {
+    return static_cast<long>(workers.size()) + 1;
+}
+
+bool hops::ThreadPool::isPinningThreads() const {
+    return pinThreads;
+}
+
+std::uint64_t hops::ThreadPool::pack(std::uint64_t begin, std::uint64_t end) {
+    return (begin << 32) | end;
+}
+
+bool hops::ThreadPool::popTask(long threadIndex, long &taskIndex) {
+    std::atomic<std::uint64_t> &range = taskRanges[threadIndex].range;
+    std::uint64_t current = range.load();
+    while (true) {
+        std::uint64_t begin = current >> 32;
+        std::uint64_t end = current & 0xffffffff;
+        if (begin >= end) {
+            return false;
+        }
+        if (range.compare_exchange_weak(current, pack(begin + 1, end))) {
+            taskIndex = static_cast<long>(begin);
+            return true;
+        }
+    }
+}
+
+bool hops::ThreadPool::stealTasks(long threadIndex, long &taskIndex) {
+    long numberOfThreads = getNumberOfThreads();
+    for (long offset = 1; offset < numberOfThreads; ++offset) {
+        std::atomic<std::uint64_t> &victimRange = taskRanges[(threadIndex + offset) % numberOfThreads].range;
+        std::uint64_t current = victimRange.load();
+        while (true) {
+            std::uint64_t begin = current >> 32;
+            std::uint64_t end = current & 0xffffffff;
+            if (begin >= end) {
+                break;
+            }
+            std::uint64_t stolen = (end - begin + 1) / 2;
+            if (victimRange.compare_exchange_weak(current, pack(begin, end - stolen))) {
+                // The own range is empty, so no other thread modifies it until the stolen tasks are published.
+                taskRanges[threadIndex].range.store(pack(end - stolen + 1, end));
+                taskIndex = static_cast<long>(end - stolen);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void hops::ThreadPool::runTasks(long threadIndex) {
+    long taskIndex;
+    while (popTask(threadIndex, taskIndex) || stealTasks(threadIndex, taskIndex)) {
+        try {
+            (*task)(taskIndex);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!exception) {
+                exception = std::current_exception();
+            }
+        }
+    }
+}
+
+void hops::ThreadPool::work(long threadIndex) {
+    if (pinThreads) {
+        pinCurrentThread(threadIndex);
+    }
+    unsigned long lastGeneration = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            workAvailable.wait(lock, [this, lastGeneration]() {
+                return isStopped || generation != lastGeneration;
+            });
+            if (isStopped) {
+                return;
+            }
+            lastGeneration = generation;
+        }
+
+        runTasks(threadIndex);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            --numberOfBusyWorkers;
+        }
+        workFinished.notify_all();
+    }
+}
@@ -0,0 +1,87 @@
+#ifndef HOPS_THREADPOOL_HPP
+#define HOPS_THREADPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hops {
+    /**
+     * @brief Persistent pool of worker threads for data parallel loops.
+     * @details The calling thread participates in parallelFor, so a pool with a single thread runs everything
+     * sequentially without any synchronization overhead. parallelFor must not be called from within a task.
+     *
+     * Every thread starts with a contiguous block of tasks, so repeated loops over the same data tend to run the same
+     * task on the same thread. Threads that run out of tasks steal half of the remaining tasks of another thread,
+     * which balances tasks of different durations.
+     */
+    class ThreadPool {
+    public:
+        /**
+         * @param numberOfThreads total number of threads including the calling thread. Non-positive values select the
+         * number of hardware threads.
+         * @param pinThreads pins the i-th worker thread to core i modulo the number of cores. The calling thread is
+         * not pinned. Only supported on Linux, ignored elsewhere.
+         */
+        explicit ThreadPool(long numberOfThreads = 0, bool pinThreads = false);
+
+        ThreadPool(const ThreadPool &) = delete;
+
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        ~ThreadPool();
+
+        /**
+         * @brief Calls task(i) for all i in [0, numberOfTasks) and blocks until all tasks are finished.
+         * @details The first exception thrown by a task is rethrown after all tasks have finished.
+         * @param numberOfTasks
+         * @param task
+         */
+        void parallelFor(long numberOfTasks, const std::function<void(long)> &task);
+
+        [[nodiscard]] long getNumberOfThreads() const;
+
+        [[nodiscard]] bool isPinningThreads() const;
+
+    private:
+        /**
+         * @brief Tasks [begin, end) of a thread packed into a single word, so that the owner and thieves can update
+         * it with a single compare and swap.
+         */
+        struct alignas(64) TaskRange {
+            std::atomic<std::uint64_t> range{0};
+        };
+
+        static std::uint64_t pack(std::uint64_t begin, std::uint64_t end);
+
+        bool popTask(long threadIndex, long &taskIndex);
+
+        bool stealTasks(long threadIndex, long &taskIndex);
+
+        void runTasks(long threadIndex);
+
+        void work(long threadIndex);
+
+        std::vector<std::thread> workers;
+        std::vector<TaskRange> taskRanges;
+        bool pinThreads;
+
+        std::mutex submitMutex;
+        std::mutex mutex;
+        std::condition_variable workAvailable;
+        std::condition_variable workFinished;
+
+        const std::function<void(long)> *task = nullptr;
+        long numberOfBusyWorkers = 0;
+        unsigned long generation = 0;
+        bool isStopped = false;
+        std::exception_ptr exception;
+    };
+}
+
+#endif //HOPS_THREADPOOL_HPP
@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+#include "hops/LinearProgram/LinearProgramFactory.hpp"
+#include "hops/Utility/BinarySerialization.hpp"
+#include "MaximumVolumeEllipsoid.hpp"
+#include "RoundingCache.hpp"
+
+namespace {
+    constexpr char ROUNDING_CACHE_MAGIC[] = {'H', 'O', 'P', 'S', 'R', 'N', 'D', 'C'};
+    constexpr std::uint32_t ROUNDING_CACHE_VERSION = 1;
+
+    void hashBytes(std::uint64_t &hash, const void *data, std::size_t numberOfBytes) {
+        constexpr std::uint64_t FNV_PRIME = 1099511628211ull;
+        const auto *bytes = static_cast<const unsigned char *>(data);
+        for (std::size_t i = 0; i < numberOfBytes; ++i) {
+            hash ^= bytes[i];
+            hash *= FNV_PRIME;
+        }
+    }
+
+    template<typename Derived>
+    void hashMatrix(std::uint64_t &hash, const Eigen::PlainObjectBase<Derived> &matrix) {
+        std::int64_t dimensions[] = {matrix.rows(), matrix.cols()};
+        hashBytes(hash, dimensions, sizeof(dimensions));
+        hashBytes(hash, matrix.data(), sizeof(typename Derived::Scalar) * matrix.size());
+    }
+}
+
+hops::RoundingCache::RoundingCache(std::string directory) : directory(std::move(directory)) {
+    std::filesystem::create_directories(this->directory);
+}
+
+std::string hops::RoundingCache::computeKey(const Eigen::MatrixXd &A, const Eigen::VectorXd &b) {
+    std::uint64_t hash = 14695981039346656037ull;
+    hashMatrix(hash, A);
+    hashMatrix(hash, b);
+    char key[17];
+    std::snprintf(key, sizeof(key), "%016llx", static_cast<unsigned long long>(hash));
+    return key;
+}
+
+hops::RoundingCache::Rounding hops::RoundingCache::computeRounding(const Eigen::MatrixXd &A, const Eigen::VectorXd &b) {
+    Rounding rounding;
+    rounding.chebyshevCenter = LinearProgramFactory::createLinearProgram(A, b)->computeChebyshevCenter()
+            .optimalParameters;
+    auto maximumVolumeEllipsoid = MaximumVolumeEllipsoid<double>::construct(A, b, 100000, rounding.chebyshevCenter);
+    rounding.roundingTransformation = maximumVolumeEllipsoid.getRoundingTransformation();
+    rounding.ellipsoidCenter = maximumVolumeEllipsoid.getCenter();
+    return rounding;
+}
+
+std::optional<hops::RoundingCache::Rounding>
+hops::RoundingCache::load(const Eigen::MatrixXd &A, const Eigen::VectorXd &b) const {
+    std::ifstream in(getFileName(A, b), std::ios::binary);
+    if (!in) {
+        return std::nullopt;
+    }
+    try {
+        char magic[sizeof(ROUNDING_CACHE_MAGIC)];
+        in.read(magic, sizeof(magic));
+        std::uint32_t formatVersion;
+        std::int64_t rows;
+        std::int64_t cols;
+        BinarySerialization::readAll(in, formatVersion, rows, cols);
+        // Entries of other versions or of colliding polytopes are recomputed and overwritten.
+        if (!std::equal(magic, magic + sizeof(magic), ROUNDING_CACHE_MAGIC) ||
+            formatVersion != ROUNDING_CACHE_VERSION || rows != A.rows() || cols != A.cols()) {
+            return std::nullopt;
+        }
+        Rounding rounding;
+        BinarySerialization::readAll(in,
+                                     rounding.roundingTransformation,
+                                     rounding.ellipsoidCenter,
+                                     rounding.chebyshevCenter);
+        return rounding;
+    }
+    catch (std::runtime_error &) {
+        return std::nullopt;
+    }
+}
+
+void hops::RoundingCache::store(const Eigen::MatrixXd &A, const Eigen::VectorXd &b, const Rounding &rounding) const {
+    // Writes a temporary file first and renames it, so concurrent runs never read incomplete entries.
+    std::string fileName = getFileName(A, b);
+    std::string temporaryFileName = fileName + "." + std::to_string(std::random_device()()) + ".tmp";
+    {
+        std::ofstream out(temporaryFileName, std::ios::binary | std::ios::trunc);
+        out.write(ROUNDING_CACHE_MAGIC, sizeof(ROUNDING_CACHE_MAGIC));
+        BinarySerialization::writeAll(out,
+                                      ROUNDING_CACHE_VERSION,
+                                      static_cast<std::int64_t>(A.rows()),
+                                      static_cast<std::int64_t>(A.cols()),
+                                      rounding.roundingTransformation,
+                                      rounding.ellipsoidCenter,
+                                      rounding.chebyshevCenter);
+        if (!out) {
+            throw std::runtime_error("Failed to write " + temporaryFileName + ".");
+        }
+    }
+    std::filesystem::rename(temporaryFileName, fileName);
+}
+
+hops::RoundingCache::Rounding hops::RoundingCache::getOrCompute(const Eigen::MatrixXd &A,
+                                                                const Eigen::VectorXd &b,
+                                                                const RoundingComputation &computation) const {
+    if (auto rounding = load(A, b)) {
+        return rounding.value();
+    }
+    Rounding rounding = computation(A, b);
+    store(A, b, rounding);
+    return rounding;
+}
+
+std::string hops::RoundingCache::getFileName(const Eigen::MatrixXd &A, const Eigen::VectorXd &b) const {
+    return (std::filesystem::path(directory) / (computeKey(A, b) + ".rounding")).string();
+}
@@ -0,0 +1,62 @@
+#ifndef HOPS_ROUNDINGCACHE_HPP
+#define HOPS_ROUNDINGCACHE_HPP
+
+#include <Eigen/Core>
+#include <functional>
+#include <optional>
+#include <string>
+
+namespace hops {
+    /**
+     * @brief Stores the maximum volume ellipsoid and the Chebyshev center of polytopes Ax <= b in a directory, so they
+     * are computed only once for every polytope.
+     * @details Entries are keyed by a hash of the content of A and b and are reused by later runs and processes.
+     */
+    class RoundingCache {
+    public:
+        struct Rounding {
+            /**
+             * @brief lower triangular Cholesky factor of the maximum volume ellipsoid.
+             */
+            Eigen::MatrixXd roundingTransformation;
+            Eigen::VectorXd ellipsoidCenter;
+            Eigen::VectorXd chebyshevCenter;
+        };
+
+        using RoundingComputation = std::function<Rounding(const Eigen::MatrixXd &, const Eigen::VectorXd &)>;
+
+        /**
+         * @param directory is created if it does not exist.
+         */
+        explicit RoundingCache(std::string directory);
+
+        /**
+         * @return 64 bit FNV-1a hash of the dimensions and values of A and b as hexadecimal string.
+         */
+        static std::string computeKey(const Eigen::MatrixXd &A, const Eigen::VectorXd &b);
+
+        /**
+         * @brief Computes the Chebyshev center with a linear program and the maximum volume ellipsoid starting from
+         * it. Requires a linear programming solver.
+         */
+        static Rounding computeRounding(const Eigen::MatrixXd &A, const Eigen::VectorXd &b);
+
+        [[nodiscard]] std::optional<Rounding> load(const Eigen::MatrixXd &A, const Eigen::VectorXd &b) const;
+
+        void store(const Eigen::MatrixXd &A, const Eigen::VectorXd &b, const Rounding &rounding) const;
+
+        /**
+         * @brief Loads the rounding of the polytope or computes and stores it if it is not cached yet.
+         */
+        Rounding getOrCompute(const Eigen::MatrixXd &A,
+                              const Eigen::VectorXd &b,
+                              const RoundingComputation &computation = computeRounding) const;
+
+        [[nodiscard]] std::string getFileName(const Eigen::MatrixXd &A, const Eigen::VectorXd &b) const;
+
+    private:
+        std::string directory;
+    };
+}
+
+#endif //HOPS_ROUNDINGCACHE_HPP
@@ -0,0 +1,198 @@
+#include "SequentialMonteCarlo.hpp"
+
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+namespace {
+    long partitionBegin(long numberOfParticles, long numberOfPartitions, long partition) {
+        return numberOfParticles * partition / numberOfPartitions;
+    }
+}
+
+hops::SequentialMonteCarlo::SequentialMonteCarlo(std::vector<std::unique_ptr<MarkovChain>> markovChains) :
+        markovChains(std::move(markovChains)) {
+    if (this->markovChains.empty()) {
+        throw std::invalid_argument("SequentialMonteCarlo requires at least one Markov chain.");
+    }
+    threadPool = std::make_unique<ThreadPool>(getNumberOfMarkovChains());
+}
+
+hops::SequentialMonteCarloResult hops::SequentialMonteCarlo::run(RandomNumberGenerator &randomNumberGenerator,
+                                                                long numberOfParticles,
+                                                                long thinning) {
+    if (numberOfParticles <= 0) {
+        throw std::invalid_argument("Number of particles has to be positive.");
+    }
+    RandomNumberGenerator::result_type seed = randomNumberGenerator();
+    std::vector<VectorType> initialParticles(numberOfParticles);
+    long numberOfThreads = getNumberOfMarkovChains();
+
+    threadPool->parallelFor(numberOfThreads, [&](long threadIndex) {
+        RandomNumberGenerator threadRandomNumberGenerator(seed, threadIndex);
+        MarkovChain *markovChain = markovChains[threadIndex].get();
+        markovChain->setParameter(ProposalParameter::COLDNESS, 0.);
+        for (long i = partitionBegin(numberOfParticles, numberOfThreads, threadIndex);
+             i < partitionBegin(numberOfParticles, numberOfThreads, threadIndex + 1); ++i) {
+            initialParticles[i] = markovChain->draw(threadRandomNumberGenerator, thinning).second;
+        }
+    });
+
+    return run(randomNumberGenerator, initialParticles);
+}
+
+hops::SequentialMonteCarloResult hops::SequentialMonteCarlo::run(RandomNumberGenerator &randomNumberGenerator,
+                                                                const std::vector<VectorType> &initialParticles) {
+    if (initialParticles.empty()) {
+        throw std::invalid_argument("SequentialMonteCarlo requires at least one particle.");
+    }
+    long numberOfParticles = static_cast<long>(initialParticles.size());
+    long numberOfThreads = getNumberOfMarkovChains();
+
+    SequentialMonteCarloResult result;
+    std::vector<VectorType> particles = initialParticles;
+    VectorType negativeLogLikelihoods(numberOfParticles);
+
+    threadPool->parallelFor(numberOfThreads, [&](long threadIndex) {
+        MarkovChain *markovChain = markovChains[threadIndex].get();
+        for (long i = partitionBegin(numberOfParticles, numberOfThreads, threadIndex);
+             i < partitionBegin(numberOfParticles, numberOfThreads, threadIndex + 1); ++i) {
+            markovChain->setState(particles[i]);
+            negativeLogLikelihoods(i) = markovChain->getStateNegativeLogLikelihood();
+        }
+    });
+
+    std::uniform_real_distribution<double> uniformRealDistribution;
+    double coldness = 0;
+    result.coldnesses.emplace_back(coldness);
+
+    while (coldness < 1) {
+        double nextColdness = computeNextColdness(negativeLogLikelihoods, coldness);
+
+        VectorType logWeights = -(nextColdness - coldness) * negativeLogLikelihoods;
+        double maxLogWeight = logWeights.maxCoeff();
+        VectorType weights = (logWeights.array() - maxLogWeight).exp();
+        double sumOfWeights = weights.sum();
+        result.logEvidence += maxLogWeight + std::log(sumOfWeights) - std::log(numberOfParticles);
+        weights /= sumOfWeights;
+
+        std::vector<long> indices = systematicResampling(weights, uniformRealDistribution(randomNumberGenerator));
+        std::vector<VectorType> resampledParticles(numberOfParticles);
+        VectorType resampledNegativeLogLikelihoods(numberOfParticles);
+        for (long i = 0; i < numberOfParticles; ++i) {
+            resampledParticles[i] = particles[indices[i]];
+            resampledNegativeLogLikelihoods(i) = negativeLogLikelihoods(indices[i]);
+        }
+        particles.swap(resampledParticles);
+        negativeLogLikelihoods.swap(resampledNegativeLogLikelihoods);
+
+        coldness = nextColdness;
+        for (auto &markovChain: markovChains) {
+            markovChain->setParameter(ProposalParameter::COLDNESS, coldness);
+        }
+        double acceptanceRate = rejuvenate(randomNumberGenerator(), particles, negativeLogLikelihoods);
+
+        result.coldnesses.emplace_back(coldness);
+        result.acceptanceRates.emplace_back(acceptanceRate);
+    }
+
+    result.particles = std::move(particles);
+    result.negativeLogLikelihoods = std::vector<double>(negativeLogLikelihoods.data(),
+                                                        negativeLogLikelihoods.data() + numberOfParticles);
+    return result;
+}
+
+double hops::SequentialMonteCarlo::computeNextColdness(const VectorType &negativeLogLikelihoods,
+                                                       double coldness) const {
+    double targetEffectiveSampleSize = targetRelativeEffectiveSampleSize * negativeLogLikelihoods.rows();
+    double remainingColdness = 1 - coldness;
+    if (computeEffectiveSampleSize(-remainingColdness * negativeLogLikelihoods) >= targetEffectiveSampleSize) {
+        return 1;
+    }
+
+    double lower = 0;
+    double upper = remainingColdness;
+    for (int i = 0; i < 100 && upper - lower > 1e-12 * remainingColdness; ++i) {
+        double increment = (lower + upper) / 2;
+        if (computeEffectiveSampleSize(-increment * negativeLogLikelihoods) >= targetEffectiveSampleSize) {
+            lower = increment;
+        } else {
+            upper = increment;
+        }
+    }
+    // Guarantees progress, if the effective sample size collapses for any positive increment.
+    return coldness + (lower > 0 ? lower : upper);
+}
+
+double hops::SequentialMonteCarlo::rejuvenate(RandomNumberGenerator::result_type seed,
+                                              std::vector<VectorType> &particles,
+                                              VectorType &negativeLogLikelihoods) {
+    long numberOfParticles = static_cast<long>(particles.size());
+    long numberOfThreads = getNumberOfMarkovChains();
+    std::vector<double> acceptanceRates(numberOfParticles);
+
+    threadPool->parallelFor(numberOfThreads, [&](long threadIndex) {
+        MarkovChain *markovChain = markovChains[threadIndex].get();
+        for (long i = partitionBegin(numberOfParticles, numberOfThreads, threadIndex);
+             i < partitionBegin(numberOfParticles, numberOfThreads, threadIndex + 1); ++i) {
+            RandomNumberGenerator particleRandomNumberGenerator(seed, i);
+            markovChain->setState(particles[i]);
+            auto[acceptanceRate, state] = markovChain->draw(particleRandomNumberGenerator,
+                                                            numberOfRejuvenationSteps);
+            particles[i] = std::move(state);
+            negativeLogLikelihoods(i) = markovChain->getStateNegativeLogLikelihood();
+            acceptanceRates[i] = acceptanceRate;
+        }
+    });
+
+    double meanAcceptanceRate = 0;
+    for (double acceptanceRate: acceptanceRates) {
+        meanAcceptanceRate += acceptanceRate;
+    }
+    return meanAcceptanceRate / numberOfParticles;
+}
+
+std::vector<long> hops::SequentialMonteCarlo::systematicResampling(const VectorType &normalizedWeights,
+                                                                   double uniformOffset) {
+    long numberOfParticles = normalizedWeights.rows();
+    std::vector<long> indices(numberOfParticles);
+    double cumulativeWeight = normalizedWeights(0);
+    long j = 0;
+    for (long i = 0; i < numberOfParticles; ++i) {
+        double position = (i + uniformOffset) / numberOfParticles;
+        while (position > cumulativeWeight && j < numberOfParticles - 1) {
+            ++j;
+            cumulativeWeight += normalizedWeights(j);
+        }
+        indices[i] = j;
+    }
+    return indices;
+}
+
+double hops::SequentialMonteCarlo::computeEffectiveSampleSize(const VectorType &logWeights) {
+    VectorType weights = (logWeights.array() - logWeights.maxCoeff()).exp();
+    return weights.sum() * weights.sum() / weights.squaredNorm();
+}
+
+double hops::SequentialMonteCarlo::getTargetRelativeEffectiveSampleSize() const {
+    return targetRelativeEffectiveSampleSize;
+}
+
+void hops::SequentialMonteCarlo::setTargetRelativeEffectiveSampleSize(double newTargetRelativeEffectiveSampleSize) {
+    if (newTargetRelativeEffectiveSampleSize <= 0 || newTargetRelativeEffectiveSampleSize >= 1) {
+        throw std::invalid_argument("Target relative effective sample size has to be in (0, 1).");
+    }
+    targetRelativeEffectiveSampleSize = newTargetRelativeEffectiveSampleSize;
+}
+
+long hops::SequentialMonteCarlo::getNumberOfRejuvenationSteps() const {
+    return numberOfRejuvenationSteps;
+}
+
+void hops::SequentialMonteCarlo::setNumberOfRejuvenationSteps(long newNumberOfRejuvenationSteps) {
+    numberOfRejuvenationSteps = newNumberOfRejuvenationSteps;
+}
+
+long hops::SequentialMonteCarlo::getNumberOfMarkovChains() const {
+    return static_cast<long>(markovChains.size());
+}
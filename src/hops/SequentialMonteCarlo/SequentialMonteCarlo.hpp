@@ -0,0 +1,105 @@
+#ifndef HOPS_SEQUENTIALMONTECARLO_HPP
+#define HOPS_SEQUENTIALMONTECARLO_HPP
+
+#include <memory>
+#include <vector>
+
+#include "hops/MarkovChain/MarkovChain.hpp"
+#include "hops/Parallel/ThreadPool.hpp"
+#include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
+#include "hops/Utility/VectorType.hpp"
+
+namespace hops {
+    struct SequentialMonteCarloResult {
+        std::vector<VectorType> particles;
+        std::vector<double> negativeLogLikelihoods;
+        /**
+         * @brief Adaptively chosen tempering schedule, starting at 0 (uniform) and ending at 1 (posterior).
+         */
+        std::vector<double> coldnesses;
+        /**
+         * @brief Mean acceptance rate of the rejuvenation moves for every tempering step.
+         */
+        std::vector<double> acceptanceRates;
+        /**
+         * @brief Estimate of the log of the evidence, i.e. the likelihood integrated over the uniform distribution on
+         * the polytope.
+         */
+        double logEvidence = 0;
+    };
+
+    /**
+     * @brief Sequential Monte Carlo sampler, which moves a population of particles from the uniform distribution on the
+     * polytope to the posterior by tempering the likelihood with the coldness parameter of the ModelMixin.
+     * @details Every step chooses the next coldness by bisection, such that the effective sample size of the
+     * reweighted particles equals the target relative effective sample size. The particles are then resampled
+     * systematically and rejuvenated by the Markov chains. Rejuvenation runs in parallel on a thread pool with one thread per
+     * Markov chain. Every particle uses its own random number stream in every step, the result thus only depends on the seed
+     * and the number of Markov chains, if the proposals do not adapt.
+     */
+    class SequentialMonteCarlo {
+    public:
+        /**
+         * @param markovChains Markov chains with likelihood, e.g. from the MarkovChainFactory. Every chain is used by
+         * exactly one thread and must support the parameter ProposalParameter::COLDNESS.
+         */
+        explicit SequentialMonteCarlo(std::vector<std::unique_ptr<MarkovChain>> markovChains);
+
+        /**
+         * @brief Runs the sampler starting from particles, which are uniformly distributed on the polytope.
+         * @param randomNumberGenerator
+         * @param initialParticles
+         * @return
+         */
+        SequentialMonteCarloResult run(RandomNumberGenerator &randomNumberGenerator,
+                                       const std::vector<VectorType> &initialParticles);
+
+        /**
+         * @brief Runs the sampler, the initial particles are drawn by the Markov chains with coldness 0.
+         * @param randomNumberGenerator
+         * @param numberOfParticles
+         * @param thinning number of Markov chain steps between two initial particles.
+         * @return
+         */
+        SequentialMonteCarloResult run(RandomNumberGenerator &randomNumberGenerator,
+                                       long numberOfParticles,
+                                       long thinning);
+
+        [[nodiscard]] double getTargetRelativeEffectiveSampleSize() const;
+
+        void setTargetRelativeEffectiveSampleSize(double targetRelativeEffectiveSampleSize);
+
+        [[nodiscard]] long getNumberOfRejuvenationSteps() const;
+
+        void setNumberOfRejuvenationSteps(long numberOfRejuvenationSteps);
+
+        [[nodiscard]] long getNumberOfMarkovChains() const;
+
+        /**
+         * @brief Returns the indices of the resampled particles using systematic resampling.
+         * @param normalizedWeights weights summing up to one.
+         * @param uniformOffset offset of the systematic grid in [0, 1).
+         * @return
+         */
+        static std::vector<long> systematicResampling(const VectorType &normalizedWeights, double uniformOffset);
+
+        /**
+         * @brief Computes the effective sample size (sum w)^2 / sum w^2 of unnormalized log weights.
+         */
+        static double computeEffectiveSampleSize(const VectorType &logWeights);
+
+    private:
+        double computeNextColdness(const VectorType &negativeLogLikelihoods, double coldness) const;
+
+        double rejuvenate(RandomNumberGenerator::result_type seed,
+                          std::vector<VectorType> &particles,
+                          VectorType &negativeLogLikelihoods);
+
+        std::vector<std::unique_ptr<MarkovChain>> markovChains;
+        std::unique_ptr<ThreadPool> threadPool;
+        double targetRelativeEffectiveSampleSize = 0.5;
+        long numberOfRejuvenationSteps = 10;
+    };
+}
+
+#endif //HOPS_SEQUENTIALMONTECARLO_HPP
@@ -30,6 +30,11 @@ namespace hops {
             return matrix * vector + shift;
         }
 
+        void applyTo(const VectorType &vector, Eigen::Ref<VectorType> destination) const override {
+            destination.noalias() = matrix * vector;
+            destination += shift;
+        }
+
         VectorType revert(const VectorType &vector) const override {
             if (matrix.cols() == matrix.rows() && matrix.isLowerTriangular()) {
                 return matrix.template triangularView<Eigen::Lower>().solve(vector - shift);
@@ -19,6 +19,13 @@ namespace hops {
 
         virtual VectorType apply(const VectorType& vector) const { return vector; }
 
+        /**
+         * @brief Writes apply(vector) into destination. Overriding classes can avoid temporary storage.
+         */
+        virtual void applyTo(const VectorType& vector, Eigen::Ref<VectorType> destination) const {
+            destination = apply(vector);
+        }
+
         virtual VectorType revert(const VectorType& vector) const { return vector; }
 
         virtual std::unique_ptr<Transformation> copyTransformation() const = 0;
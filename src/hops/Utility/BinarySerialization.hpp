@@ -0,0 +1,146 @@
+#ifndef HOPS_BINARYSERIALIZATION_HPP
+#define HOPS_BINARYSERIALIZATION_HPP
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace hops::BinarySerialization {
+    /**
+     * @brief Writes values in the native binary representation of the machine.
+     * @details Checkpoints are meant to resume a run on the same machine or cluster, so neither endianness nor the
+     * size of the types is converted.
+     */
+    template<typename T>
+    std::enable_if_t<std::is_arithmetic_v<T>> write(std::ostream &out, const T &value) {
+        out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    std::enable_if_t<std::is_arithmetic_v<T>> read(std::istream &in, T &value) {
+        in.read(reinterpret_cast<char *>(&value), sizeof(T));
+        if (!in) {
+            throw std::runtime_error("Unexpected end of binary stream.");
+        }
+    }
+
+    inline void write(std::ostream &out, const std::string &value) {
+        write(out, static_cast<std::uint64_t>(value.size()));
+        out.write(value.data(), static_cast<std::streamsize>(value.size()));
+    }
+
+    inline void read(std::istream &in, std::string &value) {
+        std::uint64_t size;
+        read(in, size);
+        value.resize(size);
+        in.read(value.data(), static_cast<std::streamsize>(size));
+        if (!in) {
+            throw std::runtime_error("Unexpected end of binary stream.");
+        }
+    }
+
+    template<typename Scalar, int Rows, int Cols, int Options, int MaxRows, int MaxCols>
+    void write(std::ostream &out, const Eigen::Matrix<Scalar, Rows, Cols, Options, MaxRows, MaxCols> &matrix) {
+        write(out, static_cast<std::int64_t>(matrix.rows()));
+        write(out, static_cast<std::int64_t>(matrix.cols()));
+        out.write(reinterpret_cast<const char *>(matrix.data()),
+                  static_cast<std::streamsize>(sizeof(Scalar) * matrix.size()));
+    }
+
+    template<typename Scalar, int Rows, int Cols, int Options, int MaxRows, int MaxCols>
+    void read(std::istream &in, Eigen::Matrix<Scalar, Rows, Cols, Options, MaxRows, MaxCols> &matrix) {
+        std::int64_t rows;
+        std::int64_t cols;
+        read(in, rows);
+        read(in, cols);
+        matrix.resize(rows, cols);
+        in.read(reinterpret_cast<char *>(matrix.data()), static_cast<std::streamsize>(sizeof(Scalar) * matrix.size()));
+        if (!in) {
+            throw std::runtime_error("Unexpected end of binary stream.");
+        }
+    }
+
+    template<typename T>
+    void write(std::ostream &out, const std::vector<T> &values) {
+        write(out, static_cast<std::uint64_t>(values.size()));
+        for (const auto &value: values) {
+            write(out, value);
+        }
+    }
+
+    template<typename T>
+    void read(std::istream &in, std::vector<T> &values) {
+        std::uint64_t size;
+        read(in, size);
+        values.resize(size);
+        for (auto &value: values) {
+            read(in, value);
+        }
+    }
+
+    template<typename T>
+    void write(std::ostream &out, const std::optional<T> &value) {
+        write(out, value.has_value());
+        if (value) {
+            write(out, value.value());
+        }
+    }
+
+    template<typename T>
+    void read(std::istream &in, std::optional<T> &value) {
+        bool hasValue;
+        read(in, hasValue);
+        if (hasValue) {
+            T readValue;
+            read(in, readValue);
+            value = std::move(readValue);
+        } else {
+            value.reset();
+        }
+    }
+
+    /**
+     * @brief Writes the state of a normal distribution, which caches every second variate.
+     * @details The standard library only exposes the state through its exact text representation.
+     */
+    template<typename RealType>
+    void write(std::ostream &out, const std::normal_distribution<RealType> &distribution) {
+        std::ostringstream stream;
+        stream << distribution;
+        write(out, stream.str());
+    }
+
+    template<typename RealType>
+    void read(std::istream &in, std::normal_distribution<RealType> &distribution) {
+        std::string representation;
+        read(in, representation);
+        std::istringstream stream(representation);
+        stream >> distribution;
+    }
+
+    /**
+     * @brief Writes all values in order.
+     */
+    template<typename... Ts>
+    void writeAll(std::ostream &out, const Ts &... values) {
+        (write(out, values), ...);
+    }
+
+    /**
+     * @brief Reads all values in the order, in which they were written by writeAll.
+     */
+    template<typename... Ts>
+    void readAll(std::istream &in, Ts &... values) {
+        (read(in, values), ...);
+    }
+}
+
+#endif //HOPS_BINARYSERIALIZATION_HPP
@@ -10,6 +10,7 @@
 #include <utility>
 
 #include "hops/MarkovChain/MarkovChainFactory.hpp"
+#include "hops/FileWriter/AsyncFileWriter.hpp"
 #include "hops/FileWriter/FileWriter.hpp"
 #include "hops/FileWriter/FileWriterType.hpp"
 #include "hops/FileWriter/FileWriterFactory.hpp"
@@ -229,11 +230,12 @@ namespace hops {
         stream << std::fixed << std::setprecision(1) << fisherWeight;
         std::string fisherWeightString = stream.str();
 
-        std::unique_ptr<FileWriter> writer = FileWriterFactory::createFileWriter(
+        // Records are written on a background thread, so sampling continues while checkpoints are written.
+        std::unique_ptr<FileWriter> writer = std::make_unique<AsyncFileWriter>(FileWriterFactory::createFileWriter(
                 problemName + "_" +
                 markovChainTypeToShortString(chainType)
                 + (chainType == MarkovChainType::CSmMALA ? "_fw=" + fisherWeightString : "")
-                + (rounding ? "_rounded" : ""), FileWriterType::CSV);
+                + (rounding ? "_rounded" : ""), FileWriterType::CSV));
 
         if (tune) {
             bool isTuned = false;
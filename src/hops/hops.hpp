@@ -1,10 +1,24 @@
 #include "FileReader/CsvReader.hpp"
+#ifdef HOPS_HDF5_SUPPORT
+#include "FileReader/Hdf5Reader.hpp"
+#endif //HOPS_HDF5_SUPPORT
+#include "FileReader/MemoryMappedFile.hpp"
+#include "FileReader/NpyReader.hpp"
+#include "FileReader/PolytopeBundleReader.hpp"
 
+#include "FileWriter/AsyncFileWriter.hpp"
 #include "FileWriter/CsvWriter.hpp"
 #include "FileWriter/CsvWriterImpl.hpp"
 #include "FileWriter/FileWriter.hpp"
 #include "FileWriter/FileWriterFactory.hpp"
 #include "FileWriter/FileWriterType.hpp"
+#ifdef HOPS_HDF5_SUPPORT
+#include "FileWriter/Hdf5Writer.hpp"
+#endif //HOPS_HDF5_SUPPORT
+#include "FileWriter/NpyHeader.hpp"
+#include "FileWriter/NpyWriter.hpp"
+#include "FileWriter/PolytopeBundleFormat.hpp"
+#include "FileWriter/PolytopeBundleWriter.hpp"
 
 #include "LinearProgram/LinearProgram.hpp"
 #include "LinearProgram/LinearProgramFactory.hpp"
@@ -13,8 +27,10 @@
 
 #include "MarkovChain/Draw/IsAcceptProposalAvailable.hpp"
 #include "MarkovChain/Draw/IsCalculateLogAcceptanceProbabilityAvailable.hpp"
+#include "MarkovChain/Draw/LockstepMetropolisHastingsEnsemble.hpp"
 #include "MarkovChain/Draw/MetropolisHastingsFilter.hpp"
 #include "MarkovChain/Draw/NoOpDrawAdapter.hpp"
+#include "MarkovChain/Draw/SpeculativeMetropolisHastingsFilter.hpp"
 
 #include "MarkovChain/ParallelTempering/ParallelTempering.hpp"
 
@@ -30,7 +46,9 @@
 #include "MarkovChain/Proposal/DikinProposal.hpp"
 #include "MarkovChain/Proposal/GaussianProposal.hpp"
 #include "MarkovChain/Proposal/HitAndRunProposal.hpp"
+#include "MarkovChain/Proposal/IsComputeLogLikelihoodGradientIntoAvailable.hpp"
 #include "MarkovChain/Proposal/IsSetStepSizeAvailable.hpp"
+#include "MarkovChain/Proposal/JohnProposal.hpp"
 #include "MarkovChain/Proposal/ProposalFactory.hpp"
 #include "MarkovChain/Proposal/Proposal.hpp"
 #include "MarkovChain/Proposal/ProposalParameter.hpp"
@@ -38,15 +56,20 @@
 #include "MarkovChain/Proposal/ReversibleJumpProposal.hpp"
 #include "MarkovChain/Proposal/TruncatedGaussianProposal.hpp"
 #include "MarkovChain/Proposal/TruncatedNormalDistribution.hpp"
+#include "MarkovChain/Proposal/VaidyaProposal.hpp"
 
 #include "MarkovChain/Recorder/AcceptanceRateRecorder.hpp"
+#include "MarkovChain/Recorder/ContiguousStateRecorder.hpp"
 #include "MarkovChain/Recorder/IsAddMessageAvailabe.hpp"
 #include "MarkovChain/Recorder/IsClearRecordsAvailable.hpp"
 #include "MarkovChain/Recorder/IsStoreRecordAvailable.hpp"
 #include "MarkovChain/Recorder/IsWriteRecordsToFileAvailable.hpp"
 #include "MarkovChain/Recorder/MessageRecorder.hpp"
 #include "MarkovChain/Recorder/NegativeLogLikelihoodRecorder.hpp"
+#include "MarkovChain/Recorder/StateArena.hpp"
+#include "MarkovChain/Recorder/StateQuantizer.hpp"
 #include "MarkovChain/Recorder/StateRecorder.hpp"
+#include "MarkovChain/Recorder/StoragePrecision.hpp"
 #include "MarkovChain/Recorder/TimestampRecorder.hpp"
 
 #include "MarkovChain/Tuning/AcceptanceRateTarget.hpp"
@@ -59,6 +82,9 @@
 #include "MarkovChain/Tuning/ThompsonSamplingTuner.hpp"
 #include "MarkovChain/Tuning/TuningTarget.hpp"
 
+#include "MarkovChain/AdaptiveRounding.hpp"
+#include "MarkovChain/Checkpoint.hpp"
+#include "MarkovChain/DelayedAcceptanceModelMixin.hpp"
 #include "MarkovChain/MarkovChain.hpp"
 #include "MarkovChain/MarkovChainAdapter.hpp"
 #include "MarkovChain/MarkovChainFactory.hpp"
@@ -69,11 +95,17 @@
 
 #include "Model/DegenerateGaussian.hpp"
 #include "Model/Gaussian.hpp"
+#include "Model/GaussianProcessSurrogate.hpp"
 #include "Model/Mixture.hpp"
 #include "Model/Model.hpp"
 #include "Model/JumpableModel.hpp"
 #include "Model/Rosenbrock.hpp"
 
+#include "NestedSampling/DiffusiveNestedSampling.hpp"
+#include "NestedSampling/Level.hpp"
+#include "NestedSampling/LogLikelihoodValue.hpp"
+#include "NestedSampling/StaticNestedSampling.hpp"
+
 #ifdef HOPS_DNEST4_SUPPORT
 #include "NestedSampling/DNest4EnvironmentSingleton.hpp"
 #include "NestedSampling/DNest4Adapter.hpp"
@@ -111,12 +143,20 @@
 #include "Optimization/GaussianProcess.hpp"
 #include "Optimization/ThompsonSampling.hpp"
 
+#include "Parallel/MpiMultiChainRunner.hpp"
+#include "Parallel/MultiChainRunner.hpp"
+#include "Parallel/PooledWarmUp.hpp"
+#include "Parallel/ThreadPool.hpp"
+
 #include "Polytope/MaximumVolumeEllipsoid.hpp"
 #include "Polytope/NormalizePolytope.hpp"
+#include "Polytope/RoundingCache.hpp"
 #include "Polytope/SimplexFactory.hpp"
 
 #include "RandomNumberGenerator/RandomNumberGenerator.hpp"
 
+#include "SequentialMonteCarlo/SequentialMonteCarlo.hpp"
+
 #include "Statistics/Autocorrelation.hpp"
 #include "Statistics/Covariance.hpp"
 #include "Statistics/ExpectedSquaredJumpDistance.hpp"
@@ -126,6 +166,7 @@
 #include "Transformation/LinearTransformation.hpp"
 #include "Transformation/Transformation.hpp"
 
+#include "Utility/BinarySerialization.hpp"
 #include "Utility/DefaultDimensionNames.hpp"
 #include "Utility/HopsWithinHopsy.hpp"
 #include "Utility/KahanSum.hpp"
@@ -139,6 +180,9 @@
 
 
 #include "FileReader/CsvReader.cpp"
+#include "FileReader/MemoryMappedFile.cpp"
+#include "FileReader/NpyReader.cpp"
+#include "FileReader/PolytopeBundleReader.cpp"
 #include "FileReader/SbmlReader.cpp"
 
 #ifdef HOPS_HDF5_SUPPORT
@@ -146,21 +190,39 @@
 #include "FileWriter/Hdf5Writer.cpp"
 #endif //HOPS_HDF5_SUPPORT
 
+#include "FileWriter/AsyncFileWriter.cpp"
 #include "FileWriter/CsvWriter.cpp"
 #include "FileWriter/CsvWriterImpl.cpp"
 #include "FileWriter/FileWriterFactory.cpp"
+#include "FileWriter/NpyWriter.cpp"
+#include "FileWriter/PolytopeBundleWriter.cpp"
 
 #include "LinearProgram/GurobiEnvironmentSingleton.cpp"
 #include "LinearProgram/LinearProgram.cpp"
 #include "LinearProgram/LinearProgramClpImpl.cpp"
 #include "LinearProgram/LinearProgramGurobiImpl.cpp"
 
+#include "MarkovChain/Checkpoint.cpp"
+
 #include "MarkovChain/Tuning/BinarySearchAcceptanceRateTuner.cpp"
 #include "MarkovChain/Tuning/AcceptanceRateTuner.cpp"
 #include "MarkovChain/Tuning/ExpectedSquaredJumpDistanceTuner.cpp"
 #include "MarkovChain/Tuning/SimpleExpectedSquaredJumpDistanceTuner.cpp"
 
+#include "NestedSampling/DiffusiveNestedSampling.cpp"
+#include "NestedSampling/Level.cpp"
+#include "NestedSampling/LogLikelihoodValue.cpp"
+#include "NestedSampling/StaticNestedSampling.cpp"
+
+#include "Parallel/MpiMultiChainRunner.cpp"
+#include "Parallel/MultiChainRunner.cpp"
+#include "Parallel/PooledWarmUp.cpp"
+#include "Parallel/ThreadPool.cpp"
+
 #include "Polytope/MaximumVolumeEllipsoid.cpp"
+#include "Polytope/RoundingCache.cpp"
+
+#include "SequentialMonteCarlo/SequentialMonteCarlo.cpp"
 
 #include "Utility/DefaultDimensionNames.cpp"
 #include "Utility/KahanSum.cpp"
@@ -4,6 +4,8 @@
 #include <boost/test/unit_test.hpp>
 #include <Eigen/Core>
 #include <Eigen/Sparse>
+#include <fstream>
+#include <random>
 
 #include "hops/hops.hpp"
 
@@ -308,4 +310,57 @@ auto actualResult = hops::CsvReader::readMatrix<Eigen::MatrixXf>("../../resource
         BOOST_CHECK((actualResult - expectedResult).norm() <= 0);
     }
 
+    BOOST_AUTO_TEST_CASE(readLargeMatrixInParallel) {
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<int> uniform(-1000, 1000);
+        Eigen::MatrixXd expectedResult = Eigen::MatrixXd::NullaryExpr(5000, 40, [&]() {
+            int value = uniform(generator);
+            return value % 3 == 0 ? 0. : value / 7.;
+        });
+        {
+            std::ofstream out("large_matrix.csv");
+            out.precision(17);
+            for (long i = 0; i < expectedResult.rows(); ++i) {
+                for (long j = 0; j < expectedResult.cols(); ++j) {
+                    out << expectedResult(i, j) << (j + 1 < expectedResult.cols() ? ", " : "\r\n");
+                }
+            }
+        }
+
+        auto actualResult = hops::CsvReader::readMatrix<Eigen::MatrixXd>("large_matrix.csv");
+        BOOST_CHECK(actualResult == expectedResult);
+
+        auto actualSparseResult = hops::CsvReader::readMatrix<Eigen::SparseMatrix<double>>("large_matrix.csv");
+        BOOST_CHECK(Eigen::MatrixXd(actualSparseResult) == expectedResult);
+    }
+
+    BOOST_AUTO_TEST_CASE(readRecordsTerminatedBySemicolon) {
+        {
+            std::ofstream out("semicolon_vector.csv");
+            out << "1.5\n-2;\n3e2;\r\n";
+        }
+        BOOST_CHECK(hops::CsvReader::readVector<Eigen::VectorXd>("semicolon_vector.csv") ==
+                    Eigen::Vector3d(1.5, -2, 300));
+        {
+            std::ofstream out("semicolon_matrix.csv");
+            out << "1, 2;\n3, 4;\n";
+        }
+        BOOST_CHECK(hops::CsvReader::readMatrix<Eigen::MatrixXd>("semicolon_matrix.csv") ==
+                    (Eigen::Matrix2d() << 1, 2, 3, 4).finished());
+    }
+
+    BOOST_AUTO_TEST_CASE(throwOnMalformedMatrix) {
+        {
+            std::ofstream out("malformed_matrix.csv");
+            out << "1, 2, 3\n4, 5\n";
+        }
+        BOOST_CHECK_THROW(hops::CsvReader::readMatrix<Eigen::MatrixXd>("malformed_matrix.csv"), std::runtime_error);
+        {
+            std::ofstream out("malformed_matrix.csv");
+            out << "1, 2\n3, four\n";
+        }
+        BOOST_CHECK_THROW(hops::CsvReader::readMatrix<Eigen::MatrixXd>("malformed_matrix.csv"), std::runtime_error);
+        BOOST_CHECK_THROW(hops::CsvReader::readMatrix<Eigen::MatrixXd>("missing_matrix.csv"), std::runtime_error);
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,159 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE AsyncFileWriterTestSuite
+
+#include <atomic>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <Eigen/Core>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include "hops/FileWriter/AsyncFileWriter.hpp"
+#include "hops/FileWriter/CsvWriter.hpp"
+
+namespace {
+    /**
+     * @brief Records the descriptions of all writes and waits until it is released.
+     */
+    class FileWriterMock : public hops::FileWriter {
+    public:
+        FileWriterMock(std::vector<std::string> &descriptions, std::atomic<bool> &isReleased) :
+                descriptions(descriptions), isReleased(isReleased) {}
+
+        void write(const std::string &description, const std::vector<float> &) const override {
+            store(description);
+        }
+
+        void write(const std::string &description, const std::vector<double> &records) const override {
+            if (records.empty()) {
+                throw std::runtime_error("Disk is full.");
+            }
+            store(description);
+        }
+
+        void write(const std::string &description, const std::vector<long> &) const override {
+            store(description);
+        }
+
+        void write(const std::string &description, const std::vector<Eigen::VectorXf> &) const override {
+            store(description);
+        }
+
+        void write(const std::string &description, const std::vector<Eigen::VectorXd> &) const override {
+            store(description);
+        }
+
+        void write(const std::string &description, const std::vector<std::string> &) const override {
+            store(description);
+        }
+
+        void write(const std::string &description, const Eigen::MatrixXd &) const override {
+            store(description);
+        }
+
+        void write(const std::string &description, const Eigen::VectorXd &) const override {
+            store(description);
+        }
+
+    private:
+        void store(const std::string &description) const {
+            while (!isReleased) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            descriptions.emplace_back(description);
+        }
+
+        std::vector<std::string> &descriptions;
+        std::atomic<bool> &isReleased;
+    };
+
+    std::string readFile(const std::string &fileName) {
+        std::ifstream in(fileName);
+        std::stringstream content;
+        content << in.rdbuf();
+        return content.str();
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(AsyncFileWriterTestSuite)
+
+    BOOST_AUTO_TEST_CASE(WritesDoNotWaitForDiskAndKeepOrder) {
+        std::vector<std::string> descriptions;
+        std::atomic<bool> isReleased = false;
+        hops::AsyncFileWriter writer(std::make_unique<FileWriterMock>(descriptions, isReleased), 0);
+
+        std::vector<Eigen::VectorXd> states{Eigen::VectorXd::Ones(2)};
+        writer.write("states", states);
+        states.clear();
+        writer.write("neg_log_likelihoods", std::vector<double>{1.});
+        writer.write("timestamps", std::vector<long>{1});
+        BOOST_CHECK_EQUAL(writer.getNumberOfPendingBatches(), 3);
+
+        isReleased = true;
+        writer.flush();
+        BOOST_CHECK_EQUAL(writer.getNumberOfPendingBatches(), 0);
+        std::vector<std::string> expectedDescriptions{"states", "neg_log_likelihoods", "timestamps"};
+        BOOST_CHECK(descriptions == expectedDescriptions);
+    }
+
+    BOOST_AUTO_TEST_CASE(BlocksWhenTooManyBatchesArePending) {
+        std::vector<std::string> descriptions;
+        std::atomic<bool> isReleased = false;
+        hops::AsyncFileWriter writer(std::make_unique<FileWriterMock>(descriptions, isReleased), 1);
+
+        std::atomic<long> numberOfWrites = 0;
+        std::thread producer([&]() {
+            for (int i = 0; i < 5; ++i) {
+                writer.write("timestamps", std::vector<long>{i});
+                ++numberOfWrites;
+            }
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        // One batch is being written and one is pending
+        BOOST_CHECK_EQUAL(numberOfWrites, 2);
+
+        isReleased = true;
+        producer.join();
+        writer.flush();
+        BOOST_CHECK_EQUAL(descriptions.size(), 5);
+    }
+
+    BOOST_AUTO_TEST_CASE(FlushRethrowsErrorsOfDecoratedWriter) {
+        std::vector<std::string> descriptions;
+        std::atomic<bool> isReleased = true;
+        hops::AsyncFileWriter writer(std::make_unique<FileWriterMock>(descriptions, isReleased));
+
+        writer.write("acceptance_rates", std::vector<double>{});
+        writer.write("timestamps", std::vector<long>{1});
+        BOOST_CHECK_THROW(writer.flush(), std::runtime_error);
+        BOOST_CHECK_NO_THROW(writer.flush());
+        BOOST_CHECK_EQUAL(descriptions.size(), 1);
+    }
+
+    BOOST_AUTO_TEST_CASE(WritesSameFilesAsDecoratedCsvWriter) {
+        std::vector<Eigen::VectorXd> states{Eigen::VectorXd::Constant(3, 0.1), Eigen::VectorXd::Constant(3, -2.)};
+        Eigen::MatrixXd matrix = Eigen::MatrixXd::Identity(2, 2);
+        std::filesystem::remove_all("synchronous");
+        std::filesystem::remove_all("asynchronous");
+
+        hops::CsvWriter csvWriter("synchronous");
+        {
+            hops::AsyncFileWriter asyncWriter(std::make_unique<hops::CsvWriter>("asynchronous"), 2);
+            for (int checkpoint = 0; checkpoint < 3; ++checkpoint) {
+                csvWriter.write("states", states);
+                asyncWriter.write("states", states);
+                csvWriter.write("matrix", matrix);
+                asyncWriter.write("matrix", matrix);
+            }
+        }
+
+        for (const std::string description: {"states", "matrix"}) {
+            std::string content = readFile("asynchronous/asynchronous_" + description + ".csv");
+            BOOST_CHECK(!content.empty());
+            BOOST_CHECK_EQUAL(content, readFile("synchronous/synchronous_" + description + ".csv"));
+        }
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
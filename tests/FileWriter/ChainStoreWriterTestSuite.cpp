@@ -0,0 +1,106 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE ChainStoreWriterTestSuite
+
+#include <boost/test/unit_test.hpp>
+#include <Eigen/Core>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+#include "hops/FileReader/ChainStoreReader.hpp"
+#include "hops/FileWriter/ChainStoreWriter.hpp"
+
+namespace {
+    /**
+     * @brief Creates a chain, which changes a single coordinate per step like coordinate hit-and-run.
+     */
+    std::vector<Eigen::VectorXd> createCoordinateChain(long numberOfStates, long dimension) {
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<double> uniform;
+        std::vector<Eigen::VectorXd> states{Eigen::VectorXd::NullaryExpr(dimension, [&]() {
+            return uniform(generator);
+        })};
+        for (long i = 1; i < numberOfStates; ++i) {
+            states.push_back(states.back());
+            states.back()(i % dimension) = uniform(generator);
+        }
+        return states;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(ChainStoreWriterTestSuite)
+
+    BOOST_AUTO_TEST_CASE(ReadsRecordsBackByChunk) {
+        std::filesystem::remove_all("chain_store");
+        std::vector<Eigen::VectorXd> states = createCoordinateChain(50, 4);
+        hops::ChainStoreWriter writer("chain_store", 7);
+        writer.write("states", std::vector<Eigen::VectorXd>(states.begin(), states.begin() + 30));
+        writer.write("states", std::vector<Eigen::VectorXd>(states.begin() + 30, states.end()));
+        writer.write("timestamps", std::vector<long>{1, 2, 3});
+        writer.write("states_float", std::vector<Eigen::VectorXf>{Eigen::VectorXf::Constant(2, 0.5f)});
+        writer.write("states_quantized", std::vector<Eigen::Matrix<std::uint16_t, Eigen::Dynamic, 1>>{
+                Eigen::Matrix<std::uint16_t, Eigen::Dynamic, 1>::Constant(3, 1000)});
+        BOOST_CHECK_THROW(writer.write("states", std::vector<Eigen::VectorXd>{Eigen::VectorXd::Ones(2)}),
+                          std::runtime_error);
+        BOOST_CHECK_THROW(writer.write("states", std::vector<double>{1.}), std::runtime_error);
+
+        hops::ChainStoreReader reader(writer.getFileName("states"));
+        BOOST_CHECK_EQUAL(reader.getDimension(), 4);
+        BOOST_CHECK_EQUAL(reader.getNumberOfRecords(), 50);
+        // 30 records form 5 chunks, 20 records form 3 chunks.
+        BOOST_CHECK_EQUAL(reader.getNumberOfChunks(), 8);
+        BOOST_CHECK_EQUAL(reader.getFirstRecordOfChunk(5), 30);
+
+        auto chunk = reader.readChunk<double>(6);
+        BOOST_CHECK_EQUAL(chunk.cols(), 7);
+        BOOST_CHECK(Eigen::VectorXd(chunk.col(0)) == states[37]);
+        BOOST_CHECK_THROW(reader.readChunk<float>(6), std::runtime_error);
+
+        auto records = reader.readRecords<double>(12, 25);
+        BOOST_REQUIRE_EQUAL(records.size(), 25);
+        for (long i = 0; i < 25; ++i) {
+            BOOST_CHECK(records[i] == states[12 + i]);
+        }
+        BOOST_CHECK(reader.readRecords<double>() == states);
+        BOOST_CHECK_THROW(reader.readRecords<double>(40, 20), std::out_of_range);
+
+        hops::ChainStoreReader timestamps(writer.getFileName("timestamps"));
+        BOOST_CHECK_EQUAL(timestamps.readRecords<long>(2)[0](0), 3);
+        hops::ChainStoreReader floatStates(writer.getFileName("states_float"));
+        BOOST_CHECK(floatStates.readRecords<float>()[0] == Eigen::VectorXf::Constant(2, 0.5f));
+        hops::ChainStoreReader quantizedStates(writer.getFileName("states_quantized"));
+        BOOST_CHECK(quantizedStates.readRecords<std::uint16_t>()[0] ==
+                    (Eigen::Matrix<std::uint16_t, Eigen::Dynamic, 1>::Constant(3, 1000)));
+    }
+
+#ifdef HOPS_ZLIB_SUPPORT
+    BOOST_AUTO_TEST_CASE(CompressesCoordinateChains) {
+        std::filesystem::remove_all("chain_store_compressed");
+        std::vector<Eigen::VectorXd> states = createCoordinateChain(10000, 100);
+        hops::ChainStoreWriter writer("chain_store_compressed");
+        writer.write("states", states);
+
+        auto rawSize = static_cast<double>(states.size() * 100 * sizeof(double));
+        BOOST_CHECK_LT(std::filesystem::file_size(writer.getFileName("states")), 0.2 * rawSize);
+        BOOST_CHECK(hops::ChainStoreReader(writer.getFileName("states")).readRecords<double>() == states);
+    }
+#endif
+
+    BOOST_AUTO_TEST_CASE(ThrowsOnInvalidFiles) {
+        std::filesystem::remove_all("chain_store_invalid");
+        std::filesystem::create_directories("chain_store_invalid");
+        BOOST_CHECK_THROW(hops::ChainStoreReader("chain_store_invalid/missing.hcs"), std::runtime_error);
+        {
+            std::ofstream out("chain_store_invalid/no.hcs");
+            out << "not a chain store";
+        }
+        BOOST_CHECK_THROW(hops::ChainStoreReader("chain_store_invalid/no.hcs"), std::runtime_error);
+
+        hops::ChainStoreWriter writer("chain_store_invalid");
+        writer.write("states", createCoordinateChain(10, 3));
+        std::filesystem::resize_file(writer.getFileName("states"),
+                                     std::filesystem::file_size(writer.getFileName("states")) - 1);
+        BOOST_CHECK_THROW(hops::ChainStoreReader(writer.getFileName("states")), std::runtime_error);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -89,4 +89,36 @@ BOOST_AUTO_TEST_SUITE(CsvWriterImpl)
         BOOST_CHECK(actualOutput.str() == expectedOutput);
     }
 
+    BOOST_AUTO_TEST_CASE( formatDoublesInShortestExactRepresentation) {
+        std::vector<double> data{1.1, 0.1 + 0.2, 1e-300, 12345678.0, 0};
+        std::string expectedOutput = "1.1\n0.30000000000000004\n1e-300\n12345678\n0\n";
+
+        std::string actualOutput;
+        hops::internal::CsvWriterImpl::formatOneDimensionalRecords(actualOutput, data, 17, 0, data.size());
+
+        BOOST_CHECK_EQUAL(actualOutput, expectedOutput);
+        std::istringstream input(actualOutput);
+        for (double value: data) {
+            std::string line;
+            std::getline(input, line);
+            BOOST_CHECK_EQUAL(std::stod(line), value);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE( formatEigenDoubleVectorsWithPrecision) {
+        std::vector<Eigen::VectorXd> data;
+        Eigen::VectorXd v1(3);
+        v1 << 1.1, 5.6, 3.14159;
+        data.emplace_back(v1);
+        Eigen::VectorXd v2(1);
+        v2 << -1.1;
+        data.emplace_back(v2);
+        std::string expectedOutput = "1.1,5.6,3.14\n-1.1\n";
+
+        std::string actualOutput;
+        hops::internal::CsvWriterImpl::formatEigenVectorRecords(actualOutput, data, 3, 0, data.size());
+
+        BOOST_CHECK_EQUAL(actualOutput, expectedOutput);
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
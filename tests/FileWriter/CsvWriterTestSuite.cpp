@@ -0,0 +1,72 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE CsvWriterTestSuite
+
+#include <algorithm>
+#include <boost/test/unit_test.hpp>
+#include <Eigen/Core>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <sstream>
+
+#include "hops/FileReader/CsvReader.hpp"
+#include "hops/FileWriter/CsvWriter.hpp"
+
+namespace {
+    std::string readFile(const std::string &fileName) {
+        std::ifstream in(fileName);
+        std::stringstream content;
+        content << in.rdbuf();
+        return content.str();
+    }
+
+    std::vector<Eigen::VectorXd> createStates(long numberOfStates) {
+        std::mt19937 generator(42);
+        std::normal_distribution<double> normal;
+        std::vector<Eigen::VectorXd> states;
+        for (long i = 0; i < numberOfStates; ++i) {
+            states.emplace_back(Eigen::VectorXd::NullaryExpr(5, [&]() { return normal(generator); }));
+        }
+        return states;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(CsvWriterTestSuite)
+
+    BOOST_AUTO_TEST_CASE(WrittenStatesReadBackExactly) {
+        std::filesystem::remove_all("csv_exact");
+        std::vector<Eigen::VectorXd> states = createStates(100);
+        hops::CsvWriter writer("csv_exact");
+        writer.write("states", std::vector<Eigen::VectorXd>(states.begin(), states.begin() + 50));
+        writer.write("states", std::vector<Eigen::VectorXd>(states.begin() + 50, states.end()));
+
+        auto readStates = hops::CsvReader::readMatrix<Eigen::MatrixXd>("csv_exact/csv_exact_states.csv");
+        BOOST_REQUIRE_EQUAL(readStates.rows(), 100);
+        for (long i = 0; i < readStates.rows(); ++i) {
+            BOOST_CHECK(Eigen::VectorXd(readStates.row(i).transpose()) == states[i]);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(ParallelFormattingWritesSameFile) {
+        std::filesystem::remove_all("csv_serial");
+        std::filesystem::remove_all("csv_parallel");
+        std::vector<Eigen::VectorXd> states = createStates(100000);
+        std::vector<long> timestamps(states.size());
+        std::iota(timestamps.begin(), timestamps.end(), 1);
+
+        hops::CsvWriter serialWriter("csv_serial");
+        hops::CsvWriter parallelWriter("csv_parallel", 17, 3);
+        serialWriter.write("states", states);
+        parallelWriter.write("states", states);
+        serialWriter.write("timestamps", timestamps);
+        parallelWriter.write("timestamps", timestamps);
+
+        for (const std::string description: {"states", "timestamps"}) {
+            std::string content = readFile("csv_parallel/csv_parallel_" + description + ".csv");
+            BOOST_CHECK_EQUAL(std::count(content.begin(), content.end(), '\n'), 100000);
+            BOOST_CHECK(content == readFile("csv_serial/csv_serial_" + description + ".csv"));
+        }
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
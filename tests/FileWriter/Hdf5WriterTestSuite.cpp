@@ -0,0 +1,99 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE Hdf5WriterTestSuite
+
+#include <boost/test/unit_test.hpp>
+#include <Eigen/Core>
+#include <filesystem>
+
+#include "hops/FileReader/Hdf5Reader.hpp"
+#include "hops/FileWriter/Hdf5Writer.hpp"
+
+BOOST_AUTO_TEST_SUITE(Hdf5WriterTestSuite)
+
+    BOOST_AUTO_TEST_CASE(AppendsRecordsAcrossBatchesAndReadsThemBack) {
+        std::filesystem::remove("Hdf5WriterTest.hdf5");
+        std::vector<Eigen::VectorXd> firstStates{Eigen::VectorXd::Constant(3, 0.1), Eigen::VectorXd::Constant(3, -2.)};
+        std::vector<Eigen::VectorXd> secondStates{Eigen::VectorXd::LinSpaced(3, 1., 3.)};
+        {
+            hops::Hdf5Writer writer("Hdf5WriterTest", 4, 2);
+            BOOST_CHECK_EQUAL(writer.getPath(), "Hdf5WriterTest.hdf5");
+            writer.write("states", firstStates);
+            writer.write("neg_log_likelihoods", std::vector<double>{1.5, 2.5});
+            writer.write("timestamps", std::vector<long>{10, 20});
+            writer.write("tuning_successful", std::vector<std::string>{"skipped"});
+            writer.write("states_quantized", std::vector<Eigen::Matrix<std::uint16_t, Eigen::Dynamic, 1>>{
+                    Eigen::Matrix<std::uint16_t, Eigen::Dynamic, 1>::Constant(3, 65535)});
+        }
+        {
+            // Reopening the file appends, like the CsvWriter does.
+            hops::Hdf5Writer writer("Hdf5WriterTest.hdf5");
+            writer.write("states", secondStates);
+            writer.write("neg_log_likelihoods", std::vector<double>{3.5});
+            writer.write("timestamps", std::vector<long>{30});
+            writer.write("tuning_successful", std::vector<std::string>{"yes", "no"});
+        }
+
+        Eigen::MatrixXd states = hops::Hdf5Reader::readMatrix("Hdf5WriterTest.hdf5", "states");
+        BOOST_REQUIRE_EQUAL(states.rows(), 3);
+        BOOST_REQUIRE_EQUAL(states.cols(), 3);
+        BOOST_CHECK(states.row(0).transpose() == firstStates[0]);
+        BOOST_CHECK(states.row(1).transpose() == firstStates[1]);
+        BOOST_CHECK(states.row(2).transpose() == secondStates[0]);
+
+        BOOST_CHECK(hops::Hdf5Reader::readMatrix("Hdf5WriterTest.hdf5", "states_quantized") ==
+                    Eigen::MatrixXd::Constant(1, 3, 65535));
+
+        Eigen::VectorXd expectedNegativeLogLikelihoods(3);
+        expectedNegativeLogLikelihoods << 1.5, 2.5, 3.5;
+        BOOST_CHECK(hops::Hdf5Reader::readVector("Hdf5WriterTest.hdf5", "neg_log_likelihoods") ==
+                    expectedNegativeLogLikelihoods);
+        BOOST_CHECK(hops::Hdf5Reader::readLongs("Hdf5WriterTest.hdf5", "timestamps") ==
+                    std::vector<long>({10, 20, 30}));
+        BOOST_CHECK(hops::Hdf5Reader::readStrings("Hdf5WriterTest.hdf5", "tuning_successful") ==
+                    std::vector<std::string>({"skipped", "yes", "no"}));
+        BOOST_CHECK(hops::Hdf5Reader::readDescriptions("Hdf5WriterTest.hdf5") ==
+                    std::vector<std::string>({"neg_log_likelihoods", "states", "states_quantized", "timestamps",
+                                              "tuning_successful"}));
+    }
+
+    BOOST_AUTO_TEST_CASE(WritesMatricesRowWise) {
+        std::filesystem::remove("Hdf5WriterMatrixTest.hdf5");
+        Eigen::MatrixXd matrix(2, 3);
+        matrix << 1, 2, 3, 4, 5, 6;
+        {
+            hops::Hdf5Writer writer("Hdf5WriterMatrixTest.hdf5", 0);
+            writer.write("matrix", matrix);
+            writer.write("matrix", matrix);
+            writer.write("vector", Eigen::VectorXd(Eigen::VectorXd::Ones(4)));
+            BOOST_CHECK_THROW(writer.write("matrix", Eigen::MatrixXd(Eigen::MatrixXd::Zero(1, 2))),
+                              std::runtime_error);
+            BOOST_CHECK_THROW(writer.write("vector", matrix), std::runtime_error);
+        }
+
+        Eigen::MatrixXd expectedMatrix(4, 3);
+        expectedMatrix << matrix, matrix;
+        BOOST_CHECK(hops::Hdf5Reader::readMatrix("Hdf5WriterMatrixTest.hdf5", "matrix") == expectedMatrix);
+        BOOST_CHECK(hops::Hdf5Reader::readVector("Hdf5WriterMatrixTest.hdf5", "vector") == Eigen::VectorXd::Ones(4));
+        BOOST_CHECK_THROW(hops::Hdf5Reader::readVector("Hdf5WriterMatrixTest.hdf5", "matrix"), std::runtime_error);
+        BOOST_CHECK_THROW(hops::Hdf5Reader::readMatrix("Hdf5WriterMatrixTest.hdf5", "missing"), std::runtime_error);
+    }
+
+    BOOST_AUTO_TEST_CASE(CompressesCorrelatedSamples) {
+        std::filesystem::remove("Hdf5WriterCompressed.hdf5");
+        std::filesystem::remove("Hdf5WriterUncompressed.hdf5");
+        std::vector<Eigen::VectorXd> states(5000, Eigen::VectorXd::Zero(10));
+        for (size_t i = 1; i < states.size(); ++i) {
+            states[i] = states[i - 1];
+            states[i](i % 10) += 0.25;
+        }
+        {
+            hops::Hdf5Writer compressedWriter("Hdf5WriterCompressed.hdf5", 6);
+            hops::Hdf5Writer uncompressedWriter("Hdf5WriterUncompressed.hdf5", 0);
+            compressedWriter.write("states", states);
+            uncompressedWriter.write("states", states);
+        }
+        BOOST_CHECK_LT(std::filesystem::file_size("Hdf5WriterCompressed.hdf5"),
+                       std::filesystem::file_size("Hdf5WriterUncompressed.hdf5") / 2);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,87 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE NpyWriterTestSuite
+
+#include <boost/test/unit_test.hpp>
+#include <Eigen/Core>
+#include <filesystem>
+#include <fstream>
+
+#include "hops/FileReader/NpyReader.hpp"
+#include "hops/FileWriter/NpyWriter.hpp"
+
+BOOST_AUTO_TEST_SUITE(NpyWriterTestSuite)
+
+    BOOST_AUTO_TEST_CASE(WritesHeaderLikeNumpy) {
+        std::filesystem::remove_all("npy_header");
+        hops::NpyWriter writer("npy_header");
+        Eigen::MatrixXd matrix(2, 3);
+        matrix << 1, 2, 3, 4, 5, 6;
+        writer.write("matrix", matrix);
+
+        std::ifstream in(writer.getFileName("matrix"), std::ios::binary);
+        std::string header(128, '\0');
+        in.read(header.data(), 128);
+        BOOST_CHECK_EQUAL(header.substr(0, 8), std::string("\x93NUMPY\x01\x00", 8));
+        BOOST_CHECK_EQUAL(header[8], 118);
+        BOOST_CHECK_EQUAL(header[9], 0);
+        BOOST_CHECK_EQUAL(header.substr(10, 59), "{'descr': '<f8', 'fortran_order': False, 'shape': (2, 3), }");
+        BOOST_CHECK_EQUAL(header.back(), '\n');
+        BOOST_CHECK_EQUAL(std::filesystem::file_size(writer.getFileName("matrix")), 128 + 6 * sizeof(double));
+    }
+
+    BOOST_AUTO_TEST_CASE(AppendsRecordsAndMapsThemBack) {
+        std::filesystem::remove_all("npy_append");
+        hops::NpyWriter writer("npy_append");
+        std::vector<Eigen::VectorXd> firstStates{Eigen::VectorXd::Constant(3, 0.1), Eigen::VectorXd::Constant(3, -2.)};
+        std::vector<Eigen::VectorXd> secondStates{Eigen::VectorXd::LinSpaced(3, 1., 3.)};
+        writer.write("states", firstStates);
+        writer.write("states", secondStates);
+        writer.write("timestamps", std::vector<long>{10, 20});
+        writer.write("timestamps", std::vector<long>{30});
+        writer.write("states_float", std::vector<Eigen::VectorXf>{Eigen::VectorXf::Ones(2)});
+        writer.write("states_quantized", std::vector<Eigen::Matrix<std::uint16_t, Eigen::Dynamic, 1>>{
+                Eigen::Matrix<std::uint16_t, Eigen::Dynamic, 1>::Constant(2, 65535)});
+        writer.write("tuning_successful", std::vector<std::string>{"skipped"});
+        BOOST_CHECK_THROW(writer.write("states", std::vector<Eigen::VectorXd>{Eigen::VectorXd::Ones(2)}),
+                          std::runtime_error);
+        BOOST_CHECK_THROW(writer.write("states", std::vector<double>{1.}), std::runtime_error);
+
+        hops::NpyReader states(writer.getFileName("states"));
+        BOOST_CHECK(states.getShape() == std::vector<std::uint64_t>({3, 3}));
+        auto matrix = states.getMatrix<double>();
+        BOOST_CHECK(matrix.row(0).transpose() == firstStates[0]);
+        BOOST_CHECK(matrix.row(1).transpose() == firstStates[1]);
+        BOOST_CHECK(states.getRow<double>(2) == secondStates[0]);
+        BOOST_CHECK_THROW(states.getMatrix<float>(), std::runtime_error);
+
+        hops::NpyReader timestamps(writer.getFileName("timestamps"));
+        BOOST_CHECK(timestamps.getShape() == std::vector<std::uint64_t>({3}));
+        Eigen::Matrix<long, Eigen::Dynamic, 1> expectedTimestamps(3);
+        expectedTimestamps << 10, 20, 30;
+        BOOST_CHECK(timestamps.getMatrix<long>().col(0) == expectedTimestamps);
+
+        hops::NpyReader floatStates(writer.getFileName("states_float"));
+        BOOST_CHECK(floatStates.getMatrix<float>() == Eigen::MatrixXf::Ones(1, 2));
+        hops::NpyReader quantizedStates(writer.getFileName("states_quantized"));
+        BOOST_CHECK_EQUAL(quantizedStates.getDescr().substr(1), "u2");
+        BOOST_CHECK(quantizedStates.getMatrix<std::uint16_t>().cast<int>() == Eigen::MatrixXi::Constant(1, 2, 65535));
+        BOOST_CHECK(std::filesystem::exists("npy_append/npy_append_tuning_successful.txt"));
+    }
+
+    BOOST_AUTO_TEST_CASE(ThrowsOnInvalidFiles) {
+        std::filesystem::remove_all("npy_invalid");
+        std::filesystem::create_directories("npy_invalid");
+        BOOST_CHECK_THROW(hops::NpyReader("npy_invalid/missing.npy"), std::runtime_error);
+        {
+            std::ofstream out("npy_invalid/no.npy");
+            out << "not an npy file";
+        }
+        BOOST_CHECK_THROW(hops::NpyReader("npy_invalid/no.npy"), std::runtime_error);
+
+        hops::NpyWriter writer("npy_invalid");
+        writer.write("vector", Eigen::VectorXd(Eigen::VectorXd::Ones(10)));
+        std::filesystem::resize_file(writer.getFileName("vector"), 128 + 5 * sizeof(double));
+        BOOST_CHECK_THROW(hops::NpyReader(writer.getFileName("vector")), std::runtime_error);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
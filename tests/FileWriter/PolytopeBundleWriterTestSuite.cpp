@@ -0,0 +1,81 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE PolytopeBundleWriterTestSuite
+
+#include <boost/test/unit_test.hpp>
+#include <Eigen/Core>
+#include <Eigen/Sparse>
+#include <filesystem>
+#include <fstream>
+
+#include "hops/FileReader/PolytopeBundleReader.hpp"
+#include "hops/FileWriter/PolytopeBundleWriter.hpp"
+
+namespace {
+    Eigen::MatrixXd createA() {
+        Eigen::MatrixXd A(5, 3);
+        A << 1, 0, 0,
+                0, 1, 0,
+                0, 0, 1.5,
+                -1, -1, 0,
+                0, 0, -1;
+        return A;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(PolytopeBundleWriterTestSuite)
+
+    BOOST_AUTO_TEST_CASE(ReadsDenseBundle) {
+        Eigen::MatrixXd A = createA();
+        Eigen::VectorXd b = Eigen::VectorXd::LinSpaced(5, 1, 5);
+        Eigen::MatrixXd transformation = Eigen::MatrixXd::Random(3, 2);
+        Eigen::VectorXd shift = Eigen::VectorXd::Constant(3, 0.5);
+        Eigen::VectorXd start = Eigen::VectorXd::Constant(2, 0.1);
+        std::vector<std::string> names{"x", "", "flux_3"};
+        hops::PolytopeBundleWriter::write("dense.hpb", A, b, transformation, shift, start, names);
+
+        hops::PolytopeBundleReader reader("dense.hpb");
+        BOOST_CHECK(!reader.isASparse());
+        BOOST_CHECK(reader.getDenseA() == A);
+        BOOST_CHECK(Eigen::MatrixXd(reader.getA<Eigen::SparseMatrix<double>>()) == A);
+        BOOST_CHECK_THROW(reader.getSparseA(), std::runtime_error);
+        BOOST_CHECK(reader.getB() == b);
+        BOOST_CHECK(reader.getTransformation() == transformation);
+        BOOST_CHECK(reader.getShift() == shift);
+        BOOST_CHECK(reader.getStartingPoint() == start);
+        BOOST_CHECK(reader.getDimensionNames() == names);
+    }
+
+    BOOST_AUTO_TEST_CASE(ReadsSparseBundleWithoutOptionalEntries) {
+        Eigen::SparseMatrix<double> A = createA().sparseView();
+        Eigen::VectorXd b = Eigen::VectorXd::Ones(5);
+        hops::PolytopeBundleWriter::write("sparse.hpb", A, b);
+
+        hops::PolytopeBundleReader reader("sparse.hpb");
+        BOOST_CHECK(reader.isASparse());
+        BOOST_CHECK_EQUAL(reader.getSparseA().nonZeros(), 6);
+        BOOST_CHECK(Eigen::MatrixXd(reader.getSparseA()) == createA());
+        BOOST_CHECK(reader.getA<Eigen::MatrixXd>() == createA());
+        BOOST_CHECK_THROW(reader.getDenseA(), std::runtime_error);
+        BOOST_CHECK(reader.getB() == b);
+        BOOST_CHECK_EQUAL(reader.getTransformation().size(), 0);
+        BOOST_CHECK_EQUAL(reader.getShift().size(), 0);
+        BOOST_CHECK_EQUAL(reader.getStartingPoint().size(), 0);
+        BOOST_CHECK(reader.getDimensionNames().empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(ThrowsOnInvalidBundles) {
+        BOOST_CHECK_THROW(hops::PolytopeBundleWriter::write("invalid.hpb", createA(), Eigen::VectorXd::Ones(4)),
+                          std::invalid_argument);
+        BOOST_CHECK_THROW(hops::PolytopeBundleReader("missing.hpb"), std::runtime_error);
+        {
+            std::ofstream out("invalid.hpb");
+            out << "not a polytope bundle";
+        }
+        BOOST_CHECK_THROW(hops::PolytopeBundleReader("invalid.hpb"), std::runtime_error);
+
+        hops::PolytopeBundleWriter::write("truncated.hpb", createA(), Eigen::VectorXd::Ones(5));
+        std::filesystem::resize_file("truncated.hpb", std::filesystem::file_size("truncated.hpb") - 16);
+        BOOST_CHECK_THROW(hops::PolytopeBundleReader("truncated.hpb"), std::runtime_error);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,124 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE AdaptiveRoundingTestSuite
+
+#include <boost/test/unit_test.hpp>
+#include <Eigen/Core>
+
+#include "hops/MarkovChain/AdaptiveRounding.hpp"
+#include "hops/MarkovChain/Draw/MetropolisHastingsFilter.hpp"
+#include "hops/MarkovChain/ModelMixin.hpp"
+#include "hops/MarkovChain/Proposal/BallWalkProposal.hpp"
+#include "hops/MarkovChain/Proposal/HitAndRunProposal.hpp"
+#include "hops/Model/Gaussian.hpp"
+
+namespace {
+    using BallWalk = hops::BallWalkProposal<Eigen::MatrixXd, Eigen::VectorXd>;
+    using HitAndRun = hops::HitAndRunProposal<Eigen::MatrixXd, Eigen::VectorXd>;
+
+    Eigen::MatrixXd createA() {
+        Eigen::MatrixXd A(4, 2);
+        A << Eigen::MatrixXd::Identity(2, 2), -Eigen::MatrixXd::Identity(2, 2);
+        return A;
+    }
+
+    /**
+     * @brief Box [0, 100] x [0, 1], which is badly conditioned for the ball walk.
+     */
+    Eigen::VectorXd createB() {
+        Eigen::VectorXd b(4);
+        b << 100, 1, 0, 0;
+        return b;
+    }
+
+    bool isInterior(const Eigen::VectorXd &state) {
+        return ((createA() * state - createB()).array() < 0).all();
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(AdaptiveRounding)
+
+    BOOST_AUTO_TEST_CASE(RoundsElongatedPolytopeUntilConditionNumberIsStable) {
+        Eigen::VectorXd start(2);
+        start << 50, 0.5;
+        hops::MetropolisHastingsFilter chain(
+                hops::AdaptiveRounding<BallWalk>(BallWalk(createA(), createB(), start, 0.5), 500));
+        hops::RandomNumberGenerator randomNumberGenerator(42);
+
+        for (long i = 0; i < 30000 && chain.isRounding(); ++i) {
+            chain.draw(randomNumberGenerator);
+            BOOST_REQUIRE(isInterior(chain.getState()));
+        }
+
+        BOOST_CHECK(!chain.isRounding());
+        BOOST_CHECK_GE(chain.getNumberOfRoundings(), 2);
+        BOOST_CHECK_LT(chain.getConditionNumbers().back(), 5);
+        const Eigen::MatrixXd &matrix = chain.getRoundingTransformation().getMatrix();
+        Eigen::MatrixXd covariance = matrix * matrix.transpose();
+        BOOST_CHECK_GT(covariance(0, 0) / covariance(1, 1), 100);
+
+        // After rounding stopped, the transformation stays fixed.
+        Eigen::MatrixXd finalMatrix = matrix;
+        for (long i = 0; i < 2000; ++i) {
+            chain.draw(randomNumberGenerator);
+            BOOST_REQUIRE(isInterior(chain.getState()));
+        }
+        BOOST_CHECK(chain.getRoundingTransformation().getMatrix() == finalMatrix);
+    }
+
+    BOOST_AUTO_TEST_CASE(KeepsStateStepSizeAndDimensionNamesWhenRounding) {
+        Eigen::VectorXd start(2);
+        start << 3, 0.25;
+        hops::AdaptiveRounding<BallWalk> proposal(BallWalk(createA(), createB(), start, 0.3), 100);
+        proposal.setDimensionNames({"a", "b"});
+        hops::RandomNumberGenerator randomNumberGenerator(1);
+
+        for (long i = 0; i < 100; ++i) {
+            proposal.propose(randomNumberGenerator);
+            if (proposal.computeLogAcceptanceProbability() > std::log(0.5)) {
+                proposal.acceptProposal();
+            }
+        }
+        Eigen::VectorXd stateBeforeRounding = proposal.getState();
+        // The 101st proposal rounds the polytope first.
+        proposal.propose(randomNumberGenerator);
+
+        BOOST_CHECK_EQUAL(proposal.getNumberOfRoundings(), 1);
+        BOOST_CHECK(proposal.getState().isApprox(stateBeforeRounding));
+        BOOST_CHECK_EQUAL(proposal.getStepSize().value(), 0.3);
+        BOOST_CHECK(proposal.getDimensionNames() == std::vector<std::string>({"a", "b"}));
+        BOOST_CHECK(proposal.getA() == createA());
+        BOOST_CHECK(proposal.getB() == createB());
+    }
+
+    BOOST_AUTO_TEST_CASE(WorksWithMixedInModel) {
+        Eigen::VectorXd start(2);
+        start << 50, 0.5;
+        Eigen::VectorXd mean(2);
+        mean << 60, 0.5;
+        Eigen::MatrixXd covariance(2, 2);
+        covariance << 100, 0, 0, 0.01;
+        hops::MetropolisHastingsFilter chain(hops::ModelMixin(
+                hops::AdaptiveRounding<HitAndRun>(HitAndRun(createA(), createB(), start), 300),
+                hops::Gaussian(mean, covariance)));
+        hops::RandomNumberGenerator randomNumberGenerator(7);
+
+        for (long i = 0; i < 20000; ++i) {
+            chain.draw(randomNumberGenerator);
+        }
+        Eigen::VectorXd sampleMean = Eigen::VectorXd::Zero(2);
+        for (long i = 0; i < 20000; ++i) {
+            chain.draw(randomNumberGenerator);
+            BOOST_REQUIRE(isInterior(chain.getState()));
+            sampleMean += chain.getState() / 20000;
+        }
+        BOOST_CHECK_SMALL(sampleMean(0) - mean(0), 2.);
+        BOOST_CHECK_SMALL(sampleMean(1) - mean(1), 0.02);
+    }
+
+    BOOST_AUTO_TEST_CASE(ThrowsIfRoundingIntervalIsTooShort) {
+        BOOST_CHECK_THROW(
+                hops::AdaptiveRounding<BallWalk>(BallWalk(createA(), createB(), Eigen::VectorXd::Constant(2, 0.5)), 2),
+                std::invalid_argument);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
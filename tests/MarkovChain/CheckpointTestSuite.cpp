@@ -0,0 +1,211 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE CheckpointTestSuite
+
+#include <boost/test/unit_test.hpp>
+#include <Eigen/Core>
+#include <filesystem>
+#include <sstream>
+
+#include "hops/MarkovChain/AdaptiveRounding.hpp"
+#include "hops/MarkovChain/Checkpoint.hpp"
+#include "hops/MarkovChain/MarkovChainFactory.hpp"
+#include "hops/MarkovChain/Proposal/AdaptiveMetropolisProposal.hpp"
+#include "hops/MarkovChain/Proposal/BilliardAdaptiveMetropolisProposal.hpp"
+#include "hops/MarkovChain/Proposal/BilliardWalkProposal.hpp"
+#include "hops/MarkovChain/Proposal/HitAndRunProposal.hpp"
+#include "hops/MarkovChain/Proposal/TruncatedGaussianProposal.hpp"
+#include "hops/Model/Gaussian.hpp"
+#include "hops/Parallel/MultiChainRunner.hpp"
+
+namespace {
+    Eigen::MatrixXd createA() {
+        Eigen::MatrixXd A(4, 2);
+        A << Eigen::MatrixXd::Identity(2, 2), -Eigen::MatrixXd::Identity(2, 2);
+        return A;
+    }
+
+    Eigen::VectorXd createB() {
+        return 5 * Eigen::VectorXd::Ones(4);
+    }
+
+    Eigen::VectorXd createStart() {
+        return Eigen::VectorXd::Zero(2);
+    }
+
+    hops::Gaussian createModel() {
+        return hops::Gaussian(Eigen::VectorXd::Constant(2, 1.), Eigen::MatrixXd::Identity(2, 2));
+    }
+
+    std::unique_ptr<hops::MarkovChain> createMarkovChain(hops::MarkovChainType type) {
+        return hops::MarkovChainFactory::createMarkovChain(type, createA(), createB(), createStart(), createModel());
+    }
+
+    /**
+     * @brief The factory computes the maximum volume ellipsoid with a linear program, so it is passed explicitly.
+     */
+    template<typename AdaptiveMetropolisProposal>
+    std::unique_ptr<hops::MarkovChain> createAdaptiveMetropolisMarkovChain() {
+        return hops::MarkovChainFactory::createMarkovChain<Eigen::MatrixXd, Eigen::VectorXd, hops::Gaussian>(
+                AdaptiveMetropolisProposal(createA(), createB(), createStart(), Eigen::MatrixXd::Identity(2, 2)),
+                createModel());
+    }
+
+    std::vector<Eigen::VectorXd> draw(hops::MarkovChain &markovChain,
+                                      hops::RandomNumberGenerator &randomNumberGenerator,
+                                      long numberOfSamples) {
+        std::vector<Eigen::VectorXd> states;
+        for (long i = 0; i < numberOfSamples; ++i) {
+            states.emplace_back(markovChain.draw(randomNumberGenerator).second);
+        }
+        return states;
+    }
+
+    /**
+     * @brief Checks that a chain continues bitwise identically from a checkpoint written after warmUp steps.
+     */
+    void checkResumesIdentically(const std::function<std::unique_ptr<hops::MarkovChain>()> &createMarkovChain,
+                                 long warmUp = 300) {
+        std::unique_ptr<hops::MarkovChain> markovChain = createMarkovChain();
+        hops::RandomNumberGenerator randomNumberGenerator(42);
+        draw(*markovChain, randomNumberGenerator, warmUp);
+
+        std::stringstream checkpoint;
+        hops::Checkpoint::write(checkpoint, *markovChain, randomNumberGenerator);
+        std::vector<Eigen::VectorXd> expectedStates = draw(*markovChain, randomNumberGenerator, 100);
+
+        std::unique_ptr<hops::MarkovChain> resumedMarkovChain = createMarkovChain();
+        hops::RandomNumberGenerator resumedRandomNumberGenerator(0);
+        hops::Checkpoint::read(checkpoint, *resumedMarkovChain, resumedRandomNumberGenerator);
+        std::vector<Eigen::VectorXd> states = draw(*resumedMarkovChain, resumedRandomNumberGenerator, 100);
+
+        for (size_t i = 0; i < states.size(); ++i) {
+            BOOST_REQUIRE(states[i] == expectedStates[i]);
+        }
+        BOOST_CHECK_EQUAL(resumedMarkovChain->getStateNegativeLogLikelihood(),
+                          markovChain->getStateNegativeLogLikelihood());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(Checkpoint)
+
+    BOOST_AUTO_TEST_CASE(ChainsResumeBitwiseIdentically) {
+        for (hops::MarkovChainType type: {hops::MarkovChainType::BallWalk,
+                                          hops::MarkovChainType::BilliardMALA,
+                                          hops::MarkovChainType::CoordinateHitAndRun,
+                                          hops::MarkovChainType::CSmMALA,
+                                          hops::MarkovChainType::DikinWalk,
+                                          hops::MarkovChainType::Gaussian,
+                                          hops::MarkovChainType::HitAndRun,
+                                          hops::MarkovChainType::JohnWalk,
+                                          hops::MarkovChainType::VaidyaWalk}) {
+            BOOST_TEST_CONTEXT(hops::markovChainTypeToFullString(type)) {
+                checkResumesIdentically([type]() { return createMarkovChain(type); });
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(ProposalsWithoutMarkovChainTypeResumeBitwiseIdentically) {
+        checkResumesIdentically([]() {
+            return hops::MarkovChainFactory::createMarkovChain<Eigen::MatrixXd, Eigen::VectorXd>(
+                    hops::BilliardWalkProposal<Eigen::MatrixXd>(createA(), createB(), createStart(), 10, 2.));
+        });
+        checkResumesIdentically([]() {
+            return hops::MarkovChainFactory::createMarkovChain<Eigen::MatrixXd, Eigen::VectorXd>(
+                    hops::TruncatedGaussianProposal<Eigen::MatrixXd, Eigen::VectorXd>(
+                            createA(), createB(), createStart(), createModel()));
+        });
+    }
+
+    BOOST_AUTO_TEST_CASE(AdaptiveMetropolisResumesAfterAdaptation) {
+        // The checkpoints are written after the warm up of 100 steps, so they contain the adapted covariance.
+        checkResumesIdentically(createAdaptiveMetropolisMarkovChain<hops::AdaptiveMetropolisProposal<Eigen::MatrixXd>>,
+                                2000);
+        checkResumesIdentically(
+                createAdaptiveMetropolisMarkovChain<hops::BilliardAdaptiveMetropolisProposal<Eigen::MatrixXd>>, 2000);
+    }
+
+    BOOST_AUTO_TEST_CASE(UniformAndRoundedChainsResumeBitwiseIdentically) {
+        checkResumesIdentically([]() {
+            return hops::MarkovChainFactory::createMarkovChain(hops::MarkovChainType::HitAndRun,
+                                                               createA(), createB(), createStart());
+        });
+        checkResumesIdentically([]() {
+            return hops::MarkovChainFactory::createMarkovChain(hops::MarkovChainType::Gaussian,
+                                                               createA(), createB(), createStart(),
+                                                               Eigen::MatrixXd(2 * Eigen::MatrixXd::Identity(2, 2)),
+                                                               Eigen::VectorXd(Eigen::VectorXd::Ones(2)));
+        });
+    }
+
+    BOOST_AUTO_TEST_CASE(AdaptiveRoundingResumesBitwiseIdentically) {
+        using HitAndRun = hops::HitAndRunProposal<Eigen::MatrixXd, Eigen::VectorXd>;
+        auto createMarkovChain = []() {
+            return hops::MarkovChainFactory::createMarkovChain<Eigen::MatrixXd, Eigen::VectorXd>(
+                    hops::AdaptiveRounding<HitAndRun>(HitAndRun(createA(), createB(), createStart()), 100));
+        };
+        // Checkpoints within and after the first rounding
+        checkResumesIdentically(createMarkovChain, 150);
+        checkResumesIdentically(createMarkovChain, 1000);
+    }
+
+    BOOST_AUTO_TEST_CASE(MultiChainRunnerResumesFromFile) {
+        auto createMarkovChains = []() {
+            std::vector<std::unique_ptr<hops::MarkovChain>> markovChains;
+            markovChains.emplace_back(createMarkovChain(hops::MarkovChainType::Gaussian));
+            markovChains.emplace_back(
+                    createAdaptiveMetropolisMarkovChain<hops::AdaptiveMetropolisProposal<Eigen::MatrixXd>>());
+            markovChains.emplace_back(createMarkovChain(hops::MarkovChainType::CSmMALA));
+            return markovChains;
+        };
+        std::string fileName = "MultiChainRunnerCheckpoint.bin";
+        std::filesystem::remove(fileName);
+
+        hops::MultiChainRunner runner(createMarkovChains(), 42, 2);
+        runner.draw(200);
+        runner.writeCheckpoint(fileName);
+        BOOST_CHECK(!std::filesystem::exists(fileName + ".tmp"));
+        hops::MultiChainResult expectedResult = runner.draw(100);
+
+        hops::MultiChainRunner resumedRunner(createMarkovChains(), 7, 1);
+        resumedRunner.readCheckpoint(fileName);
+        hops::MultiChainResult result = resumedRunner.draw(100);
+
+        for (size_t chain = 0; chain < result.states.size(); ++chain) {
+            for (size_t i = 0; i < result.states[chain].size(); ++i) {
+                BOOST_REQUIRE(result.states[chain][i] == expectedResult.states[chain][i]);
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(ThrowsOnCorruptCheckpoints) {
+        std::unique_ptr<hops::MarkovChain> markovChain = createMarkovChain(hops::MarkovChainType::Gaussian);
+        hops::RandomNumberGenerator randomNumberGenerator(42);
+        std::stringstream checkpoint;
+        hops::Checkpoint::write(checkpoint, *markovChain, randomNumberGenerator);
+        std::string bytes = checkpoint.str();
+
+        std::stringstream truncatedCheckpoint(bytes.substr(0, bytes.size() - 10));
+        BOOST_CHECK_THROW(hops::Checkpoint::read(truncatedCheckpoint, *markovChain, randomNumberGenerator),
+                          std::runtime_error);
+
+        std::string wrongVersion = bytes;
+        wrongVersion[8] = static_cast<char>(hops::Checkpoint::FORMAT_VERSION + 1);
+        std::stringstream wrongVersionCheckpoint(wrongVersion);
+        BOOST_CHECK_THROW(hops::Checkpoint::read(wrongVersionCheckpoint, *markovChain, randomNumberGenerator),
+                          std::runtime_error);
+
+        std::stringstream noCheckpoint("not a checkpoint");
+        BOOST_CHECK_THROW(hops::Checkpoint::read(noCheckpoint, *markovChain, randomNumberGenerator),
+                          std::runtime_error);
+
+        Eigen::MatrixXd A(6, 3);
+        A << Eigen::MatrixXd::Identity(3, 3), -Eigen::MatrixXd::Identity(3, 3);
+        std::unique_ptr<hops::MarkovChain> otherMarkovChain = hops::MarkovChainFactory::createMarkovChain(
+                hops::MarkovChainType::Gaussian, A, Eigen::VectorXd(Eigen::VectorXd::Ones(6)),
+                Eigen::VectorXd(Eigen::VectorXd::Zero(3)));
+        std::stringstream otherCheckpoint(bytes);
+        BOOST_CHECK_THROW(hops::Checkpoint::read(otherCheckpoint, *otherMarkovChain, randomNumberGenerator),
+                          std::runtime_error);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,102 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE DelayedAcceptanceModelMixinTestSuite
+
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+
+#include "hops/MarkovChain/DelayedAcceptanceModelMixin.hpp"
+#include "hops/MarkovChain/Proposal/GaussianProposal.hpp"
+#include "hops/Model/Gaussian.hpp"
+#include "hops/Model/GaussianProcessSurrogate.hpp"
+
+namespace {
+    using ProposalType = hops::GaussianProposal<Eigen::MatrixXd, Eigen::VectorXd>;
+    using MixinType = hops::DelayedAcceptanceModelMixin<ProposalType, hops::Gaussian>;
+
+    ProposalType createProposal() {
+        Eigen::MatrixXd A(2, 1);
+        A << 1, -1;
+        Eigen::VectorXd b(2);
+        b << 5, 5;
+        return ProposalType(A, b, Eigen::VectorXd::Zero(1), 1);
+    }
+
+    hops::Gaussian createModel() {
+        return hops::Gaussian(Eigen::VectorXd::Ones(1), Eigen::MatrixXd::Identity(1, 1));
+    }
+
+    std::pair<double, double> sampleMeanAndVariance(MixinType &mixin, long numberOfSamples) {
+        hops::RandomNumberGenerator randomNumberGenerator(42);
+        std::uniform_real_distribution<double> uniformRealDistribution;
+        double sum = 0;
+        double sumOfSquares = 0;
+        for (long i = 0; i < numberOfSamples; ++i) {
+            mixin.propose(randomNumberGenerator);
+            if (std::log(uniformRealDistribution(randomNumberGenerator)) < mixin.computeLogAcceptanceProbability()) {
+                mixin.acceptProposal();
+            }
+            double x = mixin.getState()(0);
+            sum += x;
+            sumOfSquares += x * x;
+        }
+        double mean = sum / numberOfSamples;
+        return {mean, sumOfSquares / numberOfSamples - mean * mean};
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(DelayedAcceptanceModelMixin)
+
+    BOOST_AUTO_TEST_CASE(ExactSurrogateOnlyRejectsInFirstStage) {
+        MixinType mixin(createProposal(), createModel(), std::make_unique<hops::Gaussian>(createModel()));
+        hops::RandomNumberGenerator randomNumberGenerator(42);
+        for (int i = 0; i < 100; ++i) {
+            mixin.propose(randomNumberGenerator);
+            double logAcceptanceProbability = mixin.computeLogAcceptanceProbability();
+            BOOST_CHECK(logAcceptanceProbability == -std::numeric_limits<double>::infinity() ||
+                        std::abs(logAcceptanceProbability) < 1e-12);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(WrongSurrogateKeepsPosteriorExact) {
+        auto surrogate = std::make_unique<hops::Gaussian>(-Eigen::VectorXd::Ones(1),
+                                                          4 * Eigen::MatrixXd::Identity(1, 1));
+        MixinType mixin(createProposal(), createModel(), std::move(surrogate));
+
+        auto[mean, variance] = sampleMeanAndVariance(mixin, 200000);
+        BOOST_CHECK_SMALL(mean - 1, 0.05);
+        BOOST_CHECK_SMALL(variance - 1, 0.05);
+        BOOST_CHECK_LT(mixin.getNumberOfModelEvaluations(), mixin.getNumberOfProposals());
+    }
+
+    BOOST_AUTO_TEST_CASE(GaussianProcessSurrogateSavesModelEvaluations) {
+        MixinType mixin(createProposal(), createModel(), std::make_unique<hops::GaussianProcessSurrogate>(2., 1., 50));
+
+        auto[mean, variance] = sampleMeanAndVariance(mixin, 20000);
+        BOOST_CHECK_SMALL(mean - 1, 0.1);
+        BOOST_CHECK_SMALL(variance - 1, 0.1);
+
+        auto &surrogate = dynamic_cast<const hops::GaussianProcessSurrogate &>(mixin.getSurrogate());
+        BOOST_CHECK(surrogate.isFull());
+        // Once the surrogate is accurate, only proposals which are likely to be accepted need the expensive model.
+        BOOST_CHECK_LT(mixin.getNumberOfModelEvaluations(), 0.8 * mixin.getNumberOfProposals());
+    }
+
+    BOOST_AUTO_TEST_CASE(GaussianProcessSurrogateInterpolatesObservations) {
+        hops::GaussianProcessSurrogate surrogate(5, 1);
+        hops::Gaussian model = createModel();
+        for (double x = -2; x <= 2; x += 0.5) {
+            surrogate.addObservation(Eigen::VectorXd::Constant(1, x),
+                                     model.computeNegativeLogLikelihood(Eigen::VectorXd::Constant(1, x)));
+        }
+        BOOST_CHECK_EQUAL(surrogate.getNumberOfObservations(), 9);
+        for (double x: {-1.75, -0.25, 0.5, 1.25}) {
+            Eigen::VectorXd point = Eigen::VectorXd::Constant(1, x);
+            BOOST_CHECK_SMALL(surrogate.computeNegativeLogLikelihood(point) - model.computeNegativeLogLikelihood(point),
+                              0.05);
+        }
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
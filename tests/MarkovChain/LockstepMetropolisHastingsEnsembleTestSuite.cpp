@@ -0,0 +1,112 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE LockstepMetropolisHastingsEnsembleTestSuite
+
+#include <boost/test/unit_test.hpp>
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "hops/MarkovChain/Draw/LockstepMetropolisHastingsEnsemble.hpp"
+#include "hops/MarkovChain/Draw/MetropolisHastingsFilter.hpp"
+#include "hops/MarkovChain/ModelMixin.hpp"
+#include "hops/MarkovChain/ModelWrapper.hpp"
+#include "hops/MarkovChain/Proposal/GaussianProposal.hpp"
+#include "hops/Model/Gaussian.hpp"
+#include "hops/Model/Rosenbrock.hpp"
+
+namespace {
+    using ProposalType = hops::GaussianProposal<Eigen::MatrixXd, Eigen::VectorXd>;
+
+    Eigen::MatrixXd createA() {
+        Eigen::MatrixXd A(4, 2);
+        A << Eigen::MatrixXd::Identity(2, 2), -Eigen::MatrixXd::Identity(2, 2);
+        return A;
+    }
+
+    std::vector<ProposalType> createProposals(long numberOfChains, double stepSize) {
+        std::vector<ProposalType> proposals;
+        for (long i = 0; i < numberOfChains; ++i) {
+            Eigen::VectorXd start = Eigen::VectorXd::Constant(2, -0.5 + static_cast<double>(i) / numberOfChains);
+            proposals.emplace_back(createA(), Eigen::VectorXd::Ones(4), start, stepSize);
+        }
+        return proposals;
+    }
+
+    /**
+     * @brief Checks that every chain of the ensemble draws the same states as a sequential chain with the same random
+     * number generator.
+     */
+    void checkEqualsSequentialChains(const std::shared_ptr<hops::Model> &model, double stepSize, double coldness) {
+        long numberOfChains = 6;
+        std::vector<ProposalType> proposals = createProposals(numberOfChains, stepSize);
+        hops::LockstepMetropolisHastingsEnsemble<ProposalType> ensemble(proposals, model, coldness);
+
+        std::vector<hops::MetropolisHastingsFilter<hops::ModelMixin<ProposalType, hops::ModelWrapper>>> chains;
+        std::vector<hops::RandomNumberGenerator> ensembleRandomNumberGenerators;
+        std::vector<hops::RandomNumberGenerator> randomNumberGenerators;
+        for (long i = 0; i < numberOfChains; ++i) {
+            chains.emplace_back(hops::ModelMixin(proposals[i], hops::ModelWrapper(model), coldness));
+            ensembleRandomNumberGenerators.emplace_back(42, i);
+            randomNumberGenerators.emplace_back(42, i);
+        }
+
+        Eigen::VectorXd totalAcceptanceRates = Eigen::VectorXd::Zero(numberOfChains);
+        for (long step = 0; step < 200; ++step) {
+            Eigen::VectorXd acceptanceRates = ensemble.draw(ensembleRandomNumberGenerators, 2);
+            totalAcceptanceRates += acceptanceRates;
+            for (long i = 0; i < numberOfChains; ++i) {
+                double acceptanceRate = (chains[i].draw(randomNumberGenerators[i]) +
+                                         chains[i].draw(randomNumberGenerators[i])) / 2;
+                BOOST_REQUIRE_EQUAL(acceptanceRates(i), acceptanceRate);
+                BOOST_REQUIRE(ensemble.getStates().col(i).isApprox(chains[i].getState()));
+                BOOST_REQUIRE_CLOSE(ensemble.getStateNegativeLogLikelihoods()(i),
+                                    chains[i].getStateNegativeLogLikelihood(), 1e-8);
+            }
+        }
+        BOOST_CHECK_GT(totalAcceptanceRates.minCoeff(), 0);
+        BOOST_CHECK_LT(totalAcceptanceRates.maxCoeff(), 200);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(LockstepMetropolisHastingsEnsemble)
+
+    BOOST_AUTO_TEST_CASE(EqualsSequentialChainsForBatchedGaussian) {
+        Eigen::MatrixXd covariance(2, 2);
+        covariance << 0.1, 0.05, 0.05, 0.2;
+        auto model = std::make_shared<hops::Gaussian>(Eigen::VectorXd::Constant(2, 0.1), covariance);
+        checkEqualsSequentialChains(model, 0.3, 1.);
+        // Large steps leave the polytope, such that only part of the proposals are evaluated.
+        checkEqualsSequentialChains(model, 1.5, 0.5);
+    }
+
+    BOOST_AUTO_TEST_CASE(EqualsSequentialChainsForBatchedRosenbrock) {
+        auto model = std::make_shared<hops::Rosenbrock>(0.5, Eigen::VectorXd::Constant(1, 0.2));
+        checkEqualsSequentialChains(model, 0.5, 1.);
+    }
+
+    BOOST_AUTO_TEST_CASE(SetStateUpdatesStatesAndLikelihoods) {
+        auto model = std::make_shared<hops::Gaussian>(Eigen::VectorXd::Zero(2), Eigen::MatrixXd::Identity(2, 2));
+        hops::LockstepMetropolisHastingsEnsemble<ProposalType> ensemble(createProposals(3, 0.5), model);
+
+        Eigen::VectorXd newState = Eigen::VectorXd::Constant(2, 0.25);
+        ensemble.setState(1, newState);
+
+        BOOST_CHECK(ensemble.getStates().col(1) == newState);
+        BOOST_CHECK(ensemble.getProposal(1).getState() == newState);
+        BOOST_CHECK_EQUAL(ensemble.getStateNegativeLogLikelihoods()(1), model->computeNegativeLogLikelihood(newState));
+    }
+
+    BOOST_AUTO_TEST_CASE(ThrowsOnInvalidArguments) {
+        auto model = std::make_shared<hops::Gaussian>(Eigen::VectorXd::Zero(2), Eigen::MatrixXd::Identity(2, 2));
+        BOOST_CHECK_THROW(hops::LockstepMetropolisHastingsEnsemble<ProposalType>({}, model), std::invalid_argument);
+        BOOST_CHECK_THROW(hops::LockstepMetropolisHastingsEnsemble<ProposalType>(createProposals(2, 0.5), nullptr),
+                          std::invalid_argument);
+
+        hops::LockstepMetropolisHastingsEnsemble<ProposalType> ensemble(createProposals(2, 0.5), model);
+        std::vector<hops::RandomNumberGenerator> randomNumberGenerators(1);
+        BOOST_CHECK_THROW(ensemble.draw(randomNumberGenerators), std::invalid_argument);
+        randomNumberGenerators.resize(2);
+        BOOST_CHECK_THROW(ensemble.draw(randomNumberGenerators, 0), std::invalid_argument);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
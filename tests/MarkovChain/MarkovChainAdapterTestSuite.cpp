@@ -0,0 +1,94 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE MarkovChainAdapterTestSuite
+
+#include <boost/test/unit_test.hpp>
+#include <Eigen/Core>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "hops/MarkovChain/MarkovChainFactory.hpp"
+#include "hops/Model/Gaussian.hpp"
+
+namespace {
+    std::vector<std::unique_ptr<hops::MarkovChain>> createMarkovChains() {
+        Eigen::MatrixXd A(6, 3);
+        A << Eigen::MatrixXd::Identity(3, 3), -Eigen::MatrixXd::Identity(3, 3);
+        Eigen::VectorXd b = Eigen::VectorXd::Ones(6);
+        Eigen::VectorXd start = Eigen::VectorXd::Zero(3);
+        Eigen::MatrixXd unroundingTransformation = 2 * Eigen::MatrixXd::Identity(3, 3);
+        unroundingTransformation(1, 0) = 0.5;
+        Eigen::VectorXd unroundingShift = Eigen::VectorXd::Ones(3);
+        hops::Gaussian model(Eigen::VectorXd::Zero(3), Eigen::MatrixXd::Identity(3, 3));
+
+        std::vector<std::unique_ptr<hops::MarkovChain>> markovChains;
+        markovChains.emplace_back(hops::MarkovChainFactory::createMarkovChain(
+                hops::MarkovChainType::CoordinateHitAndRun, A, b, start));
+        markovChains.emplace_back(hops::MarkovChainFactory::createMarkovChain(
+                hops::MarkovChainType::HitAndRun, A, b, start, unroundingTransformation, unroundingShift));
+        markovChains.emplace_back(hops::MarkovChainFactory::createMarkovChain(
+                hops::MarkovChainType::DikinWalk, A, b, start, model));
+        markovChains.emplace_back(hops::MarkovChainFactory::createMarkovChain(
+                hops::MarkovChainType::BallWalk, A, b, start, model));
+        return markovChains;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(MarkovChainAdapter)
+
+    BOOST_AUTO_TEST_CASE(DrawBatchEqualsRepeatedDraws) {
+        const long numberOfSamples = 50;
+        const long thinning = 3;
+        auto batchedChains = createMarkovChains();
+        auto singleChains = createMarkovChains();
+
+        for (size_t chain = 0; chain < batchedChains.size(); ++chain) {
+            hops::RandomNumberGenerator batchedRng(42);
+            hops::RandomNumberGenerator singleRng(42);
+
+            Eigen::MatrixXd samples(3, numberOfSamples);
+            Eigen::VectorXd acceptanceRates(numberOfSamples);
+            batchedChains[chain]->drawBatch(batchedRng, numberOfSamples, thinning, samples, acceptanceRates);
+
+            for (long i = 0; i < numberOfSamples; ++i) {
+                auto[acceptanceRate, state] = singleChains[chain]->draw(singleRng, thinning);
+                BOOST_CHECK_EQUAL(acceptanceRates(i), acceptanceRate);
+                BOOST_CHECK(samples.col(i) == state);
+            }
+            BOOST_CHECK(batchedChains[chain]->getState() == singleChains[chain]->getState());
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(DrawBatchWritesIntoBlockOfLargerMatrix) {
+        auto markovChains = createMarkovChains();
+        auto referenceChains = createMarkovChains();
+        hops::RandomNumberGenerator rng(7);
+        hops::RandomNumberGenerator referenceRng(7);
+
+        Eigen::MatrixXd storage = Eigen::MatrixXd::Constant(5, 20, -42);
+        markovChains[1]->drawBatch(rng, 10, 1, storage.block(1, 5, 3, 10));
+        Eigen::MatrixXd reference(3, 10);
+        referenceChains[1]->drawBatch(referenceRng, 10, 1, reference);
+
+        BOOST_CHECK(storage.block(1, 5, 3, 10) == reference);
+        BOOST_CHECK((storage.row(0).array() == -42).all());
+        BOOST_CHECK((storage.row(4).array() == -42).all());
+        BOOST_CHECK((storage.leftCols(5).array() == -42).all());
+        BOOST_CHECK((storage.rightCols(5).array() == -42).all());
+    }
+
+    BOOST_AUTO_TEST_CASE(DrawBatchThrowsOnInvalidArguments) {
+        auto markovChains = createMarkovChains();
+        hops::RandomNumberGenerator rng(42);
+        Eigen::MatrixXd samples(3, 10);
+        Eigen::MatrixXd wrongNumberOfRows(2, 10);
+        Eigen::VectorXd wrongNumberOfAcceptanceRates(5);
+
+        BOOST_CHECK_THROW(markovChains[0]->drawBatch(rng, 11, 1, samples), std::invalid_argument);
+        BOOST_CHECK_THROW(markovChains[0]->drawBatch(rng, 10, 1, wrongNumberOfRows), std::invalid_argument);
+        BOOST_CHECK_THROW(markovChains[0]->drawBatch(rng, 10, 0, samples), std::invalid_argument);
+        BOOST_CHECK_THROW(markovChains[0]->drawBatch(rng, 10, 1, samples, wrongNumberOfAcceptanceRates),
+                          std::invalid_argument);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
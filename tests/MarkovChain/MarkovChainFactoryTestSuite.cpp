@@ -34,6 +34,19 @@ namespace {
             return nullptr;
         }
     };
+
+    class ShiftedGaussian : public hops::Gaussian {
+    public:
+        using hops::Gaussian::Gaussian;
+
+        double computeNegativeLogLikelihood(const hops::VectorType &x) override {
+            return hops::Gaussian::computeNegativeLogLikelihood(x.array() - 0.5);
+        }
+
+        [[nodiscard]] std::unique_ptr<hops::Model> copyModel() const override {
+            return std::make_unique<ShiftedGaussian>(*this);
+        }
+    };
 }
 
 struct MarkovChainFactoryTestFixture {
@@ -228,6 +241,53 @@ BOOST_AUTO_TEST_SUITE(MarkovchainFactory)
         BOOST_CHECK(markovChain != nullptr);
     }
 
+    BOOST_AUTO_TEST_CASE(createNonUniformWithRuntimeBuiltInModelIsStaticallyTyped) {
+        auto fixture = MarkovChainFactoryTestFixture();
+        hops::Gaussian gaussian(Eigen::VectorXd::Zero(2), Eigen::MatrixXd::Identity(2, 2));
+        std::shared_ptr<hops::Model> runtimeModel = std::make_shared<hops::Gaussian>(gaussian);
+
+        for (auto type: {hops::MarkovChainType::CoordinateHitAndRun, hops::MarkovChainType::HitAndRun}) {
+            auto staticChain = hops::MarkovChainFactory::createMarkovChain(
+                    type, fixture.A, fixture.b, fixture.startingPoint, gaussian);
+            auto dispatchedChain = hops::MarkovChainFactory::createMarkovChain(
+                    type, fixture.A, fixture.b, fixture.startingPoint, runtimeModel);
+            auto dispatchedRoundedChain = hops::MarkovChainFactory::createMarkovChain(
+                    type, fixture.A, fixture.b, fixture.startingPoint, fixture.N, fixture.shift, runtimeModel);
+
+            BOOST_CHECK(dynamic_cast<hops::Gaussian *>(dispatchedChain.get()) != nullptr);
+            BOOST_CHECK(dynamic_cast<hops::ModelWrapper *>(dispatchedChain.get()) == nullptr);
+            BOOST_CHECK(dynamic_cast<hops::Gaussian *>(dispatchedRoundedChain.get()) != nullptr);
+
+            hops::RandomNumberGenerator staticRng(42);
+            hops::RandomNumberGenerator dispatchedRng(42);
+            for (int i = 0; i < 100; ++i) {
+                BOOST_CHECK(staticChain->draw(staticRng) == dispatchedChain->draw(dispatchedRng));
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(createNonUniformWithRuntimeDerivedModelKeepsOverrides) {
+        auto fixture = MarkovChainFactoryTestFixture();
+        std::shared_ptr<hops::Model> runtimeModel = std::make_shared<ShiftedGaussian>(
+                Eigen::VectorXd::Zero(2), Eigen::MatrixXd::Identity(2, 2));
+
+        auto markovChain = hops::MarkovChainFactory::createMarkovChain(
+                hops::MarkovChainType::HitAndRun, fixture.A, fixture.b, fixture.startingPoint, runtimeModel);
+
+        BOOST_CHECK(dynamic_cast<hops::ModelWrapper *>(markovChain.get()) != nullptr);
+        BOOST_CHECK(dynamic_cast<hops::Gaussian *>(markovChain.get()) == nullptr);
+        BOOST_CHECK_CLOSE(markovChain->getStateNegativeLogLikelihood(),
+                          runtimeModel->computeNegativeLogLikelihood(fixture.startingPoint), 1e-12);
+    }
+
+    BOOST_AUTO_TEST_CASE(createNonUniformWithRuntimeModelThrowsOnNullptr) {
+        auto fixture = MarkovChainFactoryTestFixture();
+        std::shared_ptr<hops::Model> runtimeModel;
+        BOOST_CHECK_THROW(hops::MarkovChainFactory::createMarkovChain(
+                hops::MarkovChainType::HitAndRun, fixture.A, fixture.b, fixture.startingPoint, runtimeModel),
+                          std::invalid_argument);
+    }
+
 #ifdef HOPS_MPI_SUPPORTED
 
     BOOST_AUTO_TEST_CASE(createNonUniformCoordinateHitAndRunWithParallelTempering) {
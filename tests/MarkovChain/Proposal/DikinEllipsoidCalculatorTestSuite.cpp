@@ -122,4 +122,47 @@ BOOST_AUTO_TEST_SUITE(DikinEllipsoidCalculator)
         BOOST_CHECK(((actualDikinEllipsoid - expectedDikinEllipsoid).array() < 1e-12).all());
     }
 
+    BOOST_AUTO_TEST_CASE(LeverageScoresOfCube) {
+        const long rows = 6;
+        const long cols = 3;
+        Eigen::MatrixXd A(rows, cols);
+        A << 1, 0, 0,
+                0, 1, 0,
+                0, 0, 1,
+                -1, 0, 0,
+                0, -1, 0,
+                0, 0, -1;
+        Eigen::VectorXd b(rows);
+        b << 1, 1, 1, 1, 1, 1;
+
+        hops::DikinEllipsoidCalculator dikinEllipsoidCalculator(A, b);
+        Eigen::VectorXd interiorPoint = Eigen::VectorXd::Zero(cols);
+        Eigen::VectorXd weights = Eigen::VectorXd::Ones(rows);
+
+        BOOST_CHECK(dikinEllipsoidCalculator.computeWeightedDikinEllipsoid(interiorPoint, weights) ==
+                    dikinEllipsoidCalculator.computeDikinEllipsoid(interiorPoint));
+
+        auto[choleskyWasSuccessful, lowerFactor] = dikinEllipsoidCalculator.computeCholeskyFactorOfWeightedDikinEllipsoid(
+                interiorPoint, weights);
+        BOOST_CHECK(choleskyWasSuccessful);
+
+        Eigen::VectorXd leverageScores = dikinEllipsoidCalculator.computeLeverageScores(interiorPoint,
+                                                                                         weights,
+                                                                                         lowerFactor,
+                                                                                         Eigen::MatrixXd());
+        for (long i = 0; i < rows; ++i) {
+            BOOST_CHECK_CLOSE(leverageScores(i), 0.5, 1e-10);
+        }
+
+        // With a scaled identity as sketch, the sketched leverage scores are exact.
+        Eigen::MatrixXd sketch = std::sqrt(static_cast<double>(cols)) * Eigen::MatrixXd::Identity(cols, cols);
+        Eigen::VectorXd sketchedLeverageScores = dikinEllipsoidCalculator.computeLeverageScores(interiorPoint,
+                                                                                                 weights,
+                                                                                                 lowerFactor,
+                                                                                                 sketch);
+        for (long i = 0; i < rows; ++i) {
+            BOOST_CHECK_CLOSE(sketchedLeverageScores(i), 0.5, 1e-10);
+        }
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,282 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE HotPathAllocationTestSuite
+
+// Makes Eigen check every heap allocation against Eigen::internal::is_malloc_allowed().
+#define EIGEN_RUNTIME_NO_MALLOC
+
+#include <cstddef>
+#include <cstdlib>
+
+namespace {
+    bool isCountingAllocations = false;
+    long numberOfHeapAllocations = 0;
+    long numberOfForbiddenEigenAllocations = 0;
+}
+
+// Eigen reports forbidden allocations through eigen_assert, which is disabled in release builds.
+// Counting failed assertions instead of aborting keeps the report available in every build type.
+#define eigen_assert(x) do { if (!(x)) { ++::numberOfForbiddenEigenAllocations; } } while (false)
+
+#ifdef __GLIBC__
+// Interposes the allocation functions of glibc, such that allocations outside of Eigen are counted as well.
+extern "C" {
+void *__libc_malloc(std::size_t size);
+void *__libc_calloc(std::size_t count, std::size_t size);
+void *__libc_realloc(void *pointer, std::size_t size);
+
+void *malloc(std::size_t size) noexcept {
+    if (isCountingAllocations) {
+        ++numberOfHeapAllocations;
+    }
+    return __libc_malloc(size);
+}
+
+void *calloc(std::size_t count, std::size_t size) noexcept {
+    if (isCountingAllocations) {
+        ++numberOfHeapAllocations;
+    }
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *pointer, std::size_t size) noexcept {
+    if (isCountingAllocations) {
+        ++numberOfHeapAllocations;
+    }
+    return __libc_realloc(pointer, size);
+}
+}
+#endif
+
+#include <boost/test/unit_test.hpp>
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "hops/MarkovChain/Draw/MetropolisHastingsFilter.hpp"
+#include "hops/MarkovChain/MarkovChainFactory.hpp"
+#include "hops/MarkovChain/ModelMixin.hpp"
+#include "hops/MarkovChain/Proposal/AdaptiveMetropolisProposal.hpp"
+#include "hops/MarkovChain/Proposal/BallWalkProposal.hpp"
+#include "hops/MarkovChain/Proposal/BilliardAdaptiveMetropolisProposal.hpp"
+#include "hops/MarkovChain/Proposal/BilliardMALAProposal.hpp"
+#include "hops/MarkovChain/Proposal/BilliardWalkProposal.hpp"
+#include "hops/MarkovChain/Proposal/CoordinateHitAndRunProposal.hpp"
+#include "hops/MarkovChain/Proposal/CSmMALAProposal.hpp"
+#include "hops/MarkovChain/Proposal/DikinProposal.hpp"
+#include "hops/MarkovChain/Proposal/GaussianProposal.hpp"
+#include "hops/MarkovChain/Proposal/HitAndRunProposal.hpp"
+#include "hops/MarkovChain/Proposal/JohnProposal.hpp"
+#include "hops/MarkovChain/Proposal/TruncatedGaussianProposal.hpp"
+#include "hops/MarkovChain/Proposal/VaidyaProposal.hpp"
+#include "hops/MarkovChain/StateTransformation.hpp"
+#include "hops/Model/Gaussian.hpp"
+#include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
+#include "hops/Transformation/LinearTransformation.hpp"
+
+namespace {
+    const long numberOfWarmUpSteps = 200;
+    const long numberOfCountedSteps = 200;
+
+    struct Allocations {
+        long heap;
+        long eigen;
+    };
+
+    /**
+     * @brief Counts the allocations of numberOfCountedSteps calls to step.
+     */
+    template<typename Step>
+    Allocations countAllocations(Step step) {
+        numberOfHeapAllocations = 0;
+        numberOfForbiddenEigenAllocations = 0;
+        Eigen::internal::set_is_malloc_allowed(false);
+        isCountingAllocations = true;
+        for (long i = 0; i < numberOfCountedSteps; ++i) {
+            step();
+        }
+        isCountingAllocations = false;
+        Eigen::internal::set_is_malloc_allowed(true);
+        return {numberOfHeapAllocations, numberOfForbiddenEigenAllocations};
+    }
+
+    /**
+     * @brief Runs propose, computeLogAcceptanceProbability and acceptProposal through a Metropolis-Hastings filter and
+     * checks that none of them allocates once the proposal is warmed up.
+     */
+    template<typename ProposalType>
+    void checkSteadyStateDoesNotAllocate(const ProposalType &proposal) {
+        hops::MetropolisHastingsFilter<ProposalType> markovChain(proposal);
+        hops::RandomNumberGenerator randomNumberGenerator(42);
+        for (long i = 0; i < numberOfWarmUpSteps; ++i) {
+            markovChain.draw(randomNumberGenerator);
+        }
+
+        double acceptanceRate = 0;
+        Allocations allocations = countAllocations([&]() {
+            acceptanceRate += markovChain.draw(randomNumberGenerator);
+        });
+
+        BOOST_CHECK_EQUAL(allocations.heap, 0);
+        BOOST_CHECK_EQUAL(allocations.eigen, 0);
+        // Makes sure that acceptProposal was part of the counted steps.
+        BOOST_CHECK_GT(acceptanceRate, 0);
+    }
+
+    Eigen::MatrixXd createA() {
+        Eigen::MatrixXd A(9, 4);
+        A << Eigen::MatrixXd::Identity(4, 4),
+                -Eigen::MatrixXd::Identity(4, 4),
+                Eigen::RowVectorXd::Ones(4);
+        return A;
+    }
+
+    Eigen::VectorXd createB() {
+        Eigen::VectorXd b = Eigen::VectorXd::Ones(9);
+        b(8) = 2;
+        return b;
+    }
+
+    Eigen::VectorXd createStartingPoint() {
+        return Eigen::VectorXd::Constant(4, 0.1);
+    }
+
+    hops::Gaussian createModel() {
+        Eigen::MatrixXd covariance = 0.5 * Eigen::MatrixXd::Identity(4, 4);
+        covariance(0, 1) = covariance(1, 0) = 0.1;
+        return hops::Gaussian(Eigen::VectorXd::Constant(4, 0.2), covariance);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(HotPathAllocation)
+
+    BOOST_AUTO_TEST_CASE(CountsAllocations) {
+        Eigen::VectorXd vector = Eigen::VectorXd::Ones(100);
+        Allocations allocations = countAllocations([&]() {
+            Eigen::VectorXd copy = 2 * vector;
+            vector(0) = copy(1);
+        });
+        BOOST_CHECK_GT(allocations.eigen, 0);
+#ifdef __GLIBC__
+        BOOST_CHECK_GT(allocations.heap, 0);
+#endif
+    }
+
+    BOOST_AUTO_TEST_CASE(AdaptiveMetropolis) {
+        checkSteadyStateDoesNotAllocate(hops::AdaptiveMetropolisProposal<Eigen::MatrixXd>(
+                createA(), createB(), createStartingPoint(), Eigen::MatrixXd::Identity(4, 4), 1e-3, 50));
+    }
+
+    BOOST_AUTO_TEST_CASE(BallWalk) {
+        checkSteadyStateDoesNotAllocate(hops::BallWalkProposal<Eigen::MatrixXd, Eigen::VectorXd>(
+                createA(), createB(), createStartingPoint(), 0.5));
+    }
+
+    BOOST_AUTO_TEST_CASE(BilliardAdaptiveMetropolis) {
+        checkSteadyStateDoesNotAllocate(hops::BilliardAdaptiveMetropolisProposal<Eigen::MatrixXd>(
+                createA(), createB(), createStartingPoint(), Eigen::MatrixXd::Identity(4, 4), 1e-3, 50));
+    }
+
+    BOOST_AUTO_TEST_CASE(BilliardMALA) {
+        checkSteadyStateDoesNotAllocate(hops::BilliardMALAProposal<hops::Gaussian, Eigen::MatrixXd>(
+                createA(), createB(), createStartingPoint(), createModel(), 100, 0.5));
+    }
+
+    BOOST_AUTO_TEST_CASE(BilliardWalk) {
+        checkSteadyStateDoesNotAllocate(hops::BilliardWalkProposal<Eigen::MatrixXd>(
+                createA(), createB(), createStartingPoint(), 100, 0.5));
+    }
+
+    BOOST_AUTO_TEST_CASE(CoordinateHitAndRun) {
+        checkSteadyStateDoesNotAllocate(hops::CoordinateHitAndRunProposal<Eigen::MatrixXd, Eigen::VectorXd>(
+                createA(), createB(), createStartingPoint()));
+    }
+
+    BOOST_AUTO_TEST_CASE(CSmMALA) {
+        checkSteadyStateDoesNotAllocate(hops::CSmMALAProposal<hops::Gaussian, Eigen::MatrixXd>(
+                createA(), createB(), createStartingPoint(), createModel(), 0.5, 0.5));
+    }
+
+    BOOST_AUTO_TEST_CASE(DikinWalk) {
+        checkSteadyStateDoesNotAllocate(hops::DikinProposal<Eigen::MatrixXd, Eigen::VectorXd>(
+                createA(), createB(), createStartingPoint(), 0.5));
+    }
+
+    BOOST_AUTO_TEST_CASE(Gaussian) {
+        checkSteadyStateDoesNotAllocate(hops::GaussianProposal<Eigen::MatrixXd, Eigen::VectorXd>(
+                createA(), createB(), createStartingPoint(), 0.5));
+    }
+
+    BOOST_AUTO_TEST_CASE(HitAndRun) {
+        checkSteadyStateDoesNotAllocate(hops::HitAndRunProposal<Eigen::MatrixXd, Eigen::VectorXd>(
+                createA(), createB(), createStartingPoint()));
+        checkSteadyStateDoesNotAllocate(
+                hops::HitAndRunProposal<Eigen::MatrixXd, Eigen::VectorXd, hops::GaussianStepDistribution<double>, true>(
+                        createA(), createB(), createStartingPoint(), 0.5));
+    }
+
+    BOOST_AUTO_TEST_CASE(JohnWalk) {
+        checkSteadyStateDoesNotAllocate(hops::JohnProposal<Eigen::MatrixXd, Eigen::VectorXd>(
+                createA(), createB(), createStartingPoint(), 0.5));
+        checkSteadyStateDoesNotAllocate(hops::JohnProposal<Eigen::MatrixXd, Eigen::VectorXd>(
+                createA(), createB(), createStartingPoint(), 0.5, 2));
+    }
+
+    BOOST_AUTO_TEST_CASE(TruncatedGaussian) {
+        checkSteadyStateDoesNotAllocate(hops::TruncatedGaussianProposal<Eigen::MatrixXd, Eigen::VectorXd>(
+                createA(), createB(), createStartingPoint(), createModel()));
+    }
+
+    BOOST_AUTO_TEST_CASE(VaidyaWalk) {
+        checkSteadyStateDoesNotAllocate(hops::VaidyaProposal<Eigen::MatrixXd, Eigen::VectorXd>(
+                createA(), createB(), createStartingPoint(), 0.5));
+        checkSteadyStateDoesNotAllocate(hops::VaidyaProposal<Eigen::MatrixXd, Eigen::VectorXd>(
+                createA(), createB(), createStartingPoint(), 0.5, 2));
+    }
+
+    BOOST_AUTO_TEST_CASE(ModelMixinWithStateTransformation) {
+        Eigen::MatrixXd unroundingTransformation = Eigen::MatrixXd::Identity(4, 4);
+        unroundingTransformation(2, 1) = 0.5;
+        Eigen::VectorXd unroundingShift = Eigen::VectorXd::Constant(4, 0.1);
+        checkSteadyStateDoesNotAllocate(hops::ModelMixin(
+                hops::StateTransformation(
+                        hops::HitAndRunProposal<Eigen::MatrixXd, Eigen::VectorXd>(
+                                createA(), createB(), Eigen::VectorXd::Zero(4)),
+                        hops::LinearTransformation(unroundingTransformation, unroundingShift)),
+                createModel()));
+    }
+
+    BOOST_AUTO_TEST_CASE(DrawBatchOfFactoryMarkovChains) {
+        Eigen::MatrixXd unroundingTransformation = Eigen::MatrixXd::Identity(4, 4);
+        Eigen::VectorXd unroundingShift = Eigen::VectorXd::Zero(4);
+
+        std::vector<std::unique_ptr<hops::MarkovChain>> markovChains;
+        for (const auto &markovChainType: {hops::MarkovChainType::BallWalk,
+                                           hops::MarkovChainType::CoordinateHitAndRun,
+                                           hops::MarkovChainType::Gaussian,
+                                           hops::MarkovChainType::HitAndRun}) {
+            markovChains.emplace_back(hops::MarkovChainFactory::createMarkovChain(
+                    markovChainType, createA(), createB(), createStartingPoint(), unroundingTransformation,
+                    unroundingShift, createModel()));
+        }
+        for (const auto &markovChainType: {hops::MarkovChainType::CSmMALA,
+                                           hops::MarkovChainType::DikinWalk,
+                                           hops::MarkovChainType::JohnWalk,
+                                           hops::MarkovChainType::VaidyaWalk}) {
+            markovChains.emplace_back(hops::MarkovChainFactory::createMarkovChain(
+                    markovChainType, createA(), createB(), createStartingPoint(), createModel()));
+        }
+
+        for (const auto &markovChain: markovChains) {
+            hops::RandomNumberGenerator randomNumberGenerator(42);
+            Eigen::MatrixXd samples(4, numberOfWarmUpSteps);
+            markovChain->drawBatch(randomNumberGenerator, numberOfWarmUpSteps, 1, samples);
+
+            Allocations allocations = countAllocations([&]() {
+                markovChain->drawBatch(randomNumberGenerator, numberOfWarmUpSteps, 1, samples);
+            });
+            BOOST_CHECK_EQUAL(allocations.heap, 0);
+            BOOST_CHECK_EQUAL(allocations.eigen, 0);
+        }
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
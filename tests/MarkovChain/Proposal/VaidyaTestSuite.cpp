@@ -0,0 +1,71 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE VaidyaProposalTestSuite
+
+#include <boost/test/unit_test.hpp>
+#include <Eigen/Core>
+
+#include "hops/MarkovChain/Proposal/VaidyaProposal.hpp"
+#include "hops/RandomNumberGenerator/RandomNumberGenerator.hpp"
+
+BOOST_AUTO_TEST_SUITE(VaidyaProposal)
+
+    BOOST_AUTO_TEST_CASE(Cube) {
+        const long rows = 6;
+        const long cols = 3;
+        Eigen::MatrixXd A(rows, cols);
+        A << 1, 0, 0,
+                0, 1, 0,
+                0, 0, 1,
+                -1, 0, 0,
+                0, -1, 0,
+                0, 0, -1;
+        Eigen::VectorXd b(rows);
+        b << 1, 1, 1, 1, 1, 1;
+        Eigen::VectorXd interiorPoint = Eigen::VectorXd::Zero(cols);
+
+        hops::VaidyaProposal vaidyaProposal(A, b, interiorPoint);
+        hops::RandomNumberGenerator randomNumberGenerator(42);
+        for (int i = 0; i < 100; ++i) {
+            Eigen::VectorXd proposal = vaidyaProposal.propose(randomNumberGenerator);
+            double logAcceptanceProbability = vaidyaProposal.computeLogAcceptanceProbability();
+            BOOST_CHECK(std::isfinite(logAcceptanceProbability) || ((b - A * proposal).array() <= 0).any());
+            if (std::isfinite(logAcceptanceProbability)) {
+                vaidyaProposal.acceptProposal();
+            }
+            BOOST_CHECK(((b - A * vaidyaProposal.getState()).array() > 0).all());
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(SketchedCubeIsCenteredAroundOrigin) {
+        const long rows = 6;
+        const long cols = 3;
+        Eigen::MatrixXd A(rows, cols);
+        A << 1, 0, 0,
+                0, 1, 0,
+                0, 0, 1,
+                -1, 0, 0,
+                0, -1, 0,
+                0, 0, -1;
+        Eigen::VectorXd b(rows);
+        b << 1, 1, 1, 1, 1, 1;
+        Eigen::VectorXd interiorPoint = Eigen::VectorXd::Zero(cols);
+
+        hops::VaidyaProposal vaidyaProposal(A, b, interiorPoint, 0.5, 2);
+        hops::RandomNumberGenerator randomNumberGenerator(42);
+        std::uniform_real_distribution<double> uniformRealDistribution;
+        Eigen::VectorXd mean = Eigen::VectorXd::Zero(cols);
+        const long numberOfSamples = 20000;
+        for (long i = 0; i < numberOfSamples; ++i) {
+            vaidyaProposal.propose(randomNumberGenerator);
+            double logAcceptanceProbability = vaidyaProposal.computeLogAcceptanceProbability();
+            if (std::log(uniformRealDistribution(randomNumberGenerator)) < logAcceptanceProbability) {
+                vaidyaProposal.acceptProposal();
+            }
+            mean += vaidyaProposal.getState();
+        }
+        mean /= numberOfSamples;
+
+        BOOST_CHECK_SMALL(mean.cwiseAbs().maxCoeff(), 0.1);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
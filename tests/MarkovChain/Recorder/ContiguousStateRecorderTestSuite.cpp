@@ -0,0 +1,92 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE ContiguousStateRecorderTestSuite
+
+#include <boost/test/unit_test.hpp>
+#include <Eigen/Core>
+
+#include "hops/MarkovChain/Proposal/GaussianProposal.hpp"
+#include "hops/MarkovChain/Recorder/ContiguousStateRecorder.hpp"
+#include "hops/MarkovChain/Recorder/StateArena.hpp"
+#include "hops/MarkovChain/Recorder/StateRecorder.hpp"
+
+namespace {
+    using Proposal = hops::GaussianProposal<Eigen::MatrixXd, Eigen::VectorXd>;
+
+    Proposal createProposal() {
+        Eigen::MatrixXd A(4, 2);
+        A << Eigen::MatrixXd::Identity(2, 2), -Eigen::MatrixXd::Identity(2, 2);
+        return Proposal(A, Eigen::VectorXd::Ones(4), Eigen::VectorXd::Zero(2), 0.5);
+    }
+
+    void step(Proposal &proposal, hops::RandomNumberGenerator &randomNumberGenerator) {
+        proposal.propose(randomNumberGenerator);
+        if (proposal.computeLogAcceptanceProbability() == 0) {
+            proposal.acceptProposal();
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(ContiguousStateRecorderTestSuite)
+
+    BOOST_AUTO_TEST_CASE(ArenaGrowsByChunksAndKeepsOrder) {
+        hops::StateArena arena(3, 4);
+        for (int i = 0; i < 10; ++i) {
+            arena.append(Eigen::VectorXd::Constant(3, i));
+        }
+        BOOST_CHECK_EQUAL(arena.size(), 10);
+        BOOST_CHECK_EQUAL(arena.getCapacity(), 12);
+        BOOST_CHECK_EQUAL(arena.getChunks().size(), 3);
+        BOOST_CHECK_THROW(arena.getStates(), std::runtime_error);
+
+        Eigen::MatrixXd states = arena.toMatrix();
+        for (int i = 0; i < 10; ++i) {
+            BOOST_CHECK(arena[i] == Eigen::VectorXd::Constant(3, i));
+            BOOST_CHECK(states.col(i) == Eigen::VectorXd::Constant(3, i));
+        }
+        BOOST_CHECK_THROW(arena[10], std::out_of_range);
+        BOOST_CHECK_THROW(arena.append(Eigen::VectorXd::Zero(2)), std::invalid_argument);
+
+        arena.clear();
+        BOOST_CHECK(arena.empty());
+        BOOST_CHECK_EQUAL(arena.getCapacity(), 12);
+    }
+
+    BOOST_AUTO_TEST_CASE(ReservedArenaIsSingleMatrixAndViewsStayValid) {
+        hops::StateArena arena(2);
+        arena.reserve(100);
+        arena.append(Eigen::VectorXd::Ones(2));
+        const double *data = arena.getStates().data();
+        hops::StateArena::StateView first = arena[0];
+        for (int i = 1; i < 100; ++i) {
+            arena.append(Eigen::VectorXd::Constant(2, i));
+        }
+        BOOST_CHECK_EQUAL(arena.getChunks().size(), 1);
+        BOOST_CHECK_EQUAL(arena.getStates().cols(), 100);
+        BOOST_CHECK_EQUAL(arena.getStates().data(), data);
+        BOOST_CHECK(first == Eigen::VectorXd::Ones(2));
+    }
+
+    BOOST_AUTO_TEST_CASE(RecordsSameStatesAsStateRecorder) {
+        hops::ContiguousStateRecorder<Proposal> contiguousRecorder(createProposal(), 16);
+        hops::StateRecorder<Proposal> recorder(createProposal());
+        contiguousRecorder.reserveStateRecords(50);
+        hops::RandomNumberGenerator randomNumberGenerator(42), otherRandomNumberGenerator(42);
+        for (int i = 0; i < 50; ++i) {
+            step(contiguousRecorder, randomNumberGenerator);
+            contiguousRecorder.storeRecord();
+            step(recorder, otherRandomNumberGenerator);
+            recorder.storeRecord();
+        }
+
+        BOOST_CHECK(contiguousRecorder.getStateRecords().toVectors() == recorder.getStateRecords());
+        Eigen::Map<const Eigen::MatrixXd> states = contiguousRecorder.getStateRecordsAsMatrix();
+        BOOST_CHECK_EQUAL(states.cols(), 50);
+        for (int i = 0; i < 50; ++i) {
+            BOOST_CHECK(states.col(i) == recorder.getStateRecords()[i]);
+        }
+
+        contiguousRecorder.clearRecords();
+        BOOST_CHECK(contiguousRecorder.getStateRecords().empty());
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
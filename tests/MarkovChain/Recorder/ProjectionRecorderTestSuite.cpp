@@ -0,0 +1,102 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE ProjectionRecorderTestSuite
+
+#include <boost/test/unit_test.hpp>
+#include <Eigen/Core>
+#include <Eigen/Sparse>
+
+#include "hops/MarkovChain/Proposal/GaussianProposal.hpp"
+#include "hops/MarkovChain/Recorder/ProjectionRecorder.hpp"
+#include "hops/MarkovChain/Recorder/StateRecorder.hpp"
+
+namespace {
+    using Proposal = hops::GaussianProposal<Eigen::MatrixXd, Eigen::VectorXd>;
+
+    Proposal createProposal() {
+        Eigen::MatrixXd A(6, 3);
+        A << Eigen::MatrixXd::Identity(3, 3), -Eigen::MatrixXd::Identity(3, 3);
+        return Proposal(A, Eigen::VectorXd::Ones(6), Eigen::VectorXd::Zero(3), 0.5);
+    }
+
+    template<typename MarkovChain>
+    void sample(MarkovChain &markovChain, long numberOfSamples) {
+        hops::RandomNumberGenerator randomNumberGenerator(42);
+        for (long i = 0; i < numberOfSamples; ++i) {
+            markovChain.propose(randomNumberGenerator);
+            if (markovChain.computeLogAcceptanceProbability() == 0) {
+                markovChain.acceptProposal();
+            }
+            markovChain.storeRecord();
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(ProjectionRecorderTestSuite)
+
+    BOOST_AUTO_TEST_CASE(RecordsProjectionsOfStates) {
+        Eigen::MatrixXd projection(2, 3);
+        projection << 1, 1, 0,
+                0, 2, -1;
+        hops::ProjectionRecorder<hops::StateRecorder<Proposal>> recorder(
+                hops::StateRecorder<Proposal>(createProposal()), projection);
+        sample(recorder, 20);
+
+        const auto &states = recorder.getStateRecords();
+        const auto &projections = recorder.getProjectionRecords();
+        BOOST_REQUIRE_EQUAL(projections.size(), 20);
+        for (size_t i = 0; i < states.size(); ++i) {
+            BOOST_CHECK(projections[i].isApprox(projection * states[i]));
+        }
+
+        recorder.clearRecords();
+        BOOST_CHECK(recorder.getProjectionRecords().empty());
+        BOOST_CHECK(recorder.getStateRecords().empty());
+    }
+
+    BOOST_AUTO_TEST_CASE(RecordsSelectedDimensions) {
+        std::vector<long> indices = {2, 0};
+        auto selection = hops::ProjectionRecorder<Proposal, Eigen::SparseMatrix<double>>::createSelection(3, indices);
+        hops::ProjectionRecorder<hops::StateRecorder<Proposal>, Eigen::SparseMatrix<double>> recorder(
+                hops::StateRecorder<Proposal>(createProposal()), selection);
+        sample(recorder, 10);
+
+        for (size_t i = 0; i < recorder.getStateRecords().size(); ++i) {
+            BOOST_CHECK_EQUAL(recorder.getProjectionRecords()[i](0), recorder.getStateRecords()[i](2));
+            BOOST_CHECK_EQUAL(recorder.getProjectionRecords()[i](1), recorder.getStateRecords()[i](0));
+        }
+        BOOST_CHECK_THROW((hops::ProjectionRecorder<Proposal, Eigen::SparseMatrix<double>>::createSelection(3, {3})),
+                          std::out_of_range);
+        BOOST_CHECK_THROW((hops::ProjectionRecorder<Proposal>(createProposal(), Eigen::MatrixXd::Ones(1, 2))),
+                          std::invalid_argument);
+    }
+
+    BOOST_AUTO_TEST_CASE(AppliesUnroundingTransformationOnlyToProjections) {
+        Eigen::MatrixXd transformationMatrix(4, 3);
+        transformationMatrix << 2, 0, 0,
+                1, 1, 0,
+                0, 0, 3,
+                1, -1, 1;
+        Eigen::VectorXd shift(4);
+        shift << 1, -1, 0.5, 0;
+        hops::LinearTransformation transformation(transformationMatrix, shift);
+        Eigen::MatrixXd projection(1, 2);
+        projection << 1, -1;
+        std::vector<long> indices = {3, 1};
+
+        hops::ProjectionRecorder<hops::StateRecorder<Proposal>> recorder(
+                hops::StateRecorder<Proposal>(createProposal()), projection, transformation, indices);
+        BOOST_CHECK_EQUAL(recorder.getEffectiveProjection().rows(), 1);
+        BOOST_CHECK_EQUAL(recorder.getEffectiveProjection().cols(), 3);
+        sample(recorder, 20);
+
+        for (size_t i = 0; i < recorder.getStateRecords().size(); ++i) {
+            Eigen::VectorXd unrounded = transformation.apply(recorder.getStateRecords()[i]);
+            BOOST_CHECK_CLOSE(recorder.getProjectionRecords()[i](0), unrounded(3) - unrounded(1), 1e-10);
+        }
+        BOOST_CHECK_THROW((hops::ProjectionRecorder<Proposal>(
+                createProposal(), projection, hops::LinearTransformation(Eigen::MatrixXd::Identity(4, 4),
+                                                                         Eigen::VectorXd::Zero(4)))),
+                          std::invalid_argument);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
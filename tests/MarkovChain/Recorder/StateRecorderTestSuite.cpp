@@ -0,0 +1,90 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE StateRecorderTestSuite
+
+#include <boost/test/unit_test.hpp>
+#include <Eigen/Core>
+#include <Eigen/Sparse>
+
+#include "hops/MarkovChain/Proposal/GaussianProposal.hpp"
+#include "hops/MarkovChain/Recorder/StateQuantizer.hpp"
+#include "hops/MarkovChain/Recorder/StateRecorder.hpp"
+
+namespace {
+    using Proposal = hops::GaussianProposal<Eigen::MatrixXd, Eigen::VectorXd>;
+
+    Eigen::MatrixXd createA() {
+        Eigen::MatrixXd A(5, 2);
+        A << Eigen::MatrixXd::Identity(2, 2), -Eigen::MatrixXd::Identity(2, 2), 1, 1;
+        return A;
+    }
+
+    Eigen::VectorXd createB() {
+        Eigen::VectorXd b(5);
+        b << 1, 2, 1, 0, 2.5;
+        return b;
+    }
+
+    template<typename MarkovChain>
+    void sample(MarkovChain &markovChain, long numberOfSamples) {
+        hops::RandomNumberGenerator randomNumberGenerator(42);
+        for (long i = 0; i < numberOfSamples; ++i) {
+            markovChain.propose(randomNumberGenerator);
+            if (markovChain.computeLogAcceptanceProbability() == 0) {
+                markovChain.acceptProposal();
+            }
+            markovChain.storeRecord();
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(StateRecorderTestSuite)
+
+    BOOST_AUTO_TEST_CASE(QuantizerUsesBoundsOfPolytope) {
+        hops::StateQuantizer quantizer = hops::StateQuantizer::fromPolytope(createA(), createB());
+        BOOST_CHECK(quantizer.getLowerBounds() == Eigen::Vector2d(-1, 0));
+        BOOST_CHECK(quantizer.getUpperBounds() == Eigen::Vector2d(1, 2));
+        BOOST_CHECK(hops::StateQuantizer::fromPolytope(Eigen::SparseMatrix<double>(createA().sparseView()), createB())
+                            .getUpperBounds() == quantizer.getUpperBounds());
+
+        Eigen::Vector2d state(0.123456, 1.987654);
+        BOOST_CHECK_LE((quantizer.dequantize(quantizer.quantize(state)) - state).cwiseAbs().maxCoeff(),
+                       2. / 131070);
+        Eigen::Matrix<std::uint16_t, 2, 1> clampedState(0, 65535);
+        BOOST_CHECK(quantizer.quantize(Eigen::Vector2d(-5, 5)) == clampedState);
+
+        Eigen::MatrixXd unbounded = createA().topRows(3);
+        BOOST_CHECK_THROW(hops::StateQuantizer::fromPolytope(unbounded, createB().head(3)), std::invalid_argument);
+        BOOST_CHECK_THROW(hops::StateQuantizer(Eigen::Vector2d(0, 1), Eigen::Vector2d(1, 0)), std::invalid_argument);
+    }
+
+    BOOST_AUTO_TEST_CASE(StoresStatesWithRequestedPrecision) {
+        Proposal proposal(createA(), createB(), Eigen::Vector2d(0, 1), 0.5);
+        hops::StateRecorder<Proposal> recorder(proposal);
+        hops::StateRecorder<Proposal> floatRecorder(proposal, hops::StoragePrecision::FLOAT);
+        hops::StateQuantizer quantizer = hops::StateQuantizer::fromPolytope(createA(), createB());
+        hops::StateRecorder<Proposal> quantizedRecorder(proposal, hops::StoragePrecision::QUANTIZED_16, quantizer);
+        sample(recorder, 50);
+        sample(floatRecorder, 50);
+        sample(quantizedRecorder, 50);
+
+        BOOST_REQUIRE_EQUAL(floatRecorder.getFloatStateRecords().size(), 50);
+        BOOST_REQUIRE_EQUAL(quantizedRecorder.getQuantizedStateRecords().size(), 50);
+        BOOST_CHECK(floatRecorder.getStateRecords().empty());
+        BOOST_CHECK(quantizedRecorder.getStateRecords().empty());
+        for (size_t i = 0; i < 50; ++i) {
+            const Eigen::VectorXd &state = recorder.getStateRecords()[i];
+            BOOST_CHECK(floatRecorder.getFloatStateRecords()[i] == state.cast<float>());
+            Eigen::VectorXd dequantizedState = quantizedRecorder.getStateQuantizer().dequantize(
+                    quantizedRecorder.getQuantizedStateRecords()[i]);
+            BOOST_CHECK_LE((dequantizedState - state).cwiseAbs().maxCoeff(), 2. / 131070);
+        }
+        // The chain itself keeps sampling in double precision.
+        BOOST_CHECK(floatRecorder.getState() == recorder.getState());
+
+        quantizedRecorder.clearRecords();
+        BOOST_CHECK(quantizedRecorder.getQuantizedStateRecords().empty());
+        BOOST_CHECK_THROW(hops::StateRecorder<Proposal>(proposal, hops::StoragePrecision::QUANTIZED_16),
+                          std::invalid_argument);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,135 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE SpeculativeMetropolisHastingsFilterTestSuite
+
+#include <boost/test/unit_test.hpp>
+#include <Eigen/Core>
+#include <memory>
+
+#include "hops/MarkovChain/Draw/MetropolisHastingsFilter.hpp"
+#include "hops/MarkovChain/Draw/SpeculativeMetropolisHastingsFilter.hpp"
+#include "hops/MarkovChain/MarkovChainAdapter.hpp"
+#include "hops/MarkovChain/ModelMixin.hpp"
+#include "hops/MarkovChain/ModelWrapper.hpp"
+#include "hops/MarkovChain/Proposal/DikinProposal.hpp"
+#include "hops/MarkovChain/Proposal/GaussianProposal.hpp"
+#include "hops/Model/Gaussian.hpp"
+#include "hops/Parallel/ThreadPool.hpp"
+
+namespace {
+    Eigen::MatrixXd createA() {
+        Eigen::MatrixXd A(6, 3);
+        A << Eigen::MatrixXd::Identity(3, 3), -Eigen::MatrixXd::Identity(3, 3);
+        return A;
+    }
+
+    Eigen::VectorXd createB() {
+        return Eigen::VectorXd::Ones(6);
+    }
+
+    hops::Gaussian createModel() {
+        Eigen::MatrixXd covariance = 0.1 * Eigen::MatrixXd::Identity(3, 3);
+        covariance(0, 2) = covariance(2, 0) = 0.05;
+        return hops::Gaussian(Eigen::VectorXd::Constant(3, 0.2), covariance);
+    }
+
+    /**
+     * @brief Checks that the speculative filter draws the same states, acceptances and random numbers as the
+     * sequential filter.
+     */
+    template<typename ProposalType>
+    void checkEqualsSequentialFilter(const ProposalType &proposal, long numberOfSpeculativeSteps) {
+        hops::MetropolisHastingsFilter<ProposalType> sequentialChain(proposal);
+        hops::SpeculativeMetropolisHastingsFilter<ProposalType> speculativeChain(
+                proposal, numberOfSpeculativeSteps, std::make_shared<hops::ThreadPool>(4));
+        hops::RandomNumberGenerator sequentialRandomNumberGenerator(42);
+        hops::RandomNumberGenerator speculativeRandomNumberGenerator(42);
+
+        double numberOfAcceptances = 0;
+        for (long i = 0; i < 500; ++i) {
+            double sequentialAcceptance = sequentialChain.draw(sequentialRandomNumberGenerator);
+            double speculativeAcceptance = speculativeChain.draw(speculativeRandomNumberGenerator);
+            numberOfAcceptances += sequentialAcceptance;
+
+            BOOST_REQUIRE_EQUAL(speculativeAcceptance, sequentialAcceptance);
+            BOOST_REQUIRE(speculativeChain.getState() == sequentialChain.getState());
+            BOOST_REQUIRE(speculativeRandomNumberGenerator.rng_ == sequentialRandomNumberGenerator.rng_);
+        }
+        BOOST_CHECK_GT(numberOfAcceptances, 0);
+        BOOST_CHECK_LT(numberOfAcceptances, 500);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(SpeculativeMetropolisHastingsFilter)
+
+    BOOST_AUTO_TEST_CASE(EqualsSequentialFilterForLowAndHighAcceptanceRates) {
+        for (double stepSize: {0.01, 0.3, 2.}) {
+            for (long numberOfSpeculativeSteps: {1, 3, 8}) {
+                checkEqualsSequentialFilter(
+                        hops::ModelMixin(
+                                hops::GaussianProposal<Eigen::MatrixXd, Eigen::VectorXd>(
+                                        createA(), createB(), Eigen::VectorXd::Zero(3), stepSize),
+                                createModel()),
+                        numberOfSpeculativeSteps);
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(EqualsSequentialFilterForProposalWithStateDependentMetricAndRuntimeModel) {
+        checkEqualsSequentialFilter(
+                hops::ModelMixin(
+                        hops::DikinProposal<Eigen::MatrixXd, Eigen::VectorXd>(
+                                createA(), createB(), Eigen::VectorXd::Zero(3), 0.5),
+                        hops::ModelWrapper(std::make_shared<hops::Gaussian>(createModel()))),
+                4);
+    }
+
+    BOOST_AUTO_TEST_CASE(RespeculatesIfRandomNumberGeneratorIsUsedElsewhere) {
+        auto proposal = hops::ModelMixin(
+                hops::GaussianProposal<Eigen::MatrixXd, Eigen::VectorXd>(
+                        createA(), createB(), Eigen::VectorXd::Zero(3), 2.),
+                createModel());
+        hops::MetropolisHastingsFilter<decltype(proposal)> sequentialChain(proposal);
+        hops::SpeculativeMetropolisHastingsFilter<decltype(proposal)> speculativeChain(proposal, 8);
+        hops::RandomNumberGenerator sequentialRandomNumberGenerator(7);
+        hops::RandomNumberGenerator speculativeRandomNumberGenerator(7);
+
+        for (long i = 0; i < 200; ++i) {
+            BOOST_REQUIRE_EQUAL(speculativeChain.draw(speculativeRandomNumberGenerator),
+                                sequentialChain.draw(sequentialRandomNumberGenerator));
+            BOOST_REQUIRE(speculativeChain.getState() == sequentialChain.getState());
+            if (i % 7 == 0) {
+                sequentialRandomNumberGenerator();
+                speculativeRandomNumberGenerator();
+            }
+            if (i % 11 == 0) {
+                Eigen::VectorXd newState = Eigen::VectorXd::Constant(3, 0.01 * (i % 5));
+                sequentialChain.setState(newState);
+                speculativeChain.setState(newState);
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(DrawBatchOfAdapterEqualsSequentialFilter) {
+        auto proposal = hops::ModelMixin(
+                hops::GaussianProposal<Eigen::MatrixXd, Eigen::VectorXd>(
+                        createA(), createB(), Eigen::VectorXd::Zero(3), 1.),
+                createModel());
+        hops::MarkovChainAdapter sequentialChain{hops::MetropolisHastingsFilter(proposal)};
+        hops::MarkovChainAdapter speculativeChain{hops::SpeculativeMetropolisHastingsFilter(proposal, 5)};
+        hops::RandomNumberGenerator sequentialRandomNumberGenerator(3);
+        hops::RandomNumberGenerator speculativeRandomNumberGenerator(3);
+
+        Eigen::MatrixXd sequentialSamples(3, 100);
+        Eigen::VectorXd sequentialAcceptanceRates(100);
+        sequentialChain.drawBatch(sequentialRandomNumberGenerator, 100, 3, sequentialSamples,
+                                  sequentialAcceptanceRates);
+        Eigen::MatrixXd speculativeSamples(3, 100);
+        Eigen::VectorXd speculativeAcceptanceRates(100);
+        speculativeChain.drawBatch(speculativeRandomNumberGenerator, 100, 3, speculativeSamples,
+                                   speculativeAcceptanceRates);
+
+        BOOST_CHECK(speculativeSamples == sequentialSamples);
+        BOOST_CHECK(speculativeAcceptanceRates == sequentialAcceptanceRates);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -85,4 +85,22 @@ BOOST_AUTO_TEST_SUITE(GaussianModel)
         }
     }
 
+    BOOST_AUTO_TEST_CASE(computeNegativeLogLikelihoodsMatchesSingleEvaluations) {
+        Eigen::VectorXd mean(3);
+        mean << -.8, .1, .5;
+        Eigen::MatrixXd covariance(3, 3);
+        covariance << 0.04, 0.01, 0,
+                0.01, 0.09, 0.02,
+                0, 0.02, 0.16;
+        hops::Gaussian model(mean, covariance);
+
+        Eigen::MatrixXd states = Eigen::MatrixXd::Random(3, 7);
+        Eigen::VectorXd actualValues(7);
+        model.computeNegativeLogLikelihoods(states, actualValues);
+
+        for (long i = 0; i < states.cols(); ++i) {
+            BOOST_CHECK_CLOSE(actualValues(i), model.computeNegativeLogLikelihood(states.col(i)), 1e-10);
+        }
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -164,4 +164,19 @@ BOOST_AUTO_TEST_SUITE(Mixture)
         BOOST_CHECK(!actualExpectedFisherInformation.has_value());
     }
 
+    BOOST_AUTO_TEST_CASE(computeNegativeLogLikelihoodsMatchesSingleEvaluations) {
+        Eigen::MatrixXd covariance = 0.5 * Eigen::MatrixXd::Identity(2, 2);
+        auto model1 = std::make_shared<hops::Gaussian>(Eigen::VectorXd::Constant(2, -1.), covariance);
+        auto model2 = std::make_shared<hops::Gaussian>(Eigen::VectorXd::Constant(2, 1.), covariance);
+        hops::Mixture mixture(std::vector<std::shared_ptr<hops::Model>>{model1, model2}, {0.3, 0.7});
+
+        Eigen::MatrixXd states = 2 * Eigen::MatrixXd::Random(2, 6);
+        Eigen::VectorXd actualValues(6);
+        mixture.computeNegativeLogLikelihoods(states, actualValues);
+
+        for (long i = 0; i < states.cols(); ++i) {
+            BOOST_CHECK_CLOSE(actualValues(i), mixture.computeNegativeLogLikelihood(states.col(i)), 1e-10);
+        }
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
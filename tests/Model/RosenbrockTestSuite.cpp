@@ -195,4 +195,18 @@ BOOST_AUTO_TEST_SUITE(RosenbrockTestSuite)
         BOOST_CHECK(actualValue.isApprox(expectedValue));
     }
 
+    BOOST_AUTO_TEST_CASE(computeNegativeLogLikelihoodsMatchesSingleEvaluations) {
+        hops::VectorType shiftParameter(2);
+        shiftParameter << 1, -2;
+        hops::Rosenbrock rosenbrock(1.5, shiftParameter);
+
+        Eigen::MatrixXd states = 3 * Eigen::MatrixXd::Random(4, 5);
+        Eigen::VectorXd actualValues(5);
+        rosenbrock.computeNegativeLogLikelihoods(states, actualValues);
+
+        for (long i = 0; i < states.cols(); ++i) {
+            BOOST_CHECK_CLOSE(actualValues(i), rosenbrock.computeNegativeLogLikelihood(states.col(i)), 1e-10);
+        }
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -2,18 +2,111 @@
 #define BOOST_TEST_MODULE DiffusiveNestedSamplingTestSuite
 
 #include <boost/test/unit_test.hpp>
+#include <cmath>
 #include <Eigen/Core>
 
+#include "hops/MarkovChain/Proposal/HitAndRunProposal.hpp"
 #include "hops/NestedSampling/DiffusiveNestedSampling.hpp"
 
+namespace {
+    /**
+     * @brief Log-likelihood -x on the unit interval, so that the prior mass above the cutoff c is exactly -c.
+     */
+    class LinearModel : public hops::Model {
+    public:
+        double computeNegativeLogLikelihood(const hops::VectorType &x) override {
+            return x(0);
+        }
+
+        std::vector<std::string> getDimensionNames() const override {
+            return {"x"};
+        }
+
+        std::unique_ptr<hops::Model> copyModel() const override {
+            return std::make_unique<LinearModel>(*this);
+        }
+    };
+
+    hops::DiffusiveNestedSampling createSampler(size_t numberOfParticles, unsigned int numberOfThreads) {
+        Eigen::MatrixXd A(2, 1);
+        A << 1, -1;
+        Eigen::VectorXd b(2);
+        b << 1, 0;
+        Eigen::VectorXd start(1);
+        start << 0.5;
+
+        std::vector<std::unique_ptr<hops::Proposal>> particles;
+        for (size_t i = 0; i < numberOfParticles; ++i) {
+            particles.emplace_back(std::make_unique<hops::HitAndRunProposal<Eigen::MatrixXd, Eigen::VectorXd>>(
+                    A, b, start));
+        }
+        std::vector<std::unique_ptr<hops::Model>> models;
+        models.emplace_back(std::make_unique<LinearModel>());
+
+        hops::DiffusiveNestedSamplingOptions options;
+        options.new_level_interval = 1000;
+        options.thread_steps = 50;
+        options.max_num_levels = 6;
+        options.num_threads = numberOfThreads;
+        return hops::DiffusiveNestedSampling(std::move(particles), std::move(models), options);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE(DiffusiveNestedSampling)
 
-    BOOST_AUTO_TEST_CASE(Test) {
+    BOOST_AUTO_TEST_CASE(LevelCompressionOfLinearLikelihood) {
+        hops::DiffusiveNestedSampling diffusiveNestedSampling = createSampler(8, 2);
+        hops::RandomNumberGenerator randomNumberGenerator(42);
+        for (int i = 0; i < 500; ++i) {
+            diffusiveNestedSampling.updateParticles(randomNumberGenerator);
+        }
 
-//    hops::DiffusiveNestedSampling()
-//
-//    }
+        std::vector<hops::Level> levels = diffusiveNestedSampling.getLevels();
+        BOOST_REQUIRE_EQUAL(levels.size(), 6);
+        BOOST_CHECK(diffusiveNestedSampling.hasFinishedLevelConstruction());
+        for (size_t i = 1; i < levels.size(); ++i) {
+            BOOST_CHECK(levels[i - 1].getLikelihood() < levels[i].getLikelihood());
+            double expectedLogX = std::log(-levels[i].getLikelihood().getValue());
+            BOOST_CHECK_SMALL(levels[i].getLogX() - expectedLogX, 0.3);
+        }
     }
 
-BOOST_AUTO_TEST_SUITE_END()
+    BOOST_AUTO_TEST_CASE(ResultsDoNotDependOnNumberOfThreads) {
+        hops::DiffusiveNestedSampling sequential = createSampler(4, 1);
+        hops::DiffusiveNestedSampling parallel = createSampler(4, 4);
+        hops::RandomNumberGenerator sequentialRandomNumberGenerator(7);
+        hops::RandomNumberGenerator parallelRandomNumberGenerator(7);
+        for (int i = 0; i < 50; ++i) {
+            sequential.updateParticles(sequentialRandomNumberGenerator);
+            parallel.updateParticles(parallelRandomNumberGenerator);
+        }
 
+        std::vector<hops::Level> sequentialLevels = sequential.getLevels();
+        std::vector<hops::Level> parallelLevels = parallel.getLevels();
+        BOOST_REQUIRE_EQUAL(sequentialLevels.size(), parallelLevels.size());
+        for (size_t i = 0; i < sequentialLevels.size(); ++i) {
+            BOOST_CHECK_EQUAL(sequentialLevels[i].asVector(), parallelLevels[i].asVector());
+        }
+        for (size_t i = 0; i < 4; ++i) {
+            BOOST_CHECK_EQUAL(sequential.saveParticle(i), parallel.saveParticle(i));
+        }
+        BOOST_CHECK_EQUAL(sequential.getNumberOfMcmcSteps(), 4 * 50 * 50);
+    }
+
+    BOOST_AUTO_TEST_CASE(SavedParticleLayout) {
+        hops::DiffusiveNestedSampling diffusiveNestedSampling = createSampler(3, 1);
+        std::vector<std::string> expectedNames = {"x_0", "level_assignment", "log_likelihood", "tiebreaker",
+                                                  "particle_id"};
+        std::vector<std::string> actualNames = diffusiveNestedSampling.getDimensionNames();
+        BOOST_CHECK_EQUAL_COLLECTIONS(actualNames.begin(), actualNames.end(),
+                                      expectedNames.begin(), expectedNames.end());
+
+        hops::VectorType particle = diffusiveNestedSampling.saveParticle(2);
+
+        BOOST_CHECK_EQUAL(particle.rows(), 5);
+        BOOST_CHECK_EQUAL(particle(0), 0.5);
+        BOOST_CHECK_EQUAL(particle(2), -0.5);
+        BOOST_CHECK_EQUAL(particle(4), 2);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,74 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE StaticNestedSamplingTestSuite
+
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <Eigen/Core>
+
+#include "hops/Model/Gaussian.hpp"
+#include "hops/NestedSampling/StaticNestedSampling.hpp"
+
+namespace {
+    hops::StaticNestedSampling createSampler(long numberOfLivePoints,
+                                             long numberOfReplacementsPerIteration,
+                                             long numberOfThreads) {
+        Eigen::MatrixXd A(4, 2);
+        A << 1, 0,
+                0, 1,
+                -1, 0,
+                0, -1;
+        Eigen::VectorXd b = Eigen::VectorXd::Ones(4);
+        Eigen::VectorXd start = Eigen::VectorXd::Zero(2);
+        hops::Gaussian model(Eigen::VectorXd::Zero(2), 0.01 * Eigen::MatrixXd::Identity(2, 2));
+
+        hops::StaticNestedSamplingOptions options;
+        options.numberOfLivePoints = numberOfLivePoints;
+        options.numberOfReplacementsPerIteration = numberOfReplacementsPerIteration;
+        options.numberOfThreads = numberOfThreads;
+        return hops::StaticNestedSampling(A, b, start, model, options);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(StaticNestedSampling)
+
+    BOOST_AUTO_TEST_CASE(EvidenceOfGaussianInSquare) {
+        hops::StaticNestedSampling staticNestedSampling = createSampler(400, 8, 2);
+        hops::RandomNumberGenerator randomNumberGenerator(42);
+        hops::StaticNestedSamplingResult result = staticNestedSampling.run(randomNumberGenerator);
+
+        // Gaussian density is normalized and lies almost completely inside the square, uniform density is 1/4.
+        BOOST_CHECK_GT(result.logEvidenceError, 0);
+        BOOST_CHECK_SMALL(result.logEvidenceError, 0.15);
+        BOOST_CHECK_SMALL(result.logEvidence - std::log(0.25), 3 * result.logEvidenceError);
+        BOOST_CHECK_EQUAL(result.samples.size(), result.logWeights.size());
+
+        double sumOfWeights = 0;
+        for (double logWeight: result.logWeights) {
+            sumOfWeights += std::exp(logWeight);
+        }
+        BOOST_CHECK_CLOSE(sumOfWeights, 1, 1e-8);
+    }
+
+    BOOST_AUTO_TEST_CASE(ResultsDoNotDependOnNumberOfThreads) {
+        hops::StaticNestedSampling sequential = createSampler(50, 5, 1);
+        hops::StaticNestedSampling parallel = createSampler(50, 5, 4);
+        hops::RandomNumberGenerator sequentialRandomNumberGenerator(7);
+        hops::RandomNumberGenerator parallelRandomNumberGenerator(7);
+
+        hops::StaticNestedSamplingResult sequentialResult = sequential.run(sequentialRandomNumberGenerator);
+        hops::StaticNestedSamplingResult parallelResult = parallel.run(parallelRandomNumberGenerator);
+
+        BOOST_CHECK_EQUAL(sequentialResult.logEvidence, parallelResult.logEvidence);
+        BOOST_CHECK_EQUAL(sequentialResult.numberOfIterations, parallelResult.numberOfIterations);
+        BOOST_REQUIRE_EQUAL(sequentialResult.samples.size(), parallelResult.samples.size());
+        for (size_t i = 0; i < sequentialResult.samples.size(); ++i) {
+            BOOST_CHECK_EQUAL(sequentialResult.samples[i], parallelResult.samples[i]);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(InvalidOptionsThrow) {
+        BOOST_CHECK_THROW(createSampler(10, 10, 1), std::invalid_argument);
+        BOOST_CHECK_THROW(createSampler(0, 1, 1), std::invalid_argument);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
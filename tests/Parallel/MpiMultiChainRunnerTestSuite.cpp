@@ -0,0 +1,148 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE MpiMultiChainRunnerTestSuite
+
+#include <boost/test/unit_test.hpp>
+#include <Eigen/Core>
+#include <filesystem>
+
+#include "hops/FileWriter/CsvWriter.hpp"
+#include "hops/MarkovChain/MarkovChainFactory.hpp"
+#include "hops/Model/Gaussian.hpp"
+#include "hops/Parallel/MpiMultiChainRunner.hpp"
+#include "hops/Parallel/MultiChainRunner.hpp"
+
+namespace {
+    std::unique_ptr<hops::MarkovChain> createMarkovChain(long chain) {
+        Eigen::MatrixXd A(4, 2);
+        A << Eigen::MatrixXd::Identity(2, 2), -Eigen::MatrixXd::Identity(2, 2);
+        Eigen::VectorXd b = 5 * Eigen::VectorXd::Ones(4);
+        Eigen::VectorXd start = Eigen::VectorXd::Constant(2, -2. + 0.5 * chain);
+        hops::Gaussian model(Eigen::VectorXd::Constant(2, 1.), Eigen::MatrixXd::Identity(2, 2));
+        // Chains of different types, as in a single-node run
+        hops::MarkovChainType type = chain % 2 == 0 ? hops::MarkovChainType::Gaussian
+                                                    : hops::MarkovChainType::HitAndRun;
+        return hops::MarkovChainFactory::createMarkovChain(type, A, b, start, model);
+    }
+
+    std::vector<std::unique_ptr<hops::MarkovChain>> createMarkovChains(long numberOfMarkovChains) {
+        std::vector<std::unique_ptr<hops::MarkovChain>> markovChains;
+        for (long chain = 0; chain < numberOfMarkovChains; ++chain) {
+            markovChains.emplace_back(createMarkovChain(chain));
+        }
+        return markovChains;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(MpiMultiChainRunner)
+
+    BOOST_AUTO_TEST_CASE(DistributesChainsInContiguousBlocks) {
+        hops::MpiMultiChainRunner runner(7, createMarkovChain, 42, 1);
+
+        long numberOfLocalMarkovChains = runner.getLocalRunner().getNumberOfMarkovChains();
+        long numberOfMarkovChains;
+        MPI_Allreduce(&numberOfLocalMarkovChains, &numberOfMarkovChains, 1, MPI_LONG, MPI_SUM, MPI_COMM_WORLD);
+        BOOST_CHECK_EQUAL(numberOfMarkovChains, 7);
+        BOOST_CHECK_EQUAL(runner.getNumberOfMarkovChains(), 7);
+        BOOST_CHECK_EQUAL(runner.getFirstMarkovChainIndex(), runner.getRank() * 7 / runner.getNumberOfRanks());
+        BOOST_CHECK_GE(numberOfLocalMarkovChains, 7 / runner.getNumberOfRanks());
+        BOOST_CHECK_LE(numberOfLocalMarkovChains, 7 / runner.getNumberOfRanks() + 1);
+    }
+
+    BOOST_AUTO_TEST_CASE(GatheredSamplesEqualSingleNodeRun) {
+        hops::MpiMultiChainRunner runner(5, createMarkovChain, 42, 2);
+        hops::MultiChainResult localResult = runner.draw(50, 2);
+        // Continues the chains and their random number streams
+        localResult = runner.draw(50, 2);
+        hops::MultiChainResult result = runner.gather(localResult);
+
+        if (runner.getRank() != 0) {
+            BOOST_CHECK(result.states.empty());
+            return;
+        }
+        hops::MultiChainRunner singleNodeRunner(createMarkovChains(5), 42, 1);
+        singleNodeRunner.draw(50, 2);
+        hops::MultiChainResult expectedResult = singleNodeRunner.draw(50, 2);
+        BOOST_REQUIRE_EQUAL(result.states.size(), 5);
+        for (long chain = 0; chain < 5; ++chain) {
+            BOOST_REQUIRE_EQUAL(result.states[chain].size(), 50);
+            for (long i = 0; i < 50; ++i) {
+                BOOST_CHECK(result.states[chain][i] == expectedResult.states[chain][i]);
+                BOOST_CHECK_EQUAL(result.acceptanceRates[chain][i], expectedResult.acceptanceRates[chain][i]);
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(DiagnosticsAreReducedOverAllRanks) {
+        hops::MpiMultiChainRunner runner(6, createMarkovChain, 3, 1);
+        runner.draw(500);
+        hops::MultiChainResult localResult = runner.draw(2000);
+        hops::MultiChainDiagnostics diagnostics = runner.computeDiagnostics(localResult);
+        hops::MultiChainResult result = runner.gather(localResult);
+
+        BOOST_CHECK_EQUAL(diagnostics.numberOfMarkovChains, 6);
+        BOOST_CHECK_EQUAL(diagnostics.numberOfSamples, 6 * 2000);
+        BOOST_CHECK_SMALL((diagnostics.mean - Eigen::VectorXd::Constant(2, 1.)).norm(), 0.2);
+        BOOST_CHECK_SMALL((diagnostics.variance - Eigen::VectorXd::Ones(2)).norm(), 0.3);
+        BOOST_CHECK_LT(diagnostics.potentialScaleReduction.maxCoeff(), 1.1);
+
+        // All ranks compute identical diagnostics.
+        double rootMean[2] = {diagnostics.mean(0), diagnostics.mean(1)};
+        MPI_Bcast(rootMean, 2, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+        BOOST_CHECK_EQUAL(rootMean[0], diagnostics.mean(0));
+        BOOST_CHECK_EQUAL(rootMean[1], diagnostics.mean(1));
+
+        if (runner.getRank() == 0) {
+            Eigen::VectorXd mean = Eigen::VectorXd::Zero(2);
+            double acceptanceRate = 0;
+            for (long chain = 0; chain < 6; ++chain) {
+                for (long i = 0; i < 2000; ++i) {
+                    mean += result.states[chain][i];
+                    acceptanceRate += result.acceptanceRates[chain][i];
+                }
+            }
+            BOOST_CHECK_SMALL((mean / (6 * 2000) - diagnostics.mean).norm(), 1e-10);
+            BOOST_CHECK_CLOSE(acceptanceRate / (6 * 2000), diagnostics.acceptanceRate, 1e-10);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(WritesChainsWithGlobalIndices) {
+        hops::MpiMultiChainRunner runner(4, createMarkovChain, 5, 1);
+        hops::MultiChainResult localResult = runner.draw(10);
+
+        std::filesystem::path perRankPath = "MpiMultiChainRunnerPerRank";
+        std::filesystem::path rootPath = "MpiMultiChainRunnerRoot";
+        if (runner.getRank() == 0) {
+            std::filesystem::remove_all(perRankPath);
+            std::filesystem::remove_all(rootPath);
+        }
+        MPI_Barrier(MPI_COMM_WORLD);
+
+        hops::CsvWriter perRankWriter(perRankPath.string());
+        runner.write(localResult, perRankWriter);
+        std::unique_ptr<hops::CsvWriter> rootWriter;
+        if (runner.getRank() == 0) {
+            rootWriter = std::make_unique<hops::CsvWriter>(rootPath.string());
+        }
+        runner.gatherAndWrite(localResult, rootWriter.get());
+        MPI_Barrier(MPI_COMM_WORLD);
+
+        if (runner.getRank() == 0) {
+            for (long chain = 0; chain < 4; ++chain) {
+                std::string states = "states_chain_" + std::to_string(chain);
+                BOOST_CHECK(std::filesystem::exists(perRankPath / (perRankPath.string() + "_" + states + ".csv")));
+                BOOST_CHECK(std::filesystem::exists(rootPath / (rootPath.string() + "_" + states + ".csv")));
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(ThrowsIfThereAreFewerChainsThanRanks) {
+        hops::MpiInitializerFinalizer::initializeAndQueueFinalizeAtExit();
+        int numberOfRanks;
+        MPI_Comm_size(MPI_COMM_WORLD, &numberOfRanks);
+        if (numberOfRanks > 1) {
+            BOOST_CHECK_THROW(hops::MpiMultiChainRunner(numberOfRanks - 1, createMarkovChain, 1),
+                              std::invalid_argument);
+        }
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,80 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE MultiChainRunnerTestSuite
+
+#include <boost/test/unit_test.hpp>
+#include <Eigen/Core>
+
+#include "hops/MarkovChain/MarkovChainFactory.hpp"
+#include "hops/Model/Gaussian.hpp"
+#include "hops/Parallel/MultiChainRunner.hpp"
+
+namespace {
+    std::vector<std::unique_ptr<hops::MarkovChain>> createMarkovChains() {
+        Eigen::MatrixXd A(6, 3);
+        A << Eigen::MatrixXd::Identity(3, 3), -Eigen::MatrixXd::Identity(3, 3);
+        Eigen::VectorXd b = Eigen::VectorXd::Ones(6);
+        Eigen::VectorXd start = Eigen::VectorXd::Zero(3);
+        hops::Gaussian model(Eigen::VectorXd::Zero(3), Eigen::MatrixXd::Identity(3, 3));
+
+        // Chains of different types run at different speeds.
+        std::vector<std::unique_ptr<hops::MarkovChain>> markovChains;
+        markovChains.emplace_back(hops::MarkovChainFactory::createMarkovChain(
+                hops::MarkovChainType::CoordinateHitAndRun, A, b, start));
+        markovChains.emplace_back(hops::MarkovChainFactory::createMarkovChain(
+                hops::MarkovChainType::HitAndRun, A, b, start, model));
+        markovChains.emplace_back(hops::MarkovChainFactory::createMarkovChain(
+                hops::MarkovChainType::DikinWalk, A, b, start, model));
+        markovChains.emplace_back(hops::MarkovChainFactory::createMarkovChain(
+                hops::MarkovChainType::Gaussian, A, b, start));
+        markovChains.emplace_back(hops::MarkovChainFactory::createMarkovChain(
+                hops::MarkovChainType::BallWalk, A, b, start, model));
+        return markovChains;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(MultiChainRunner)
+
+    BOOST_AUTO_TEST_CASE(OutputDoesNotDependOnNumberOfThreads) {
+        hops::MultiChainRunner sequential(createMarkovChains(), 42, 1);
+        hops::MultiChainRunner parallel(createMarkovChains(), 42, 3, true);
+        BOOST_CHECK_EQUAL(parallel.getNumberOfThreads(), 3);
+
+        for (int call = 0; call < 2; ++call) {
+            hops::MultiChainResult sequentialResult = sequential.draw(50, 3);
+            hops::MultiChainResult parallelResult = parallel.draw(50, 3);
+            BOOST_REQUIRE_EQUAL(sequentialResult.states.size(), 5);
+            for (size_t chain = 0; chain < 5; ++chain) {
+                BOOST_REQUIRE_EQUAL(sequentialResult.states[chain].size(), 50);
+                for (size_t i = 0; i < 50; ++i) {
+                    BOOST_CHECK_EQUAL(sequentialResult.states[chain][i], parallelResult.states[chain][i]);
+                    BOOST_CHECK_EQUAL(sequentialResult.acceptanceRates[chain][i],
+                                      parallelResult.acceptanceRates[chain][i]);
+                }
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(ChainsUseStreamsOfMasterSeed) {
+        std::vector<std::unique_ptr<hops::MarkovChain>> referenceChains = createMarkovChains();
+        hops::MultiChainRunner multiChainRunner(createMarkovChains(), 7, 2);
+        hops::MultiChainResult result = multiChainRunner.draw(10);
+
+        for (size_t chain = 0; chain < referenceChains.size(); ++chain) {
+            hops::RandomNumberGenerator randomNumberGenerator(7);
+            randomNumberGenerator.setStream(chain);
+            for (size_t i = 0; i < 10; ++i) {
+                BOOST_CHECK_EQUAL(referenceChains[chain]->draw(randomNumberGenerator).second,
+                                  result.states[chain][i]);
+            }
+            BOOST_CHECK(multiChainRunner.getRandomNumberGenerator(chain).getStream() ==
+                        randomNumberGenerator.getStream());
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(InvalidArgumentsThrow) {
+        BOOST_CHECK_THROW(hops::MultiChainRunner({}, 0), std::invalid_argument);
+        hops::MultiChainRunner multiChainRunner(createMarkovChains(), 0, 1);
+        BOOST_CHECK_THROW(multiChainRunner.draw(1, 0), std::invalid_argument);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,139 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE PooledWarmUpTestSuite
+
+#include <boost/test/unit_test.hpp>
+#include <Eigen/Core>
+
+#include "hops/MarkovChain/MarkovChainFactory.hpp"
+#include "hops/MarkovChain/Proposal/AdaptiveMetropolisProposal.hpp"
+#include "hops/Model/Gaussian.hpp"
+#include "hops/Parallel/MultiChainRunner.hpp"
+#include "hops/Parallel/PooledWarmUp.hpp"
+
+namespace {
+    Eigen::MatrixXd createA() {
+        Eigen::MatrixXd A(4, 2);
+        A << Eigen::MatrixXd::Identity(2, 2), -Eigen::MatrixXd::Identity(2, 2);
+        return A;
+    }
+
+    Eigen::VectorXd createB() {
+        return 10 * Eigen::VectorXd::Ones(4);
+    }
+
+    hops::Gaussian createModel() {
+        Eigen::MatrixXd covariance(2, 2);
+        covariance << 1, 0.5, 0.5, 2;
+        return hops::Gaussian(Eigen::VectorXd::Constant(2, 1.), covariance);
+    }
+
+    std::vector<std::unique_ptr<hops::MarkovChain>> createGaussianMarkovChains(long numberOfChains) {
+        std::vector<std::unique_ptr<hops::MarkovChain>> markovChains;
+        for (long i = 0; i < numberOfChains; ++i) {
+            Eigen::VectorXd start = Eigen::VectorXd::Constant(2, -2. + i);
+            markovChains.emplace_back(hops::MarkovChainFactory::createMarkovChain(
+                    hops::MarkovChainType::Gaussian, createA(), createB(), start, createModel()));
+            markovChains.back()->setParameter(hops::ProposalParameter::STEP_SIZE, 0.01);
+        }
+        return markovChains;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(PooledWarmUp)
+
+    BOOST_AUTO_TEST_CASE(ResultDoesNotDependOnNumberOfThreads) {
+        hops::MultiChainRunner sequentialRunner(createGaussianMarkovChains(4), 42, 1);
+        hops::MultiChainRunner parallelRunner(createGaussianMarkovChains(4), 42, 3);
+        hops::PooledWarmUp sequentialWarmUp(sequentialRunner, 0.3, 20);
+        hops::PooledWarmUp parallelWarmUp(parallelRunner, 0.3, 20);
+
+        sequentialWarmUp.warmUp(150);
+        parallelWarmUp.warmUp(150);
+
+        const hops::WarmUpSnapshot &sequentialSnapshot = sequentialWarmUp.getSnapshot();
+        const hops::WarmUpSnapshot &parallelSnapshot = parallelWarmUp.getSnapshot();
+        BOOST_CHECK_EQUAL(sequentialSnapshot.version, 8);
+        BOOST_CHECK_EQUAL(sequentialSnapshot.numberOfSamples, 600);
+        BOOST_CHECK_EQUAL(parallelSnapshot.version, sequentialSnapshot.version);
+        BOOST_CHECK_EQUAL(parallelSnapshot.stepSize, sequentialSnapshot.stepSize);
+        BOOST_CHECK(parallelSnapshot.mean == sequentialSnapshot.mean);
+        for (long chain = 0; chain < 4; ++chain) {
+            BOOST_CHECK(parallelRunner.getMarkovChain(chain).getState() ==
+                        sequentialRunner.getMarkovChain(chain).getState());
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(AdaptsSharedStepSizeToTargetAcceptanceRate) {
+        hops::MultiChainRunner runner(createGaussianMarkovChains(4), 7);
+        hops::PooledWarmUp warmUp(runner, 0.3, 50);
+        warmUp.warmUp(5000);
+        const hops::WarmUpSnapshot &snapshot = warmUp.freeze();
+
+        BOOST_CHECK(snapshot.isFrozen);
+        BOOST_CHECK_GT(snapshot.stepSize, 0.1);
+        for (long chain = 0; chain < 4; ++chain) {
+            BOOST_CHECK_EQUAL(std::any_cast<double>(
+                    runner.getMarkovChain(chain).getParameter(hops::ProposalParameter::STEP_SIZE)), snapshot.stepSize);
+        }
+
+        hops::MultiChainResult result = runner.draw(2000);
+        double acceptanceRate = 0;
+        for (const auto &acceptanceRates: result.acceptanceRates) {
+            for (double rate: acceptanceRates) {
+                acceptanceRate += rate;
+            }
+        }
+        acceptanceRate /= 4 * 2000;
+        BOOST_CHECK_CLOSE(acceptanceRate, 0.3, 20);
+    }
+
+    BOOST_AUTO_TEST_CASE(PoolsMeanAndCovarianceOfAllChains) {
+        hops::MultiChainRunner runner(createGaussianMarkovChains(8), 3);
+        hops::PooledWarmUp warmUp(runner, 0.3, 100);
+        warmUp.warmUp(1000);
+        // Discards the statistics of the transient phase.
+        hops::PooledWarmUp pooledWarmUp(runner, 0.3, 100);
+        pooledWarmUp.warmUp(6000);
+        const hops::WarmUpSnapshot &snapshot = pooledWarmUp.getSnapshot();
+
+        hops::Gaussian model = createModel();
+        BOOST_CHECK_EQUAL(snapshot.numberOfSamples, 8 * 6000);
+        BOOST_CHECK_SMALL((snapshot.mean - model.getMean()).norm(), 0.2);
+        BOOST_CHECK_SMALL((snapshot.covariance - model.getCovariance()).norm(), 0.4);
+    }
+
+    BOOST_AUTO_TEST_CASE(SharesCovarianceWithAdaptiveMetropolisChains) {
+        std::vector<std::unique_ptr<hops::MarkovChain>> markovChains;
+        for (long i = 0; i < 3; ++i) {
+            Eigen::VectorXd start = Eigen::VectorXd::Constant(2, -1. + i);
+            markovChains.emplace_back(
+                    hops::MarkovChainFactory::createMarkovChain<Eigen::MatrixXd, Eigen::VectorXd, hops::Gaussian>(
+                            hops::AdaptiveMetropolisProposal<Eigen::MatrixXd>(
+                                    createA(), createB(), start, Eigen::MatrixXd::Identity(2, 2), 1e-3, 10),
+                            createModel()));
+        }
+        hops::MultiChainRunner runner(std::move(markovChains), 11, 2);
+        hops::PooledWarmUp warmUp(runner);
+        warmUp.warmUp(500);
+        const hops::WarmUpSnapshot &snapshot = warmUp.freeze();
+
+        BOOST_REQUIRE_EQUAL(snapshot.covariance.rows(), 2);
+        for (long chain = 0; chain < 3; ++chain) {
+            auto covariance = std::any_cast<Eigen::MatrixXd>(
+                    runner.getMarkovChain(chain).getParameter(hops::ProposalParameter::COVARIANCE));
+            BOOST_CHECK(covariance == snapshot.covariance);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(ThrowsAfterFreezing) {
+        hops::MultiChainRunner runner(createGaussianMarkovChains(2), 1);
+        hops::PooledWarmUp warmUp(runner);
+        warmUp.warmUp(10);
+        BOOST_CHECK(!warmUp.isFrozen());
+        warmUp.freeze();
+        BOOST_CHECK(warmUp.isFrozen());
+        BOOST_CHECK_THROW(warmUp.warmUp(10), std::runtime_error);
+        BOOST_CHECK_THROW(hops::PooledWarmUp(runner, 1.5), std::invalid_argument);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
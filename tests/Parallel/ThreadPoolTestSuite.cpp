@@ -0,0 +1,59 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE ThreadPoolTestSuite
+
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "hops/Parallel/ThreadPool.hpp"
+
+BOOST_AUTO_TEST_SUITE(ThreadPool)
+
+    BOOST_AUTO_TEST_CASE(ExecutesEveryTaskOnce) {
+        hops::ThreadPool threadPool(4);
+        BOOST_CHECK_EQUAL(threadPool.getNumberOfThreads(), 4);
+
+        for (long numberOfTasks: {0, 1, 3, 1000}) {
+            std::vector<int> counts(numberOfTasks, 0);
+            threadPool.parallelFor(numberOfTasks, [&](long i) { counts[i] += 1; });
+            for (int count: counts) {
+                BOOST_CHECK_EQUAL(count, 1);
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(BalancesTasksOfDifferentDurations) {
+        hops::ThreadPool threadPool(3, true);
+        BOOST_CHECK(threadPool.isPinningThreads());
+
+        // The first block of tasks is much more expensive, so the other threads have to steal from it.
+        std::vector<std::atomic<int>> counts(30);
+        threadPool.parallelFor(30, [&](long i) {
+            if (i < 10) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+            counts[i]++;
+        });
+        for (const auto &count: counts) {
+            BOOST_CHECK_EQUAL(count.load(), 1);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(RethrowsExceptionOfTask) {
+        hops::ThreadPool threadPool(3);
+        BOOST_CHECK_THROW(threadPool.parallelFor(10, [](long i) {
+            if (i == 5) {
+                throw std::runtime_error("task failed");
+            }
+        }), std::runtime_error);
+
+        long sum = 0;
+        hops::ThreadPool sequentialThreadPool(1);
+        sequentialThreadPool.parallelFor(10, [&](long i) { sum += i; });
+        BOOST_CHECK_EQUAL(sum, 45);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
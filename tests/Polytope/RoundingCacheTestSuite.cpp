@@ -0,0 +1,100 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE RoundingCacheTestSuite
+
+#include <boost/test/unit_test.hpp>
+#include <Eigen/Core>
+#include <filesystem>
+
+#include "hops/Polytope/MaximumVolumeEllipsoid.hpp"
+#include "hops/Polytope/RoundingCache.hpp"
+
+namespace {
+    Eigen::MatrixXd createSimplexA() {
+        Eigen::MatrixXd A(3, 2);
+        A << -1, 0,
+                0, -1,
+                1, 1;
+        return A;
+    }
+
+    hops::RoundingCache::Rounding computeRoundingFromInteriorPoint(const Eigen::MatrixXd &A, const Eigen::VectorXd &b) {
+        hops::RoundingCache::Rounding rounding;
+        rounding.chebyshevCenter = Eigen::VectorXd::Constant(2, 0.25 * b(2));
+        auto maximumVolumeEllipsoid = hops::MaximumVolumeEllipsoid<double>::construct(A, b, 5000,
+                                                                                      rounding.chebyshevCenter);
+        rounding.roundingTransformation = maximumVolumeEllipsoid.getRoundingTransformation();
+        rounding.ellipsoidCenter = maximumVolumeEllipsoid.getCenter();
+        return rounding;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(RoundingCacheTestSuite)
+
+    BOOST_AUTO_TEST_CASE(KeyDependsOnContentOfAAndB) {
+        Eigen::MatrixXd A = createSimplexA();
+        Eigen::VectorXd b(3);
+        b << 0, 0, 1;
+        std::string key = hops::RoundingCache::computeKey(A, b);
+        BOOST_CHECK_EQUAL(key.size(), 16);
+        BOOST_CHECK_EQUAL(key, hops::RoundingCache::computeKey(Eigen::MatrixXd(A), Eigen::VectorXd(b)));
+
+        Eigen::VectorXd otherB = b;
+        otherB(2) = 2;
+        BOOST_CHECK_NE(key, hops::RoundingCache::computeKey(A, otherB));
+        BOOST_CHECK_NE(key, hops::RoundingCache::computeKey(A.transpose(), Eigen::VectorXd::Zero(2)));
+    }
+
+    BOOST_AUTO_TEST_CASE(ComputesRoundingOnlyOnce) {
+        std::filesystem::remove_all("rounding_cache");
+        Eigen::MatrixXd A = createSimplexA();
+        Eigen::VectorXd b(3);
+        b << 0, 0, 1;
+
+        long numberOfComputations = 0;
+        auto computation = [&](const Eigen::MatrixXd &A, const Eigen::VectorXd &b) {
+            ++numberOfComputations;
+            return computeRoundingFromInteriorPoint(A, b);
+        };
+
+        hops::RoundingCache cache("rounding_cache");
+        BOOST_CHECK(!cache.load(A, b));
+        auto rounding = cache.getOrCompute(A, b, computation);
+        BOOST_CHECK_EQUAL(numberOfComputations, 1);
+        BOOST_CHECK(std::filesystem::exists(cache.getFileName(A, b)));
+
+        // A new cache on the same directory behaves like a later run.
+        hops::RoundingCache laterCache("rounding_cache");
+        auto cachedRounding = laterCache.getOrCompute(A, b, computation);
+        BOOST_CHECK_EQUAL(numberOfComputations, 1);
+        BOOST_CHECK(cachedRounding.roundingTransformation == rounding.roundingTransformation);
+        BOOST_CHECK(cachedRounding.ellipsoidCenter == rounding.ellipsoidCenter);
+        BOOST_CHECK(cachedRounding.chebyshevCenter == rounding.chebyshevCenter);
+        BOOST_CHECK_LE((rounding.ellipsoidCenter - Eigen::VectorXd::Constant(2, 1. / 3)).norm(), 1e-7);
+
+        Eigen::VectorXd otherB = 2 * b;
+        auto otherRounding = laterCache.getOrCompute(A, otherB, computation);
+        BOOST_CHECK_EQUAL(numberOfComputations, 2);
+        BOOST_CHECK_LE((otherRounding.ellipsoidCenter - Eigen::VectorXd::Constant(2, 2. / 3)).norm(), 1e-7);
+    }
+
+    BOOST_AUTO_TEST_CASE(RecomputesCorruptEntries) {
+        std::filesystem::remove_all("rounding_cache_corrupt");
+        Eigen::MatrixXd A = createSimplexA();
+        Eigen::VectorXd b(3);
+        b << 0, 0, 1;
+
+        hops::RoundingCache cache("rounding_cache_corrupt");
+        cache.store(A, b, computeRoundingFromInteriorPoint(A, b));
+        std::filesystem::resize_file(cache.getFileName(A, b), 40);
+        BOOST_CHECK(!cache.load(A, b));
+
+        long numberOfComputations = 0;
+        cache.getOrCompute(A, b, [&](const Eigen::MatrixXd &A, const Eigen::VectorXd &b) {
+            ++numberOfComputations;
+            return computeRoundingFromInteriorPoint(A, b);
+        });
+        BOOST_CHECK_EQUAL(numberOfComputations, 1);
+        BOOST_CHECK(cache.load(A, b));
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,96 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE SequentialMonteCarloTestSuite
+
+#include <boost/test/unit_test.hpp>
+#include <cmath>
+#include <Eigen/Core>
+
+#include "hops/MarkovChain/MarkovChainFactory.hpp"
+#include "hops/Model/Gaussian.hpp"
+#include "hops/SequentialMonteCarlo/SequentialMonteCarlo.hpp"
+
+namespace {
+    std::vector<std::unique_ptr<hops::MarkovChain>> createMarkovChains(long numberOfChains) {
+        Eigen::MatrixXd A(4, 2);
+        A << 1, 0,
+                0, 1,
+                -1, 0,
+                0, -1;
+        Eigen::VectorXd b = Eigen::VectorXd::Ones(4);
+        Eigen::VectorXd start = Eigen::VectorXd::Zero(2);
+        hops::Gaussian model(Eigen::VectorXd::Zero(2), 0.01 * Eigen::MatrixXd::Identity(2, 2));
+
+        std::vector<std::unique_ptr<hops::MarkovChain>> markovChains;
+        for (long i = 0; i < numberOfChains; ++i) {
+            markovChains.emplace_back(hops::MarkovChainFactory::createMarkovChain(
+                    hops::MarkovChainType::Gaussian, A, b, start, model));
+            markovChains.back()->setParameter(hops::ProposalParameter::STEP_SIZE, 0.1);
+        }
+        return markovChains;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(SequentialMonteCarlo)
+
+    BOOST_AUTO_TEST_CASE(SystematicResampling) {
+        Eigen::VectorXd weights(4);
+        weights << 0.5, 0, 0.25, 0.25;
+
+        std::vector<long> expectedIndices = {0, 0, 2, 3};
+        std::vector<long> actualIndices = hops::SequentialMonteCarlo::systematicResampling(weights, 0.5);
+        BOOST_CHECK_EQUAL_COLLECTIONS(actualIndices.begin(), actualIndices.end(),
+                                      expectedIndices.begin(), expectedIndices.end());
+    }
+
+    BOOST_AUTO_TEST_CASE(EffectiveSampleSize) {
+        Eigen::VectorXd uniformLogWeights = Eigen::VectorXd::Constant(10, -3.);
+        BOOST_CHECK_CLOSE(hops::SequentialMonteCarlo::computeEffectiveSampleSize(uniformLogWeights), 10, 1e-10);
+
+        Eigen::VectorXd degenerateLogWeights = Eigen::VectorXd::Constant(10, -1000.);
+        degenerateLogWeights(3) = 0;
+        BOOST_CHECK_CLOSE(hops::SequentialMonteCarlo::computeEffectiveSampleSize(degenerateLogWeights), 1, 1e-10);
+    }
+
+    BOOST_AUTO_TEST_CASE(GaussianInSquareHasCorrectEvidenceAndMoments) {
+        hops::SequentialMonteCarlo sequentialMonteCarlo(createMarkovChains(2));
+        hops::RandomNumberGenerator randomNumberGenerator(42);
+
+        auto result = sequentialMonteCarlo.run(randomNumberGenerator, 1000, 10);
+
+        // The gaussian is normalized and almost all of its mass is within the square of volume 4.
+        BOOST_CHECK_SMALL(result.logEvidence - std::log(0.25), 0.15);
+        BOOST_CHECK_EQUAL(result.coldnesses.front(), 0);
+        BOOST_CHECK_EQUAL(result.coldnesses.back(), 1);
+        BOOST_CHECK_EQUAL(result.particles.size(), 1000);
+
+        Eigen::VectorXd mean = Eigen::VectorXd::Zero(2);
+        for (const auto &particle: result.particles) {
+            mean += particle;
+        }
+        mean /= result.particles.size();
+        double variance = 0;
+        for (const auto &particle: result.particles) {
+            variance += (particle - mean).squaredNorm() / 2;
+        }
+        variance /= result.particles.size();
+
+        BOOST_CHECK_SMALL(mean.cwiseAbs().maxCoeff(), 0.02);
+        BOOST_CHECK_CLOSE(variance, 0.01, 20);
+    }
+
+    BOOST_AUTO_TEST_CASE(ResultDoesNotDependOnThreadTiming) {
+        hops::SequentialMonteCarlo first(createMarkovChains(3));
+        hops::SequentialMonteCarlo second(createMarkovChains(3));
+        hops::RandomNumberGenerator firstRandomNumberGenerator(7);
+        hops::RandomNumberGenerator secondRandomNumberGenerator(7);
+
+        auto firstResult = first.run(firstRandomNumberGenerator, 200, 5);
+        auto secondResult = second.run(secondRandomNumberGenerator, 200, 5);
+
+        BOOST_CHECK_EQUAL(firstResult.logEvidence, secondResult.logEvidence);
+        for (size_t i = 0; i < firstResult.particles.size(); ++i) {
+            BOOST_CHECK(firstResult.particles[i] == secondResult.particles[i]);
+        }
+    }
+
+BOOST_AUTO_TEST_SUITE_END()